@@ -548,28 +548,56 @@ auto Esp32TleCommInterface::Delay(uint32_t microseconds) noexcept -> CommResult<
     if (microseconds == 0) {
         return {};
     }
+    return DelayUntil(TimingDeadline{TimingRequirement::Settle, GetTimeUs(), microseconds});
+}
+
+auto Esp32TleCommInterface::GetTimeUs() noexcept -> uint64_t {
+    return static_cast<uint64_t>(esp_timer_get_time());
+}
 
-    if (microseconds < 1000) {
-        // For delays less than 1ms, use esp_timer for accuracy
-        int64_t start_time = esp_timer_get_time();
-        while ((esp_timer_get_time() - start_time) < microseconds) {
-            // Busy wait for short delays
+auto Esp32TleCommInterface::DelayUntil(const TimingDeadline& deadline) noexcept -> CommResult<void> {
+    // From the tick rate: portTICK_PERIOD_MS truncates to 0 above 1000 Hz
+    constexpr uint64_t tick_us = 1'000'000U / static_cast<uint64_t>(configTICK_RATE_HZ);
+    static_assert(tick_us != 0, "configTICK_RATE_HZ above 1 MHz");
+    const uint64_t expires_at = (deadline.armed_at_us != 0)
+                                    ? deadline.ExpiresAtUs()
+                                    : GetTimeUs() + deadline.min_delay_us;
+
+    for (;;) {
+        const uint64_t now = GetTimeUs();
+        if (now >= expires_at) {
+            return {};
         }
-    } else {
-        // For longer delays, use FreeRTOS delay to yield to other tasks
-        vTaskDelay(pdMS_TO_TICKS(microseconds / 1000));
-        
-        // Handle remaining microseconds
-        uint32_t remaining_us = microseconds % 1000;
-        if (remaining_us > 0) {
-            int64_t start_time = esp_timer_get_time();
-            while ((esp_timer_get_time() - start_time) < remaining_us) {
-                // Busy wait for remainder
+        const uint64_t remaining = expires_at - now;
+
+        // Offer the gap to unrelated bus work first (never re-entrantly)
+        if (gap_hook_ != nullptr && !in_gap_work_ && remaining >= gap_min_budget_us_) {
+            in_gap_work_ = true;
+            const bool did_work = gap_hook_(gap_hook_context_, static_cast<uint32_t>(remaining));
+            in_gap_work_ = false;
+            if (did_work) {
+                continue;
             }
         }
+
+        // Yield whole ticks; vTaskDelay(n) never sleeps longer than n tick periods
+        if (remaining >= tick_us) {
+            vTaskDelay(static_cast<TickType_t>(remaining / tick_us));
+            continue;
+        }
+
+        // Busy-wait only the sub-tick residual
+        while (GetTimeUs() < expires_at) {
+        }
+        return {};
     }
+}
 
-    return {};
+void Esp32TleCommInterface::SetGapWorkHook(GapWorkHook hook, void* context,
+                                           uint32_t min_budget_us) noexcept {
+    gap_hook_ = hook;
+    gap_hook_context_ = context;
+    gap_min_budget_us_ = min_budget_us;
 }
 
 auto Esp32TleCommInterface::Configure(const tle92466ed::SPIConfig& config) noexcept -> CommResult<void> {
@@ -110,13 +110,47 @@ public:
     auto TransferMulti(std::span<const uint32_t> tx_data,
                        std::span<uint32_t> rx_data) noexcept -> CommResult<void>;
 
+    /**
+     * @brief Callback used to run unrelated bus work while a deadline is pending
+     * @param context User context registered with SetGapWorkHook()
+     * @param budget_us Time left until the deadline expires
+     * @return true if work was performed (deadline is re-evaluated), false if idle
+     */
+    using GapWorkHook = bool (*)(void* context, uint32_t budget_us);
+
     /**
      * @brief Delay for specified duration
      * @param microseconds Duration to delay in microseconds
      * @return CommResult<void> Success or error
+     *
+     * Equivalent to DelayUntil() with a deadline armed now.
      */
     auto Delay(uint32_t microseconds) noexcept -> CommResult<void>;
 
+    /**
+     * @brief Get monotonic time in microseconds (esp_timer)
+     * @return Microseconds since boot
+     */
+    auto GetTimeUs() noexcept -> uint64_t;
+
+    /**
+     * @brief Wait until a driver-declared deadline expires (hybrid scheduler)
+     * @param deadline Deadline armed by the driver
+     * @return CommResult<void> Success or error
+     *
+     * Whole scheduler ticks are spent yielding (or running the gap work hook);
+     * only the residual shorter than one tick is busy-waited.
+     */
+    auto DelayUntil(const TimingDeadline& deadline) noexcept -> CommResult<void>;
+
+    /**
+     * @brief Register a hook that runs unrelated bus work inside deadline gaps
+     * @param hook Callback (nullptr to disable)
+     * @param context User context passed to the callback
+     * @param min_budget_us Minimum remaining time before the hook is offered the gap
+     */
+    void SetGapWorkHook(GapWorkHook hook, void* context, uint32_t min_budget_us = 100) noexcept;
+
     /**
      * @brief Configure SPI parameters
      * @param config New SPI configuration
@@ -183,6 +217,10 @@ private:
     spi_device_handle_t spi_device_ = nullptr;  ///< SPI device handle
     bool initialized_ = false;                  ///< Initialization state
     CommError last_error_ = CommError::None;    ///< Last error that occurred
+    GapWorkHook gap_hook_ = nullptr;            ///< Bus work scheduled into deadline gaps
+    void* gap_hook_context_ = nullptr;          ///< Context passed to gap_hook_
+    uint32_t gap_min_budget_us_ = 100;          ///< Minimum gap offered to gap_hook_
+    bool in_gap_work_ = false;                  ///< Prevents re-entering gap_hook_
     
     static constexpr const char* TAG = "Esp32TleComm"; ///< Logging tag
 
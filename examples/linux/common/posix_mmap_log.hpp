@@ -0,0 +1,182 @@
+/**
+ * @file posix_mmap_log.hpp
+ * @brief Memory-mapped file backend for the TLE92466ED record log
+ *
+ * @details
+ * Maps a log file (LogHeader padded to one record, followed by the record
+ * slots) with MAP_SHARED. WriteRecord() is a 64-byte copy into the mapping:
+ * the kernel writes dirty pages back on its own and keeps them across a crash
+ * of the process. Sync() schedules write-back (msync MS_ASYNC) and belongs in a
+ * housekeeping thread, never on the control path.
+ *
+ * The mapping is pre-faulted (MAP_POPULATE) so the first write to a page does
+ * not take a page fault on the control path.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_POSIX_MMAP_LOG_HPP
+#define TLE92466ED_POSIX_MMAP_LOG_HPP
+
+#include <cerrno>
+#include <cstring>
+#include <expected>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tle92466ed_log.hpp"
+
+namespace tle92466ed::posix {
+
+/**
+ * @brief RecordLog backend on a memory-mapped file
+ *
+ * @details
+ * Errors of Open() are reported as errno values.
+ */
+class MmapLogBackend {
+public:
+  static constexpr std::size_t HEADER_SIZE = sizeof(LogRecord); ///< Header area in the file
+
+  MmapLogBackend() noexcept = default;
+
+  ~MmapLogBackend() noexcept {
+    Close();
+  }
+
+  MmapLogBackend(const MmapLogBackend&) = delete;
+  MmapLogBackend& operator=(const MmapLogBackend&) = delete;
+
+  /**
+   * @brief Open or create the log file
+   *
+   * @details
+   * A new file is sized for capacity records and reads as zeros, i.e. without
+   * a valid header, so RecordLog::Open() formats it. An existing file keeps its
+   * size; capacity is then taken from the file.
+   *
+   * @param path Log file path
+   * @param capacity Record slots for a new file
+   * @return std::expected<void, int> Success or errno
+   */
+  [[nodiscard]] std::expected<void, int> Open(const char* path, uint32_t capacity) noexcept {
+    Close();
+    const int fd = ::open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+      return std::unexpected(errno);
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+      const int error = errno;
+      ::close(fd);
+      return std::unexpected(error);
+    }
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    if (size < HEADER_SIZE + sizeof(LogRecord)) {
+      size = HEADER_SIZE + static_cast<std::size_t>(capacity) * sizeof(LogRecord);
+      if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        const int error = errno;
+        ::close(fd);
+        return std::unexpected(error);
+      }
+    }
+    void* mapping =
+        ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+    const int error = errno;
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+      return std::unexpected(error);
+    }
+    base_ = static_cast<uint8_t*>(mapping);
+    size_ = size;
+    capacity_ = static_cast<uint32_t>((size - HEADER_SIZE) / sizeof(LogRecord));
+    return {};
+  }
+
+  /**
+   * @brief Unmap the file (pending pages are still written back by the kernel)
+   */
+  void Close() noexcept {
+    if (base_ != nullptr) {
+      ::munmap(base_, size_);
+      base_ = nullptr;
+      size_ = 0;
+      capacity_ = 0;
+    }
+  }
+
+  /**
+   * @brief Schedule write-back of dirty pages (housekeeping, not control path)
+   */
+  void Sync() noexcept {
+    if (base_ != nullptr) {
+      ::msync(base_, size_, MS_ASYNC);
+    }
+  }
+
+  [[nodiscard]] uint32_t Capacity() const noexcept {
+    return capacity_;
+  }
+
+  [[nodiscard]] bool ReadHeader(LogHeader& header) const noexcept {
+    if (base_ == nullptr) {
+      return false;
+    }
+    std::memcpy(&header, base_, sizeof(header));
+    return true;
+  }
+
+  [[nodiscard]] bool ReadRecord(uint32_t slot, LogRecord& record) const noexcept {
+    if (base_ == nullptr || slot >= capacity_) {
+      return false;
+    }
+    std::memcpy(&record, slotAddress(slot), sizeof(record));
+    return true;
+  }
+
+  [[nodiscard]] bool Format(const LogHeader& header) noexcept {
+    if (base_ == nullptr) {
+      return false;
+    }
+    std::memset(base_ + HEADER_SIZE, 0xFF, size_ - HEADER_SIZE);
+    std::memset(base_, 0, HEADER_SIZE);
+    std::memcpy(base_, &header, sizeof(header));
+    // The new epoch must be durable before records of it are written
+    return ::msync(base_, size_, MS_SYNC) == 0;
+  }
+
+  [[nodiscard]] bool WriteRecord(uint32_t slot, const LogRecord& record) noexcept {
+    if (base_ == nullptr || slot >= capacity_) {
+      return false;
+    }
+    std::memcpy(slotAddress(slot), &record, sizeof(record));
+    return true;
+  }
+
+  [[nodiscard]] bool Invalidate(uint32_t slot) noexcept {
+    if (base_ == nullptr || slot >= capacity_) {
+      return false;
+    }
+    std::memset(slotAddress(slot), 0, sizeof(LogRecord));
+    return true;
+  }
+
+private:
+  [[nodiscard]] uint8_t* slotAddress(uint32_t slot) const noexcept {
+    return base_ + HEADER_SIZE + static_cast<std::size_t>(slot) * sizeof(LogRecord);
+  }
+
+  uint8_t* base_{nullptr}; ///< Mapping
+  std::size_t size_{0};    ///< Mapped size (bytes)
+  uint32_t capacity_{0};   ///< Record slots
+};
+
+static_assert(LogBackend<MmapLogBackend>);
+
+} // namespace tle92466ed::posix
+
+#endif // TLE92466ED_POSIX_MMAP_LOG_HPP
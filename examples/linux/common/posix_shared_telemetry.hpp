@@ -0,0 +1,166 @@
+/**
+ * @file posix_shared_telemetry.hpp
+ * @brief POSIX shared-memory transport for TLE92466ED telemetry
+ *
+ * @details
+ * Maps a tle92466ed::TelemetryBlock into a named POSIX shared-memory segment
+ * (shm_open + mmap). The process that owns the SPI bus creates the segment and
+ * publishes samples; any number of local processes attach read-only and read
+ * the latest sample directly from the mapping: no syscalls per read and no
+ * locking against the bus owner.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_POSIX_SHARED_TELEMETRY_HPP
+#define TLE92466ED_POSIX_SHARED_TELEMETRY_HPP
+
+#include <cerrno>
+#include <expected>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "tle92466ed_telemetry.hpp"
+
+namespace tle92466ed::posix {
+
+/**
+ * @brief Telemetry block mapped from a POSIX shared-memory segment
+ *
+ * @details
+ * Errors are reported as errno values.
+ */
+class SharedTelemetry {
+public:
+  SharedTelemetry() noexcept = default;
+
+  ~SharedTelemetry() noexcept {
+    Close();
+  }
+
+  SharedTelemetry(const SharedTelemetry&) = delete;
+  SharedTelemetry& operator=(const SharedTelemetry&) = delete;
+
+  /**
+   * @brief Create (or take over) the segment as publisher
+   *
+   * @details
+   * The block header is (re)initialized, so a segment left behind by a crashed
+   * publisher is reused.
+   *
+   * @param name Segment name, e.g. "/tle92466ed0"
+   * @param mode Permission bits for readers (default: world-readable)
+   * @return std::expected<void, int> Success or errno
+   */
+  [[nodiscard]] std::expected<void, int> Create(const char* name, mode_t mode = 0644) noexcept {
+    Close();
+    const int fd = ::shm_open(name, O_CREAT | O_RDWR, mode);
+    if (fd < 0) {
+      return std::unexpected(errno);
+    }
+    if (::ftruncate(fd, sizeof(TelemetryBlock)) != 0) {
+      const int error = errno;
+      ::close(fd);
+      return std::unexpected(error);
+    }
+    void* mapping =
+        ::mmap(nullptr, sizeof(TelemetryBlock), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const int error = errno;
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+      return std::unexpected(error);
+    }
+    block_ = ::new (mapping) TelemetryBlock{};
+    writable_ = true;
+    return {};
+  }
+
+  /**
+   * @brief Attach to an existing segment as reader
+   *
+   * @param name Segment name used by the publisher
+   * @return std::expected<void, int> Success, errno, or EPROTO for an incompatible block
+   */
+  [[nodiscard]] std::expected<void, int> Attach(const char* name) noexcept {
+    Close();
+    const int fd = ::shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+      return std::unexpected(errno);
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(TelemetryBlock))) {
+      ::close(fd);
+      return std::unexpected(EPROTO);
+    }
+    void* mapping = ::mmap(nullptr, sizeof(TelemetryBlock), PROT_READ, MAP_SHARED, fd, 0);
+    const int error = errno;
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+      return std::unexpected(error);
+    }
+    block_ = static_cast<TelemetryBlock*>(mapping);
+    writable_ = false;
+    if (!block_->IsCompatible()) {
+      Close();
+      return std::unexpected(EPROTO);
+    }
+    return {};
+  }
+
+  /**
+   * @brief Unmap the segment (the name stays until Unlink())
+   */
+  void Close() noexcept {
+    if (block_ != nullptr) {
+      ::munmap(block_, sizeof(TelemetryBlock));
+      block_ = nullptr;
+    }
+  }
+
+  /**
+   * @brief Remove the segment name (publisher shutdown)
+   */
+  static void Unlink(const char* name) noexcept {
+    ::shm_unlink(name);
+  }
+
+  /**
+   * @brief Publish a sample (publisher only)
+   * @return false if not created as publisher
+   */
+  bool Publish(const TelemetrySample& sample) noexcept {
+    if (block_ == nullptr || !writable_) {
+      return false;
+    }
+    block_->Publish(sample);
+    return true;
+  }
+
+  /**
+   * @brief Read the latest sample
+   * @return false if not attached or no consistent copy could be made
+   */
+  [[nodiscard]] bool Read(TelemetrySample& sample) const noexcept {
+    return block_ != nullptr && block_->Read(sample);
+  }
+
+  /**
+   * @brief Number of samples published so far (0 if not mapped)
+   */
+  [[nodiscard]] uint32_t Publications() const noexcept {
+    return block_ != nullptr ? block_->latest.Publications() : 0;
+  }
+
+private:
+  TelemetryBlock* block_{nullptr}; ///< Mapped block
+  bool writable_{false};           ///< Mapped read-write (publisher)
+};
+
+} // namespace tle92466ed::posix
+
+#endif // TLE92466ED_POSIX_SHARED_TELEMETRY_HPP
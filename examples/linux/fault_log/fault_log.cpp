@@ -0,0 +1,214 @@
+/**
+ * @file fault_log.cpp
+ * @brief Crash-safe TLE92466ED fault/telemetry log on a memory-mapped file
+ *
+ * @details
+ * write: runs the driver, appends a telemetry record per period and a fault
+ *        report plus CH0 diagnostics every 10th period. With --crash the
+ *        program leaves a torn record behind and exits without cleanup, as a
+ *        crash during a write would.
+ * dump:  recovers the log and prints the records from a given time on, using
+ *        the time index to seek.
+ *
+ * Usage:
+ *   tle92466ed_fault_log write <file> [count] [--crash]
+ *   tle92466ed_fault_log dump <file> [from_us]
+ *   tle92466ed_fault_log format <file>
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+#include "posix_mmap_log.hpp"
+#include "register_file_comm.hpp"
+
+using tle92466ed::Channel;
+using tle92466ed::ChannelDiagnostics;
+using tle92466ed::Driver;
+using tle92466ed::FaultReport;
+using tle92466ed::LogCursor;
+using tle92466ed::LogRecord;
+using tle92466ed::LogRecordType;
+using tle92466ed::LogRecovery;
+using tle92466ed::RecordLog;
+using tle92466ed::TelemetryLogPayload;
+using tle92466ed::TelemetrySample;
+using tle92466ed::posix::MmapLogBackend;
+using tle92466ed::tools::RegisterFileComm;
+
+namespace {
+
+constexpr uint32_t LOG_CAPACITY = 4096; ///< Record slots of a new log file
+
+uint64_t nowUs() {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::system_clock::now().time_since_epoch())
+                                   .count());
+}
+
+bool openLog(MmapLogBackend& backend, RecordLog<MmapLogBackend>& log, const char* path) {
+  if (auto result = backend.Open(path, LOG_CAPACITY); !result) {
+    std::fprintf(stderr, "open %s failed: %s\n", path, std::strerror(result.error()));
+    return false;
+  }
+  LogRecovery recovery{};
+  if (!log.Open(&recovery)) {
+    std::fprintf(stderr, "log recovery failed\n");
+    return false;
+  }
+  std::printf("epoch %" PRIu32 ": %" PRIu32 " records recovered, %" PRIu32 " skipped, %" PRIu32
+              " discarded%s\n",
+              log.Epoch(), recovery.records, recovery.skipped, recovery.discarded,
+              recovery.formatted ? " (formatted)" : "");
+  return true;
+}
+
+int writeLog(const char* path, long count, bool crash) {
+  MmapLogBackend backend;
+  RecordLog<MmapLogBackend> log(backend);
+  if (!openLog(backend, log, path)) {
+    return 1;
+  }
+
+  RegisterFileComm comm;
+  Driver<RegisterFileComm> driver(comm);
+  if (!driver.Init()) {
+    std::fprintf(stderr, "driver init failed\n");
+    return 1;
+  }
+
+  TelemetrySample sample{};
+  for (long i = 0; i < count; ++i) {
+    // Synthetic feedback on CH0
+    const auto base = tle92466ed::GetChannelBase(Channel::CH0);
+    comm.Register(base + tle92466ed::ChannelReg::FB_I_AVG) = static_cast<uint16_t>(i * 37 & 0x7FFF);
+
+    if (driver.CaptureTelemetry(sample)) {
+      sample.timestamp_us = nowUs();
+      (void)log.Append(tle92466ed::MakeTelemetryRecord(sample));
+    }
+    if (i % 10 == 0) {
+      if (auto faults = driver.GetAllFaults(); faults) {
+        (void)log.Append(tle92466ed::MakeFaultRecord(nowUs(), *faults));
+      }
+      if (auto diag = driver.GetChannelDiagnostics(Channel::CH0); diag) {
+        (void)log.Append(tle92466ed::MakeChannelRecord(nowUs(), Channel::CH0, *diag));
+      }
+    }
+    // Housekeeping: schedule write-back outside the appends
+    if (i % 100 == 99) {
+      backend.Sync();
+    }
+  }
+  std::printf("%" PRIu32 " records in log, %" PRIu32 " dropped\n", log.Count(), log.Dropped());
+
+  if (crash) {
+    // A write interrupted half-way: right epoch and sequence, wrong checksum
+    LogRecord torn = tle92466ed::MakeTelemetryRecord(sample);
+    torn.sequence = log.Count();
+    torn.epoch = log.Epoch();
+    torn.crc = torn.ComputeCrc() ^ 0x1U;
+    (void)backend.WriteRecord(log.SlotsUsed(), torn);
+    std::printf("simulated crash during a write\n");
+    _exit(2);
+  }
+  return 0;
+}
+
+void printRecord(const LogRecord& record) {
+  std::printf("#%-6" PRIu32 " t=%" PRIu64 "us ", record.sequence, record.timestamp_us);
+  switch (static_cast<LogRecordType>(record.type)) {
+    case LogRecordType::Fault: {
+      FaultReport report{};
+      (void)tle92466ed::DecodeFaultRecord(record, report);
+      std::printf("FAULT any=%d vbat_uv=%d vbat_ov=%d ot_err=%d por=%d spi_wd=%d ch_mask=0x%02X\n",
+                  report.any_fault, report.vbat_uv, report.vbat_ov, report.ot_error,
+                  report.por_event, report.spi_wd_error,
+                  [&] {
+                    unsigned mask = 0;
+                    for (std::size_t ch = 0; ch < report.channels.size(); ++ch) {
+                      mask |= (report.channels[ch].has_fault ? 1U : 0U) << ch;
+                    }
+                    return mask;
+                  }());
+      break;
+    }
+    case LogRecordType::ChannelSnapshot: {
+      ChannelDiagnostics diag{};
+      (void)tle92466ed::DecodeChannelRecord(record, diag);
+      std::printf("CH%u iavg=%u dc=%u oc=%d ol=%d ot=%d\n", record.channel, diag.average_current,
+                  diag.duty_cycle, diag.overcurrent, diag.open_load, diag.over_temperature);
+      break;
+    }
+    case LogRecordType::Telemetry: {
+      TelemetryLogPayload telemetry{};
+      (void)tle92466ed::DecodeTelemetryRecord(record, telemetry);
+      std::printf("TELEMETRY #%" PRIu32 " VBAT=%umV DIAG0=0x%04X EN=0x%02X ERR=0x%02X CH0=%u\n",
+                  telemetry.capture_count, telemetry.vbat_mv, telemetry.global_diag0,
+                  telemetry.enable_mask, telemetry.err_mask, telemetry.average_current[0]);
+      break;
+    }
+    default:
+      std::printf("type %u\n", record.type);
+      break;
+  }
+}
+
+int dumpLog(const char* path, uint64_t from_us) {
+  MmapLogBackend backend;
+  RecordLog<MmapLogBackend> log(backend);
+  if (!openLog(backend, log, path)) {
+    return 1;
+  }
+  LogCursor cursor = from_us != 0 ? log.Seek(from_us) : log.Begin();
+  LogRecord record{};
+  while (log.Next(cursor, record)) {
+    printRecord(record);
+  }
+  return 0;
+}
+
+int formatLog(const char* path) {
+  MmapLogBackend backend;
+  RecordLog<MmapLogBackend> log(backend);
+  if (!openLog(backend, log, path) || !log.Format()) {
+    return 1;
+  }
+  std::printf("formatted, epoch %" PRIu32 "\n", log.Epoch());
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    std::fprintf(stderr,
+                 "usage: %s write <file> [count] [--crash]\n"
+                 "       %s dump <file> [from_us]\n"
+                 "       %s format <file>\n",
+                 argv[0], argv[0], argv[0]);
+    return 1;
+  }
+  const char* command = argv[1];
+  const char* path = argv[2];
+  if (std::strcmp(command, "write") == 0) {
+    const long count = argc > 3 ? std::atol(argv[3]) : 100;
+    const bool crash = argc > 4 && std::strcmp(argv[4], "--crash") == 0;
+    return writeLog(path, count, crash);
+  }
+  if (std::strcmp(command, "dump") == 0) {
+    return dumpLog(path, argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 0);
+  }
+  if (std::strcmp(command, "format") == 0) {
+    return formatLog(path);
+  }
+  std::fprintf(stderr, "unknown command %s\n", command);
+  return 1;
+}
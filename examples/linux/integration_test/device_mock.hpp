@@ -0,0 +1,398 @@
+/**
+ * @file device_mock.hpp
+ * @brief Register-level TLE92466ED device model for the host integration tests
+ *
+ * @details
+ * Implements the SpiInterface contract against a model of the device instead
+ * of hardware:
+ * - Pipelined replies (the reply to frame k is returned with frame k+1), each
+ *   with a valid CRC; FB_VOLTAGE1/2 answer with 22-bit reply frames
+ * - 10-bit read address space, 7-bit write address space as encoded by the
+ *   write frame
+ * - Reset values on power-up and on every RESN release; MISO reads 0 while RESN
+ *   is held low
+ * - Clear-on-write-1 for GLOBAL_DIAG0..2 and DIAG_ERR/DIAG_WARN_CHGRx
+ * - CH_CTRL is write-only (reads return 0), as on the device
+ * - With GLOBAL_CONFIG.CRC_EN set, frames with a bad CRC are answered with a
+ *   non-zero status and not executed
+ * - Channel feedback (FB_I_AVG, FB_DC, FB_IMIN_IMAX) follows SETPOINT while
+ *   the channel is enabled in Mission Mode with EN high, and is 0 otherwise
+ * - FAULTN is active while a fault flag is latched; faults can be injected
+ * - Delay() and transfers can be made to fail, to exercise the error paths
+ *
+ * Frame and transfer counters measure the bus cost of a call. Delay() advances
+ * a simulated clock instead of sleeping, so timing requirements cost no host
+ * time and the wall-clock time of a test is the driver's own CPU time.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_EXAMPLES_DEVICE_MOCK_HPP
+#define TLE92466ED_EXAMPLES_DEVICE_MOCK_HPP
+
+#include <array>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+
+#include "tle92466ed.hpp"
+
+namespace tle92466ed::examples {
+
+/**
+ * @brief Behavioural register model of one TLE92466ED behind an SpiInterface
+ */
+class DeviceMockComm : public SpiInterface<DeviceMockComm> {
+public:
+  using SpiInterface<DeviceMockComm>::Log;
+
+  static constexpr uint16_t ICVID_VALUE = 0x9201;                     ///< Returned for ICVID
+  static constexpr std::array<uint16_t, 3> CHIP_ID{0x1234, 0x5678, 0x9ABC}; ///< CHIPID0..2
+  static constexpr uint32_t FRAME_TIME_US = 8;                        ///< 32 bits at 4 MHz
+  static constexpr uint16_t VIO_RAW = 956;   ///< FB_VOLTAGE1 VIO (3.30 V)
+  static constexpr uint16_t VDD_RAW = 1448;  ///< FB_VOLTAGE1 VDD (5.00 V)
+  static constexpr uint16_t VBAT_RAW = 592;  ///< FB_VOLTAGE2 VBAT (12.0 V)
+
+  DeviceMockComm() noexcept {
+    powerOnReset();
+  }
+
+  //==========================================================================
+  // SpiInterface hooks
+  //==========================================================================
+
+  CommResult<void> Init() noexcept {
+    return {};
+  }
+  CommResult<void> Deinit() noexcept {
+    return {};
+  }
+
+  CommResult<uint32_t> Transfer32(uint32_t tx_data) noexcept {
+    if (fail_transfers_) {
+      return std::unexpected(CommError::TransferError);
+    }
+    ++frames_;
+    ++transfers_;
+    clock_us_ += FRAME_TIME_US;
+    return clock(tx_data);
+  }
+
+  CommResult<void> TransferMulti(std::span<const uint32_t> tx_data,
+                                 std::span<uint32_t> rx_data) noexcept {
+    if (rx_data.size() < tx_data.size()) {
+      return std::unexpected(CommError::InvalidParameter);
+    }
+    if (fail_transfers_) {
+      return std::unexpected(CommError::TransferError);
+    }
+    ++transfers_;
+    frames_ += tx_data.size();
+    clock_us_ += FRAME_TIME_US * tx_data.size();
+    for (std::size_t i = 0; i < tx_data.size(); ++i) {
+      rx_data[i] = clock(tx_data[i]);
+    }
+    return {};
+  }
+
+  CommResult<void> Delay(uint32_t microseconds) noexcept {
+    if (fail_delays_) {
+      return std::unexpected(CommError::Timeout);
+    }
+    clock_us_ += microseconds;
+    return {};
+  }
+
+  CommResult<void> Configure(const SPIConfig& /*config*/) noexcept {
+    return {};
+  }
+  bool IsReady() const noexcept {
+    return true;
+  }
+  CommError GetLastError() const noexcept {
+    return CommError::None;
+  }
+  CommResult<void> ClearErrors() noexcept {
+    return {};
+  }
+
+  CommResult<void> SetGpioPin(ControlPin pin, ActiveLevel level) noexcept {
+    const bool active = level == ActiveLevel::ACTIVE;
+    switch (pin) {
+    case ControlPin::RESN:
+      // ACTIVE = RESN high = running; the device resets on the rising edge
+      if (active && in_reset_) {
+        reset(GLOBAL_DIAG0::RES_EVENT);
+      }
+      in_reset_ = !active;
+      return {};
+    case ControlPin::EN:
+      en_ = active;
+      return {};
+    case ControlPin::FAULTN:
+      break;
+    }
+    return std::unexpected(CommError::InvalidParameter); // FAULTN is an input
+  }
+
+  CommResult<ActiveLevel> GetGpioPin(ControlPin pin) noexcept {
+    if (pin != ControlPin::FAULTN) {
+      return std::unexpected(CommError::InvalidParameter);
+    }
+    return FaultPending() ? ActiveLevel::ACTIVE : ActiveLevel::INACTIVE;
+  }
+
+  void Log(LogLevel level, const char* tag, const char* format, va_list args) noexcept {
+    if (!verbose_) {
+      return;
+    }
+    std::fprintf(stderr, "[%s] %u ", tag, static_cast<unsigned>(level));
+    std::vfprintf(stderr, format, args);
+  }
+
+  /// Simulated time (starts at 1 so deadlines are armed)
+  [[nodiscard]] uint64_t GetTimeUs() const noexcept {
+    return clock_us_;
+  }
+
+  //==========================================================================
+  // Test access
+  //==========================================================================
+
+  /// Print driver log output to stderr
+  void SetVerbose(bool verbose) noexcept {
+    verbose_ = verbose;
+  }
+
+  /// 32-bit frames clocked since the last ResetCounters()
+  [[nodiscard]] std::size_t Frames() const noexcept {
+    return frames_;
+  }
+  /// Chip-select transactions since the last ResetCounters()
+  [[nodiscard]] std::size_t Transfers() const noexcept {
+    return transfers_;
+  }
+  void ResetCounters() noexcept {
+    frames_ = 0;
+    transfers_ = 0;
+  }
+
+  /// Register content as the device holds it (CH_CTRL included)
+  [[nodiscard]] uint16_t Register(uint16_t address) const noexcept {
+    return regs_[address & ADDRESS_MASK];
+  }
+
+  [[nodiscard]] bool InReset() const noexcept {
+    return in_reset_;
+  }
+  [[nodiscard]] bool Enabled() const noexcept {
+    return en_;
+  }
+  [[nodiscard]] bool MissionMode() const noexcept {
+    return (regs_[CentralReg::CH_CTRL] & CH_CTRL::OP_MODE) != 0;
+  }
+  /// Channels enabled in CH_CTRL (bit per channel)
+  [[nodiscard]] uint8_t ChannelEnables() const noexcept {
+    return static_cast<uint8_t>(regs_[CentralReg::CH_CTRL] & CH_CTRL::ALL_CH_MASK);
+  }
+  /// Frames rejected for a bad CRC
+  [[nodiscard]] std::size_t CrcErrors() const noexcept {
+    return crc_errors_;
+  }
+
+  /// Make every Delay() fail with CommError::Timeout (true) or succeed again (false)
+  void FailDelays(bool fail) noexcept {
+    fail_delays_ = fail;
+  }
+
+  /// Make every transfer fail with CommError::TransferError (nothing is clocked)
+  void FailTransfers(bool fail) noexcept {
+    fail_transfers_ = fail;
+  }
+
+  /// Flip a CRC bit of the reply to the next frame (a transmission error on MISO)
+  void CorruptNextReply() noexcept {
+    corrupt_next_reply_ = true;
+  }
+
+  /// Latch global fault flags (GLOBAL_DIAG0 bits)
+  void InjectGlobalFault(uint16_t diag0_bits) noexcept {
+    regs_[CentralReg::GLOBAL_DIAG0] |= diag0_bits;
+  }
+
+  /// Latch channel error flags (DIAG_ERR_CHGRx bits)
+  void InjectChannelFault(uint8_t channel, uint16_t diag_err_bits) noexcept {
+    regs_[CentralReg::DIAG_ERR_CHGR0 + (channel % 6U)] |= diag_err_bits;
+  }
+
+  /// true while any fault flag is latched (drives FAULTN)
+  [[nodiscard]] bool FaultPending() const noexcept {
+    bool pending = (regs_[CentralReg::GLOBAL_DIAG0] & GLOBAL_DIAG0::FAULT_MASK) != 0 ||
+                   regs_[CentralReg::GLOBAL_DIAG1] != 0 || regs_[CentralReg::GLOBAL_DIAG2] != 0;
+    for (uint16_t i = 0; i < 6; ++i) {
+      pending = pending || regs_[CentralReg::DIAG_ERR_CHGR0 + i] != 0;
+    }
+    return pending;
+  }
+
+private:
+  static constexpr uint16_t ADDRESS_MASK = 0x03FF;
+  static constexpr std::array<uint16_t, 6> CHANNEL_BASES{ChannelBase::CH0, ChannelBase::CH1,
+                                                         ChannelBase::CH2, ChannelBase::CH3,
+                                                         ChannelBase::CH4, ChannelBase::CH5};
+
+  void powerOnReset() noexcept {
+    reset(GLOBAL_DIAG0::DEFAULT);
+  }
+
+  void reset(uint16_t diag0) noexcept {
+    regs_.fill(0);
+    regs_[CentralReg::GLOBAL_CONFIG] = GLOBAL_CONFIG::DEFAULT;
+    regs_[CentralReg::GLOBAL_DIAG0] = diag0;
+    regs_[CentralReg::FB_STAT] = FB_STAT::INIT_DONE;
+    regs_[CentralReg::ICVID] = ICVID_VALUE;
+    for (std::size_t i = 0; i < CHIP_ID.size(); ++i) {
+      regs_[CentralReg::CHIPID0 + i] = CHIP_ID[i];
+    }
+    idle_reply_ = makeReply(0, false, 0);
+  }
+
+  [[nodiscard]] static bool isClearOnWrite(uint16_t address) noexcept {
+    return (address >= CentralReg::GLOBAL_DIAG0 && address <= CentralReg::GLOBAL_DIAG2) ||
+           (address >= CentralReg::DIAG_ERR_CHGR0 && address <= CentralReg::DIAG_WARN_CHGR5);
+  }
+
+  /// true if the channel drives current (enabled in Mission Mode with EN high)
+  [[nodiscard]] bool channelActive(std::size_t index) const noexcept {
+    return en_ && MissionMode() && (ChannelEnables() & (1U << index)) != 0;
+  }
+
+  /// Value of a feedback register, or false if the address is no channel feedback
+  [[nodiscard]] bool channelFeedback(uint16_t address, uint16_t& value) const noexcept {
+    for (std::size_t i = 0; i < CHANNEL_BASES.size(); ++i) {
+      const uint16_t base = CHANNEL_BASES[i];
+      if (address < base + ChannelReg::FB_DC || address > base + ChannelReg::FB_PERIOD_MIN_MAX) {
+        continue;
+      }
+      const uint16_t target = channelActive(i)
+                                  ? static_cast<uint16_t>(regs_[base] & SETPOINT::TARGET_MASK)
+                                  : 0;
+      const auto current8 = static_cast<uint16_t>(target >> 7); // 8-bit min/max scale
+      switch (static_cast<uint16_t>(address - base)) {
+      case ChannelReg::FB_I_AVG:
+        value = target;
+        break;
+      case ChannelReg::FB_DC:
+        value = static_cast<uint16_t>(target / 2);
+        break;
+      case ChannelReg::FB_VBAT:
+        value = channelActive(i) ? VBAT_RAW : 0;
+        break;
+      case ChannelReg::FB_IMIN_IMAX:
+        value = static_cast<uint16_t>((current8 << 8) | current8);
+        break;
+      default:
+        value = 0;
+        break;
+      }
+      return true;
+    }
+    return false;
+  }
+
+  [[nodiscard]] static uint32_t makeReply(uint32_t data, bool wide, uint8_t status,
+                                          bool write = false) noexcept {
+    SPIFrame rx{};
+    if (wide) {
+      rx.rx_22bit.data = data & 0x3FFFFFU;
+      rx.rx_22bit.reply_mode = 1;
+    } else {
+      rx.rx_16bit.data = data & 0xFFFFU;
+      rx.rx_16bit.rw_echo = write ? 1 : 0;
+      rx.rx_16bit.status = status;
+      rx.rx_16bit.reply_mode = 0;
+    }
+    rx.rx_16bit.crc = CalculateFrameCrc(rx);
+    return rx.word;
+  }
+
+  /// One frame on the bus: the previous reply out, the next one latched
+  uint32_t clock(uint32_t tx_data) noexcept {
+    const uint32_t reply = exchange(tx_data);
+    if (corrupt_next_reply_ && !in_reset_) {
+      SPIFrame rx{};
+      rx.word = idle_reply_;
+      rx.rx_16bit.crc ^= 1U;
+      idle_reply_ = rx.word;
+      corrupt_next_reply_ = false;
+    }
+    return reply;
+  }
+
+  uint32_t exchange(uint32_t tx_data) noexcept {
+    if (in_reset_) {
+      idle_reply_ = 0;
+      return 0; // MISO stays low while the device is held in reset
+    }
+    const uint32_t reply = idle_reply_;
+    SPIFrame tx{};
+    tx.word = tx_data;
+    const bool write = tx.tx_fields.rw != 0;
+
+    if ((regs_[CentralReg::GLOBAL_CONFIG] & GLOBAL_CONFIG::CRC_EN) != 0 && !VerifyFrameCrc(tx)) {
+      ++crc_errors_;
+      idle_reply_ = makeReply(0, false, 0x01, write); // Status: SPI frame error
+      return reply;
+    }
+
+    if (write) {
+      const auto address = static_cast<uint16_t>(tx.tx_fields.address);
+      const auto value = static_cast<uint16_t>(tx.tx_fields.data);
+      regs_[address] = isClearOnWrite(address) ? static_cast<uint16_t>(regs_[address] & ~value)
+                                               : value;
+      idle_reply_ = makeReply(value, false, 0, true);
+      return reply;
+    }
+
+    const auto address = static_cast<uint16_t>(tx.tx_fields.data & ADDRESS_MASK);
+    uint16_t value = 0;
+    if (address == CentralReg::FB_VOLTAGE1) {
+      idle_reply_ = makeReply((static_cast<uint32_t>(VDD_RAW) << VOLTAGE_FEEDBACK::VDD_SHIFT) |
+                                  VIO_RAW,
+                              true, 0);
+      return reply;
+    }
+    if (address == CentralReg::FB_VOLTAGE2) {
+      idle_reply_ = makeReply(static_cast<uint32_t>(VBAT_RAW) << VOLTAGE_FEEDBACK::VBAT_SHIFT,
+                              true, 0);
+      return reply;
+    }
+    if (address == CentralReg::CH_CTRL) {
+      value = 0; // Write-only
+    } else if (!channelFeedback(address, value)) {
+      value = regs_[address];
+    }
+    idle_reply_ = makeReply(value, false, 0);
+    return reply;
+  }
+
+  std::array<uint16_t, ADDRESS_MASK + 1> regs_{}; ///< Register file (10-bit address space)
+  uint32_t idle_reply_{0};                        ///< Reply to the previous frame
+  bool in_reset_{false};                          ///< RESN held low
+  bool en_{false};                                ///< EN pin level
+  bool verbose_{false};                           ///< Print driver logs
+  bool fail_delays_{false};                       ///< Delay() fails
+  bool fail_transfers_{false};                    ///< Transfer32()/TransferMulti() fail
+  bool corrupt_next_reply_{false};                ///< Next latched reply gets a bad CRC
+  std::size_t frames_{0};                         ///< Frames clocked
+  std::size_t transfers_{0};                      ///< CS transactions
+  std::size_t crc_errors_{0};                     ///< Frames rejected for a bad CRC
+  uint64_t clock_us_{1};                          ///< Simulated clock
+};
+
+} // namespace tle92466ed::examples
+
+#endif // TLE92466ED_EXAMPLES_DEVICE_MOCK_HPP
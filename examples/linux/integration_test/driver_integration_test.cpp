@@ -0,0 +1,1177 @@
+/**
+ * @file driver_integration_test.cpp
+ * @brief Host port of the TLE92466ED driver integration test suite
+ *
+ * @details
+ * Runs the scenarios of examples/esp32/main/driver_integration_test.cpp
+ * against DeviceMockComm (device_mock.hpp) instead of hardware. Every test
+ * gets a fresh device and driver, initialized unless the test covers
+ * initialization itself, and is checked three ways:
+ * - functional checks against the driver results and the device model state
+ * - SPI frame budget: the frames the test clocks may not exceed max_frames.
+ *   Budgets are the current cost of each scenario, so any added frame on a
+ *   driver path fails the test; lower a budget when a path gets cheaper.
+ * - wall-clock budget: host time of the test body (best of three runs). The
+ *   mock does not sleep, so this is the driver's own CPU time. Scale with
+ *   TLE92466ED_WALL_BUDGET_SCALE for slow builds (sanitizers, -O0, valgrind).
+ *
+ * Usage:
+ *   tle92466ed_driver_integration_test [-v] [--list] [test_name...]
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#define TLE92466ED_ENABLE_INTEGRITY
+#define TLE92466ED_ENABLE_THERMAL
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include "device_mock.hpp"
+#include "tle92466ed_bundle.hpp"
+#include "tle92466ed_log.hpp"
+
+using namespace tle92466ed;
+using tle92466ed::examples::DeviceMockComm;
+
+namespace {
+
+/// Fails the running test with the failed condition and its line
+#define CHECK(condition)                                                                        \
+  do {                                                                                         \
+    if (!(condition)) {                                                                        \
+      std::fprintf(stderr, "    %s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);   \
+      return false;                                                                            \
+    }                                                                                          \
+  } while (0)
+
+/**
+ * @brief Device model plus driver under test
+ */
+struct Bench {
+  DeviceMockComm comm;
+  Driver<DeviceMockComm> driver{comm};
+};
+
+constexpr std::array<Channel, 6> ALL_CHANNELS{Channel::CH0, Channel::CH1, Channel::CH2,
+                                              Channel::CH3, Channel::CH4, Channel::CH5};
+
+/// |a - b| <= tolerance
+bool near(uint32_t a, uint32_t b, uint32_t tolerance) {
+  return (a > b ? a - b : b - a) <= tolerance;
+}
+
+//=============================================================================
+// HELPERS
+//=============================================================================
+
+bool ensureConfigMode(Bench& bench) {
+  return bench.driver.IsConfigMode() || bench.driver.EnterConfigMode().has_value();
+}
+
+bool ensureMissionMode(Bench& bench) {
+  return bench.driver.IsMissionMode() || bench.driver.EnterMissionMode().has_value();
+}
+
+/// Mission Mode with EN high, as the channel tests need it
+bool ensureOutputsLive(Bench& bench) {
+  return ensureMissionMode(bench) && bench.driver.Enable().has_value();
+}
+
+//=============================================================================
+// INITIALIZATION TESTS
+//=============================================================================
+
+bool testHalInitialization(Bench& bench) {
+  CHECK(bench.comm.Init());
+  CHECK(bench.comm.IsReady());
+  return true;
+}
+
+bool testDriverInitialization(Bench& bench) {
+  CHECK(!bench.driver.IsInitialized());
+  CHECK(bench.driver.Init());
+  CHECK(bench.driver.IsInitialized());
+  CHECK(bench.driver.IsConfigMode());
+  CHECK(!bench.comm.InReset());
+  CHECK(!bench.comm.Enabled()); // EN stays low until the application enables outputs
+  CHECK(!bench.comm.FaultPending()); // Init() clears the POR/reset event flags
+  return true;
+}
+
+bool testChipId(Bench& bench) {
+  auto chip_id = bench.driver.GetChipId();
+  CHECK(chip_id);
+  CHECK(*chip_id == DeviceMockComm::CHIP_ID);
+  return true;
+}
+
+bool testIcVersion(Bench& bench) {
+  auto version = bench.driver.GetIcVersion();
+  CHECK(version);
+  CHECK(*version == DeviceMockComm::ICVID_VALUE);
+  return true;
+}
+
+bool testDeviceVerification(Bench& bench) {
+  auto verified = bench.driver.VerifyDevice();
+  CHECK(verified);
+  CHECK(*verified);
+  return true;
+}
+
+//=============================================================================
+// MODE CONTROL TESTS
+//=============================================================================
+
+bool testEnterMissionMode(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  CHECK(bench.driver.EnterMissionMode());
+  CHECK(bench.driver.IsMissionMode());
+  CHECK(bench.comm.MissionMode());
+  return true;
+}
+
+bool testEnterConfigMode(Bench& bench) {
+  CHECK(ensureMissionMode(bench));
+  CHECK(bench.driver.EnterConfigMode());
+  CHECK(bench.driver.IsConfigMode());
+  CHECK(!bench.comm.MissionMode());
+  return true;
+}
+
+bool testModeTransitions(Bench& bench) {
+  for (int i = 0; i < 3; ++i) {
+    CHECK(ensureConfigMode(bench));
+    CHECK(bench.driver.EnterMissionMode());
+    CHECK(bench.driver.IsMissionMode() && bench.comm.MissionMode());
+    CHECK(bench.driver.EnterConfigMode());
+    CHECK(bench.driver.IsConfigMode() && !bench.comm.MissionMode());
+  }
+  return true;
+}
+
+//=============================================================================
+// GLOBAL CONFIGURATION TESTS
+//=============================================================================
+
+bool testCrcControl(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  CHECK(bench.driver.SetCrcEnabled(false));
+  CHECK((bench.comm.Register(CentralReg::GLOBAL_CONFIG) & GLOBAL_CONFIG::CRC_EN) == 0);
+  CHECK(bench.driver.SetCrcEnabled(true));
+  CHECK((bench.comm.Register(CentralReg::GLOBAL_CONFIG) & GLOBAL_CONFIG::CRC_EN) != 0);
+  CHECK(bench.driver.GetIcVersion()); // Traffic with CRC checked on both sides
+  CHECK(bench.comm.CrcErrors() == 0);
+  return true;
+}
+
+bool testCrcIntegrity(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  CHECK(bench.driver.SetCrcEnabled(true));
+  IntegrityConfig adaptive{};
+  adaptive.mode = IntegrityMode::Adaptive;
+  adaptive.qualification_frames = 0; // Telemetry is deferred right away
+  adaptive.batch_frames = 8;
+  CHECK(bench.driver.ConfigureIntegrity(adaptive));
+  CHECK(bench.driver.GetIntegrityStats().qualified);
+
+  // A corrupted telemetry reply is handed out unverified and queued
+  bench.comm.CorruptNextReply();
+  CHECK(bench.driver.GetAverageCurrent(Channel::CH0));
+  CHECK(bench.driver.GetIntegrityStats().pending == 1);
+
+  // Reconfiguring checks the queue first: the failure is reported, the new
+  // configuration still applies
+  auto reconfigured = bench.driver.ConfigureIntegrity(IntegrityConfig{});
+  CHECK(!reconfigured && reconfigured.error() == DriverError::CRCError);
+  const auto& stats = bench.driver.GetIntegrityStats();
+  CHECK(stats.batch_failures == 1);
+  CHECK(stats.pending == 0);
+  CHECK(!stats.qualified);
+  CHECK(bench.driver.GetAverageCurrent(Channel::CH0)); // Verified inline again
+  CHECK(bench.driver.GetIntegrityStats().pending == 0);
+  return true;
+}
+
+bool testVbatThresholds(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  CHECK(bench.driver.SetVbatThresholds(5.0F, 35.0F));
+  CHECK(bench.driver.SetVbatThresholdsRaw(30, 200));
+  CHECK(bench.comm.Register(CentralReg::VBAT_TH) == ((200U << 8) | 30U));
+  CHECK(bench.driver.SetVbatThresholds(7.0F, 40.0F));
+  CHECK(bench.driver.ClearFaults());
+  return true;
+}
+
+bool testGlobalConfiguration(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  GlobalConfig config{};
+  config.crc_enabled = true;
+  config.spi_watchdog_enabled = false;
+  config.clock_watchdog_enabled = true;
+  config.vio_5v = false;
+  config.vbat_uv_voltage = 6.0F;
+  config.vbat_ov_voltage = 38.0F;
+  config.spi_watchdog_reload = 2000;
+  CHECK(bench.driver.ConfigureGlobal(config));
+  const uint16_t global = bench.comm.Register(CentralReg::GLOBAL_CONFIG);
+  CHECK((global & GLOBAL_CONFIG::CRC_EN) != 0);
+  CHECK((global & GLOBAL_CONFIG::CLK_WD_EN) != 0);
+  CHECK((global & (GLOBAL_CONFIG::SPI_WD_EN | GLOBAL_CONFIG::VIO_SEL)) == 0);
+
+  config.vbat_uv_voltage = 7.0F;
+  config.vbat_ov_voltage = 40.0F;
+  config.spi_watchdog_reload = 1000;
+  CHECK(bench.driver.ConfigureGlobal(config));
+  CHECK(bench.comm.CrcErrors() == 0);
+  return true;
+}
+
+/**
+ * @brief One-variant configuration bundle image holding the given writes
+ */
+template <std::size_t N>
+std::array<uint32_t, (sizeof(ConfigBundleHeader) + sizeof(ConfigBundleVariant)) / 4 + N + 1>
+makeBundle(uint32_t variant_id, const std::array<RegisterWrite, N>& writes) {
+  std::array<uint32_t, (sizeof(ConfigBundleHeader) + sizeof(ConfigBundleVariant)) / 4 + N + 1>
+      image{};
+  ConfigBundleHeader header{};
+  header.variant_count = 1;
+  header.total_size = sizeof(image);
+  ConfigBundleVariant variant{};
+  variant.id = variant_id;
+  std::memcpy(variant.name, "test", 4);
+  variant.frame_offset = sizeof(ConfigBundleHeader) + sizeof(ConfigBundleVariant);
+  variant.frame_count = N + 1;
+  std::size_t word = variant.frame_offset / 4;
+  for (const auto& write : writes) {
+    SPIFrame frame = SPIFrame::MakeWrite(write.address, write.value);
+    frame.tx_fields.crc = CalculateFrameCrc(frame);
+    image[word++] = frame.word;
+  }
+  image[word] = ConfigBundleView::NopFrame();
+  std::memcpy(image.data(), &header, sizeof(header));
+  std::memcpy(reinterpret_cast<uint8_t*>(image.data()) + sizeof(header), &variant, sizeof(variant));
+  const auto bytes = std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(image.data()),
+                                              sizeof(image));
+  header.crc = ConfigBundleView::ComputeCrc(bytes);
+  std::memcpy(image.data(), &header, sizeof(header));
+  return image;
+}
+
+bool testConfigBundle(Bench& bench) {
+  const uint16_t setpoint0 = GetChannelRegister(Channel::CH0, ChannelReg::SETPOINT);
+  const uint16_t setpoint1 = GetChannelRegister(Channel::CH1, ChannelReg::SETPOINT);
+  const uint16_t config0 = GetChannelRegister(Channel::CH0, ChannelReg::CH_CONFIG);
+  const auto image = makeBundle<2>(0x42, {RegisterWrite{setpoint0, 0x1234},
+                                          RegisterWrite{setpoint1, 0x0567}});
+  const ConfigBundleView bundle(std::span<const uint8_t>(
+      reinterpret_cast<const uint8_t*>(image.data()), sizeof(image)));
+  CHECK(bundle.IsValid());
+
+  // Without pending defaults the variant's frames are sent as they are: N writes + 1
+  CHECK(bench.driver.Init());
+  const uint16_t default_config = bench.comm.Register(config0);
+  std::size_t frames = bench.comm.Frames();
+  CHECK(bench.driver.ApplyConfigBundle(bundle, 0x42));
+  CHECK(bench.comm.Frames() - frames == 3);
+  CHECK(bench.comm.Register(setpoint0) == 0x1234 && bench.comm.Register(setpoint1) == 0x0567);
+  CHECK(!bench.driver.ApplyConfigBundle(bundle, 0x43));
+
+  // Lazy defaults of the touched channels go first, in their own burst
+  DeviceMockComm comm;
+  Driver<DeviceMockComm> lazy{comm};
+  lazy.SetLazyChannelInit(true);
+  CHECK(lazy.Init());
+  frames = comm.Frames();
+  CHECK(lazy.ApplyConfigBundle(bundle, 0x42));
+  CHECK(comm.Frames() - frames == 2 * 3 + 1 + 3);
+  CHECK(comm.Register(setpoint0) == 0x1234 && comm.Register(setpoint1) == 0x0567);
+  CHECK(comm.Register(config0) == default_config);
+  return true;
+}
+
+//=============================================================================
+// CHANNEL CONTROL TESTS
+//=============================================================================
+
+bool testSingleChannelControl(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  CHECK(bench.driver.EnableChannel(Channel::CH0, true));
+  CHECK(bench.comm.ChannelEnables() == 0x01);
+  CHECK(bench.driver.EnableChannel(Channel::CH0, false));
+  CHECK(bench.comm.ChannelEnables() == 0x00);
+  return true;
+}
+
+bool testAllChannelsControl(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  CHECK(bench.driver.EnableAllChannels());
+  CHECK(bench.comm.ChannelEnables() == CH_CTRL::ALL_CH_MASK);
+  CHECK(bench.driver.DisableAllChannels());
+  CHECK(bench.comm.ChannelEnables() == 0x00);
+  return true;
+}
+
+bool testChannelMaskControl(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  const uint8_t mask = (1U << 0) | (1U << 2) | (1U << 4);
+  CHECK(bench.driver.EnableChannels(mask));
+  CHECK(bench.comm.ChannelEnables() == mask);
+  CHECK(bench.driver.EnableChannels(0));
+  CHECK(bench.comm.ChannelEnables() == 0x00);
+  return true;
+}
+
+bool testChannelModeConfiguration(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  constexpr ChannelMode MODES[] = {ChannelMode::OFF,
+                                   ChannelMode::ICC,
+                                   ChannelMode::DIRECT_DRIVE_SPI,
+                                   ChannelMode::DIRECT_DRIVE_DRV0,
+                                   ChannelMode::DIRECT_DRIVE_DRV1,
+                                   ChannelMode::FREE_RUN_MEAS};
+  const uint16_t mode_register = GetChannelRegister(Channel::CH0, ChannelReg::MODE);
+  for (ChannelMode mode : MODES) {
+    CHECK(bench.driver.SetChannelMode(Channel::CH0, mode));
+    CHECK(bench.comm.Register(mode_register) == static_cast<uint16_t>(mode));
+  }
+  CHECK(bench.driver.SetChannelMode(Channel::CH0, ChannelMode::ICC));
+  return true;
+}
+
+bool testLazyChannelDefaults(Bench& bench) {
+  // Reference: the registers of an eagerly initialized device
+  DeviceMockComm eager_comm;
+  Driver<DeviceMockComm> eager{eager_comm};
+  CHECK(eager.Init());
+  const uint16_t config1 = GetChannelRegister(Channel::CH1, ChannelReg::CH_CONFIG);
+  const uint16_t setpoint1 = GetChannelRegister(Channel::CH1, ChannelReg::SETPOINT);
+  const uint16_t mode1 = GetChannelRegister(Channel::CH1, ChannelReg::MODE);
+
+  bench.driver.SetLazyChannelInit(true);
+  CHECK(bench.driver.Init());
+
+  // ConfigureChannel covers all three lazy defaults of its channel in one burst
+  std::size_t frames = bench.comm.Frames();
+  CHECK(bench.driver.ConfigureChannel(Channel::CH0, ChannelConfig{}));
+  CHECK(bench.comm.Frames() - frames == 10);
+
+  // In Mission Mode, SETPOINT and CH_CONFIG defaults go out with the first write;
+  // MODE waits for Config Mode, so the channel cannot be enabled yet
+  CHECK(ensureOutputsLive(bench));
+  CHECK(bench.driver.SetCurrentSetpoint(Channel::CH1, 700));
+  const uint16_t user_setpoint = bench.comm.Register(setpoint1);
+  CHECK(bench.comm.Register(config1) == eager_comm.Register(config1));
+  CHECK(bench.comm.Register(mode1) != eager_comm.Register(mode1));
+  auto enabled = bench.driver.EnableChannel(Channel::CH1, true);
+  CHECK(!enabled && enabled.error() == DriverError::WrongMode);
+
+  // The MODE default follows in Config Mode without resetting the user's setpoint
+  CHECK(ensureConfigMode(bench));
+  CHECK(bench.driver.SetChannelMode(Channel::CH1, ChannelMode::ICC));
+  CHECK(ensureOutputsLive(bench));
+  CHECK(bench.driver.EnableChannel(Channel::CH1, true));
+  CHECK(bench.comm.ChannelEnables() == (1U << 1));
+  CHECK(bench.comm.Register(setpoint1) == user_setpoint);
+  CHECK(bench.driver.EnableChannel(Channel::CH1, false));
+  return true;
+}
+
+//=============================================================================
+// CURRENT CONTROL TESTS
+//=============================================================================
+
+bool testCurrentSetpoint(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  CHECK(bench.driver.EnableChannel(Channel::CH0, true));
+  for (uint16_t current : {100, 500, 1000, 1500}) { // MAX_TARGET caps at 1500 mA
+    CHECK(bench.driver.SetCurrentSetpoint(Channel::CH0, current));
+    auto setpoint = bench.driver.GetCurrentSetpoint(Channel::CH0);
+    CHECK(setpoint && near(*setpoint, current, 1));
+    auto average = bench.driver.GetAverageCurrent(Channel::CH0);
+    CHECK(average && near(*average, current, 1));
+  }
+  CHECK(bench.driver.EnableChannel(Channel::CH0, false));
+  return true;
+}
+
+bool testCurrentRamping(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  CHECK(bench.driver.EnableChannel(Channel::CH0, true));
+  for (uint16_t current = 0; current <= 1000; current += 100) {
+    CHECK(bench.driver.SetCurrentSetpoint(Channel::CH0, current));
+  }
+  for (int current = 1000; current >= 0; current -= 100) {
+    CHECK(bench.driver.SetCurrentSetpoint(Channel::CH0, static_cast<uint16_t>(current)));
+  }
+  CHECK((bench.comm.Register(GetChannelBase(Channel::CH0)) & SETPOINT::TARGET_MASK) == 0);
+  CHECK(bench.driver.EnableChannel(Channel::CH0, false));
+  return true;
+}
+
+bool testPeakAndHold(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  CHECK(bench.driver.ConfigurePeakHold(Channel::CH0, PeakHoldProfile{1500, 3000, 400}));
+  CHECK(bench.driver.ConfigurePeakHold(Channel::CH2, PeakHoldProfile{1200, 3010, 300}));
+  CHECK(!bench.driver.ConfigurePeakHold(Channel::CH1, PeakHoldProfile{300, 1000, 400}));
+  const uint16_t sp0 = GetChannelRegister(Channel::CH0, ChannelReg::SETPOINT);
+  const uint16_t sp2 = GetChannelRegister(Channel::CH2, ChannelReg::SETPOINT);
+
+  CHECK(bench.driver.StartPeakHold(0x05));
+  CHECK(bench.comm.ChannelEnables() == 0x05);
+  CHECK(bench.comm.Register(sp0) == SETPOINT::CalculateTarget(1500));
+  auto due_us = bench.driver.GetNextPeakHoldTransitionUs();
+  CHECK(due_us > bench.comm.GetTimeUs());
+  auto switched = bench.driver.ServicePeakHold(); // Not due yet: no bus access
+  CHECK(switched && *switched == 0);
+
+  // Both transitions are within the merge window and share one burst
+  switched = bench.driver.ServicePeakHold(5000);
+  CHECK(switched && *switched == 0x05);
+  CHECK(bench.comm.Register(sp0) == SETPOINT::CalculateTarget(400));
+  CHECK(bench.comm.Register(sp2) == SETPOINT::CalculateTarget(300));
+  const PeakHoldStats& stats = bench.driver.GetPeakHoldStats();
+  CHECK(stats.bursts == 1 && stats.transitions == 2 && stats.max_late_us == 0);
+  CHECK(bench.driver.GetNextPeakHoldTransitionUs() == 0);
+
+  // A setpoint write supersedes a pending transition
+  CHECK(bench.driver.StartPeakHold(0x01));
+  CHECK(bench.driver.SetCurrentSetpoint(Channel::CH0, 700));
+  switched = bench.driver.ServicePeakHold(10000);
+  CHECK(switched && *switched == 0);
+  CHECK(bench.comm.Register(sp0) == SETPOINT::CalculateTarget(700));
+  return true;
+}
+
+bool testPeakHoldCancellation(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  CHECK(bench.driver.ConfigurePeakHold(Channel::CH0, PeakHoldProfile{1500, 3000, 400}));
+  CHECK(bench.driver.ConfigurePeakHold(Channel::CH2, PeakHoldProfile{1200, 3010, 300}));
+  const uint16_t sp0 = GetChannelRegister(Channel::CH0, ChannelReg::SETPOINT);
+
+  // A raw SETPOINT write supersedes the pending transition like SetCurrentSetpoint()
+  CHECK(bench.driver.StartPeakHold(0x01));
+  const auto target = static_cast<uint16_t>(SETPOINT::CalculateTarget(700));
+  CHECK(bench.driver.WriteRegister(sp0, target));
+  auto switched = bench.driver.ServicePeakHold(10000);
+  CHECK(switched && *switched == 0);
+  CHECK(bench.comm.Register(sp0) == target);
+
+  // Disabling the channel cancels it
+  CHECK(bench.driver.StartPeakHold(0x01));
+  CHECK(bench.driver.EnableChannel(Channel::CH0, false));
+  CHECK(bench.driver.GetActivePeakHoldMask() == 0);
+  switched = bench.driver.ServicePeakHold(10000);
+  CHECK(switched && *switched == 0);
+
+  // So does Config Mode, for every channel
+  CHECK(bench.driver.StartPeakHold(0x05));
+  CHECK(bench.driver.EnterConfigMode());
+  CHECK(bench.driver.GetActivePeakHoldMask() == 0);
+  CHECK(bench.driver.GetNextPeakHoldTransitionUs() == 0);
+
+  // A parallel change drops the profiles it rescales, and only those
+  CHECK(bench.driver.SetParallelOperation(ParallelPair::CH0_CH3, true));
+  auto started = bench.driver.StartPeakHold(0x01, false);
+  CHECK(!started && started.error() == DriverError::InvalidParameter);
+  CHECK(bench.driver.StartPeakHold(0x04, false));
+  return true;
+}
+
+//=============================================================================
+// PWM CONFIGURATION TESTS
+//=============================================================================
+
+bool testPwmPeriodConfiguration(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  const uint16_t period_register = GetChannelRegister(Channel::CH0, ChannelReg::PERIOD);
+  uint16_t previous = bench.comm.Register(period_register);
+  for (float period_us : {10.0F, 50.0F, 100.0F, 500.0F, 1000.0F, 5000.0F}) {
+    CHECK(bench.driver.ConfigurePwmPeriod(Channel::CH0, period_us));
+    const uint16_t value = bench.comm.Register(period_register);
+    CHECK(value != previous); // Every period maps to a different encoding
+    previous = value;
+  }
+  return true;
+}
+
+bool testPwmPeriodRaw(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  struct RawPeriod {
+    uint8_t mantissa;
+    uint8_t exponent;
+    bool low_freq;
+  };
+  constexpr RawPeriod CONFIGS[] = {{100, 0, false}, {50, 1, false}, {25, 2, false}, {100, 0, true}};
+  const uint16_t period_register = GetChannelRegister(Channel::CH0, ChannelReg::PERIOD);
+  for (const auto& config : CONFIGS) {
+    CHECK(bench.driver.ConfigurePwmPeriodRaw(Channel::CH0, config.mantissa, config.exponent,
+                                             config.low_freq));
+    const auto expected =
+        static_cast<uint16_t>(config.mantissa | (config.exponent << PERIOD::EXP_SHIFT) |
+                              (config.low_freq ? PERIOD::LOW_FREQ_BIT : 0));
+    CHECK(bench.comm.Register(period_register) == expected);
+  }
+  return true;
+}
+
+//=============================================================================
+// DITHER CONFIGURATION TESTS
+//=============================================================================
+
+bool testDitherConfiguration(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  const uint16_t base = GetChannelBase(Channel::CH0);
+  struct DitherRequest {
+    float amplitude_ma;
+    float frequency_hz;
+  };
+  constexpr DitherRequest REQUESTS[] = {{10.0F, 100.0F}, {50.0F, 500.0F}, {100.0F, 1000.0F}};
+  for (const auto& request : REQUESTS) {
+    CHECK(bench.driver.ConfigureDither(Channel::CH0, request.amplitude_ma, request.frequency_hz));
+    CHECK((bench.comm.Register(base + ChannelReg::DITHER_CTRL) & DITHER_CTRL::STEP_SIZE_MASK) !=
+          0);
+    CHECK(bench.comm.Register(base + ChannelReg::DITHER_STEP) != 0);
+  }
+  return true;
+}
+
+bool testDitherRaw(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  const uint16_t base = GetChannelBase(Channel::CH0);
+  struct RawDither {
+    uint16_t step_size;
+    uint8_t num_steps;
+    uint8_t flat_steps;
+  };
+  constexpr RawDither CONFIGS[] = {{100, 10, 2}, {500, 20, 5}, {1000, 30, 10}};
+  for (const auto& config : CONFIGS) {
+    CHECK(bench.driver.ConfigureDitherRaw(Channel::CH0, config.step_size, config.num_steps,
+                                          config.flat_steps));
+    CHECK(bench.comm.Register(base + ChannelReg::DITHER_CTRL) == config.step_size);
+    CHECK(bench.comm.Register(base + ChannelReg::DITHER_STEP) ==
+          ((config.num_steps << DITHER_STEP::STEPS_SHIFT) | config.flat_steps));
+  }
+  return true;
+}
+
+//=============================================================================
+// DIAGNOSTICS & MONITORING TESTS
+//=============================================================================
+
+bool testDeviceStatus(Bench& bench) {
+  auto status = bench.driver.GetDeviceStatus();
+  CHECK(status);
+  CHECK(!status->any_fault);
+  CHECK(status->init_done);
+  CHECK(status->config_mode);
+  CHECK(near(status->vio_voltage, 3300, 10));
+  CHECK(near(status->vbat_voltage, 12000, 50));
+  return true;
+}
+
+bool testChannelDiagnostics(Bench& bench) {
+  bench.comm.InjectChannelFault(0, 1U << 2); // OL
+  auto diag = bench.driver.GetChannelDiagnostics(Channel::CH0);
+  CHECK(diag);
+  CHECK(diag->open_load);
+  CHECK(!diag->overcurrent && !diag->short_to_ground && !diag->over_temperature);
+  CHECK(diag->average_current == 0 && diag->duty_cycle == 0);
+  return true;
+}
+
+bool testVoltageReading(Bench& bench) {
+  auto vbat = bench.driver.GetVbatVoltage();
+  CHECK(vbat && near(*vbat, 12000, 50));
+  auto vio = bench.driver.GetVioVoltage();
+  CHECK(vio && near(*vio, 3300, 10));
+  return true;
+}
+
+bool testCurrentReading(Bench& bench) {
+  // Channel off: no current, no duty cycle
+  auto current = bench.driver.GetAverageCurrent(Channel::CH0);
+  CHECK(current && *current == 0);
+  auto duty = bench.driver.GetDutyCycle(Channel::CH0);
+  CHECK(duty && *duty == 0);
+  return true;
+}
+
+bool testAllChannelsTelemetry(Bench& bench) {
+  for (Channel channel : ALL_CHANNELS) {
+    CHECK(bench.driver.GetCurrentSetpoint(channel, false));
+    CHECK(bench.driver.GetAverageCurrent(channel, false));
+    CHECK(bench.driver.GetDutyCycle(channel));
+    auto diag = bench.driver.GetChannelDiagnostics(channel);
+    CHECK(diag);
+    CHECK(!diag->overcurrent && !diag->short_to_ground && !diag->open_load);
+  }
+  return true;
+}
+
+bool testDeviceTelemetry(Bench& bench) {
+  auto status = bench.driver.GetDeviceStatus();
+  CHECK(status && !status->any_fault);
+  CHECK(bench.driver.GetVbatVoltage());
+  CHECK(bench.driver.GetVioVoltage());
+  auto fault = bench.driver.IsFault(true);
+  CHECK(fault && !*fault);
+  return true;
+}
+
+bool testTelemetryWithActiveChannel(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  constexpr uint16_t TEST_CURRENT = 500;
+  CHECK(bench.driver.SetCurrentSetpoint(Channel::CH0, TEST_CURRENT));
+  CHECK(bench.driver.EnableChannel(Channel::CH0, true));
+
+  auto setpoint = bench.driver.GetCurrentSetpoint(Channel::CH0, false);
+  CHECK(setpoint && near(*setpoint, TEST_CURRENT, 1));
+  auto current = bench.driver.GetAverageCurrent(Channel::CH0, false);
+  CHECK(current && near(*current, TEST_CURRENT, 1));
+  auto duty = bench.driver.GetDutyCycle(Channel::CH0);
+  CHECK(duty && *duty != 0);
+  auto diag = bench.driver.GetChannelDiagnostics(Channel::CH0);
+  CHECK(diag && diag->average_current != 0 && diag->vbat_feedback != 0);
+  CHECK(!diag->overcurrent && !diag->short_to_ground && !diag->open_load);
+
+  CHECK(bench.driver.EnableChannel(Channel::CH0, false));
+  return true;
+}
+
+bool testChannelViews(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  CHECK(bench.driver.SetCurrentSetpoint(Channel::CH0, 500));
+  CHECK(bench.driver.SetCurrentSetpoint(Channel::CH2, 1000));
+  CHECK(bench.driver.EnableChannels((1U << 0) | (1U << 2)));
+
+  // One sweep for the N selected channels: N reads + 1 frame, fetched once per view
+  std::size_t frames = bench.comm.Frames();
+  auto enabled = bench.driver.Channels() | views::OnlyEnabled() |
+                 views::WithFeedback(ChannelField::AverageCurrent);
+  uint32_t total_ma = 0;
+  uint8_t count = 0;
+  for (const ChannelSample& sample : enabled) {
+    total_ma += sample.average_current_ma;
+    ++count;
+  }
+  CHECK(count == 2 && near(total_ma, 1500, 2));
+  CHECK(bench.comm.Frames() == frames + 3);
+  CHECK(std::ranges::distance(enabled) == 2);
+  CHECK(bench.comm.Frames() == frames + 3);
+
+  // Filters merge: the sweep reads the union of their fields, a sample must pass both
+  bench.comm.InjectChannelFault(0, 1U << 2); // OL on CH0 (500 mA)
+  bench.comm.InjectChannelFault(2, 1U << 2); // OL on CH2 (1000 mA)
+  frames = bench.comm.Frames();
+  auto above_600ma = [](const ChannelSample& sample) { return sample.average_current_ma > 600; };
+  auto faulted_high = bench.driver.Channels() |
+                      views::Where(ChannelField::AverageCurrent, above_600ma) |
+                      views::OnlyFaulted();
+  CHECK(faulted_high.Fields() == (ChannelField::AverageCurrent | ChannelField::Errors));
+  CHECK(std::ranges::distance(faulted_high) == 1);
+  CHECK(faulted_high.begin()->channel == Channel::CH2);
+  CHECK(bench.comm.Frames() == frames + (6 * 2) + 1);
+
+  // A failed sweep yields an empty range and is reported by Status()
+  bench.comm.FailTransfers(true);
+  auto failing = bench.driver.Channels() | views::WithFeedback(ChannelField::DutyCycle);
+  CHECK(failing.Status());
+  CHECK(failing.begin() == failing.end());
+  CHECK(!failing.Status());
+  bench.comm.FailTransfers(false);
+  CHECK(failing.Refresh());
+  CHECK(failing.Status() && std::ranges::distance(failing) == 6);
+
+  CHECK(bench.driver.EnableChannels(0));
+  return true;
+}
+
+bool testThermalDerating(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  ThermalModelParams params{};
+  params.die_rth_dk_per_w = 60'000; // The die limit is reached long before the coil limit
+  bench.driver.SetThermalModel(Channel::CH0, params);
+  CHECK(bench.driver.SetCurrentSetpoint(Channel::CH0, 1000));
+  CHECK(bench.driver.EnableChannel(Channel::CH0, true));
+
+  // VBAT (FB_VOLTAGE2) and FB_I_AVG in one burst
+  const std::size_t frames = bench.comm.Frames();
+  CHECK(bench.driver.UpdateThermalEstimate(100'000'000));
+  CHECK(bench.comm.Frames() == frames + 3);
+  auto estimate = bench.driver.GetThermalEstimate(Channel::CH0);
+  // 1 A through 5 Ω at 12 V: D ≈ 0.42, P_die ≈ 1 A² · 0.2 Ω · 0.42
+  CHECK(estimate && estimate->die_power_mw >= 80 && estimate->die_power_mw <= 90);
+
+  // Derating triggered by the die rise caps at the die-limited current (≈ 490 mA)
+  bench.driver.SetThermalDerating(true);
+  CHECK(bench.driver.SetCurrentSetpoint(Channel::CH0, 1000));
+  auto setpoint = bench.driver.GetCurrentSetpoint(Channel::CH0, false);
+  CHECK(setpoint && *setpoint >= 450 && *setpoint <= 520);
+  bench.driver.SetThermalDerating(false);
+  CHECK(bench.driver.EnableChannel(Channel::CH0, false));
+  return true;
+}
+
+//=============================================================================
+// FAULT MANAGEMENT TESTS
+//=============================================================================
+
+bool testFaultReporting(Bench& bench) {
+  bench.comm.InjectGlobalFault(GLOBAL_DIAG0::VBAT_UV);
+  bench.comm.InjectChannelFault(2, 1U << 1); // SG
+  auto faults = bench.driver.GetAllFaults();
+  CHECK(faults);
+  CHECK(faults->any_fault);
+  CHECK(faults->vbat_uv);
+  CHECK(faults->channels[2].short_to_ground);
+  CHECK(!faults->channels[0].has_fault);
+  CHECK(bench.driver.PrintAllFaults());
+  return true;
+}
+
+bool testFaultClearing(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  bench.comm.InjectGlobalFault(GLOBAL_DIAG0::VBAT_OV | GLOBAL_DIAG0::COTWARN);
+  CHECK(bench.comm.FaultPending());
+  CHECK(bench.driver.SetVbatThresholds(7.0F, 40.0F));
+  CHECK(bench.driver.ClearFaults());
+  auto has_fault = bench.driver.HasAnyFault();
+  CHECK(has_fault && !*has_fault);
+  CHECK(!bench.comm.FaultPending());
+  return true;
+}
+
+bool testSoftwareReset(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  CHECK(bench.driver.EnableChannels(0x03));
+  CHECK(bench.driver.SoftwareReset());
+  CHECK(bench.driver.IsConfigMode());
+  CHECK(!bench.comm.MissionMode());
+  auto status = bench.driver.GetDeviceStatus();
+  CHECK(status && status->config_mode);
+  return true;
+}
+
+bool testHarnessScan(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  const uint16_t config2 = GetChannelRegister(Channel::CH2, ChannelReg::CH_CONFIG);
+  const uint16_t previous = bench.comm.Register(config2);
+
+  // A flag latched before the scan is cleared in step 2, not reported as wiring fault
+  bench.comm.InjectChannelFault(2, 1U << 2); // OL
+  for (int scan_run = 0; scan_run < 2; ++scan_run) {
+    auto scan = bench.driver.ScanHarness();
+    CHECK(scan);
+    CHECK(scan->scanned_mask == 0x3F && scan->fault_mask == 0);
+    CHECK(scan->verdicts[2] == WiringVerdict::Ok);
+    CHECK(bench.comm.Register(config2) == previous);
+  }
+  CHECK(!bench.comm.FaultPending());
+
+  // A failed settle wait still restores CH_CONFIG
+  bench.comm.FailDelays(true);
+  CHECK(!bench.driver.ScanHarness(HarnessScanConfig{.channel_mask = 0x04}));
+  bench.comm.FailDelays(false);
+  CHECK(bench.comm.Register(config2) == previous);
+  return true;
+}
+
+//=============================================================================
+// WATCHDOG TESTS
+//=============================================================================
+
+bool testSpiWatchdog(Bench& bench) {
+  for (uint16_t reload : {500, 1000, 2000, 5000}) {
+    CHECK(bench.driver.ReloadSpiWatchdog(reload));
+    CHECK(bench.comm.Register(CentralReg::WD_RELOAD) == WD_RELOAD::MaskValue(reload));
+  }
+  return true;
+}
+
+//=============================================================================
+// GPIO CONTROL TESTS
+//=============================================================================
+
+bool testGpioControl(Bench& bench) {
+  auto fault = bench.driver.IsFault(true);
+  CHECK(fault && !*fault);
+  CHECK(bench.driver.Enable());
+  CHECK(bench.comm.Enabled());
+  CHECK(bench.driver.Disable());
+  CHECK(!bench.comm.Enabled());
+  CHECK(bench.driver.HoldReset());
+  CHECK(bench.comm.InReset());
+  CHECK(bench.driver.ReleaseReset());
+  CHECK(!bench.comm.InReset());
+  // The reset is latched as a reset event and signalled on FAULTN
+  fault = bench.driver.IsFault(false);
+  CHECK(fault && *fault);
+  return true;
+}
+
+//=============================================================================
+// MULTI-CHANNEL TESTS
+//=============================================================================
+
+bool testAllChannelsIndividually(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  for (Channel channel : ALL_CHANNELS) {
+    const auto bit = static_cast<uint8_t>(1U << ToIndex(channel));
+    CHECK(bench.driver.EnableChannel(channel, true));
+    CHECK(bench.comm.ChannelEnables() == bit);
+    CHECK(bench.driver.SetCurrentSetpoint(channel, 500));
+    auto current = bench.driver.GetAverageCurrent(channel);
+    CHECK(current && near(*current, 500, 1));
+    CHECK(bench.driver.EnableChannel(channel, false));
+    CHECK(bench.comm.ChannelEnables() == 0);
+  }
+  return true;
+}
+
+bool testSynchronizedActivation(Bench& bench) {
+  CHECK(ensureOutputsLive(bench));
+  DeviceMockComm comm;
+  Driver<DeviceMockComm> second{comm};
+  CHECK(second.Init());
+  CHECK(second.EnterMissionMode());
+  CHECK(second.Enable());
+  comm.FailTransfers(true); // The second device drops off the bus
+
+  std::array<Driver<DeviceMockComm>*, 2> devices{&bench.driver, &second};
+  std::array<SyncActivation, 2> activations{};
+  activations[0].channel_mask = 0x01;
+  activations[0].setpoint_mask = 0x01;
+  activations[0].current_ma[0] = 500;
+  activations[1].channel_mask = 0x02;
+
+  // FrameBurst: the first device switches and reports, the second one fails
+  auto report = Driver<DeviceMockComm>::ActivateSynchronized(devices, activations,
+                                                             SyncRelease::FrameBurst);
+  CHECK(report);
+  CHECK(report->switched_mask == 0x01);
+  CHECK(report->error == DriverError::HardwareError);
+  CHECK(bench.comm.ChannelEnables() == 0x01);
+  CHECK(comm.ChannelEnables() == 0);
+  CHECK(bench.driver.EnableChannel(Channel::CH1, true)); // Built from the updated cache
+  CHECK(bench.comm.ChannelEnables() == 0x03);
+
+  // SharedEnable would gate the running outputs
+  auto refused = Driver<DeviceMockComm>::ActivateSynchronized(devices, activations,
+                                                              SyncRelease::SharedEnable);
+  CHECK(!refused && refused.error() == DriverError::Busy);
+  CHECK(bench.comm.Enabled());
+
+  // A staging failure still drives EN high again and releases the staged device
+  CHECK(bench.driver.EnableChannels(0));
+  report = Driver<DeviceMockComm>::ActivateSynchronized(devices, activations,
+                                                        SyncRelease::SharedEnable);
+  CHECK(report);
+  CHECK(report->switched_mask == 0x01 && report->error != DriverError::None);
+  CHECK(bench.comm.Enabled());
+  CHECK(bench.comm.ChannelEnables() == 0x01);
+  return true;
+}
+
+//=============================================================================
+// PARALLEL OPERATION TESTS
+//=============================================================================
+
+bool testParallelOperation(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  struct PairBit {
+    ParallelPair pair;
+    uint16_t bit;
+  };
+  constexpr PairBit PAIRS[] = {{ParallelPair::CH0_CH3, CH_CTRL::CH_PAR_0_3},
+                               {ParallelPair::CH1_CH2, CH_CTRL::CH_PAR_1_2},
+                               {ParallelPair::CH4_CH5, CH_CTRL::CH_PAR_4_5}};
+  for (const auto& entry : PAIRS) {
+    CHECK(bench.driver.SetParallelOperation(entry.pair, true));
+    CHECK((bench.comm.Register(CentralReg::CH_CTRL) & CH_CTRL::ALL_PAR_MASK) == entry.bit);
+    CHECK(bench.driver.SetParallelOperation(entry.pair, false));
+    CHECK((bench.comm.Register(CentralReg::CH_CTRL) & CH_CTRL::ALL_PAR_MASK) == 0);
+  }
+  return true;
+}
+
+//=============================================================================
+// RECORD LOG TESTS
+//=============================================================================
+
+/**
+ * @brief RecordLog backend in RAM, with slot corruption for recovery tests
+ */
+class RamLogBackend {
+public:
+  static constexpr uint32_t CAPACITY = 16;
+
+  [[nodiscard]] uint32_t Capacity() const noexcept {
+    return CAPACITY;
+  }
+  [[nodiscard]] bool ReadHeader(LogHeader& header) const noexcept {
+    header = header_;
+    return true;
+  }
+  [[nodiscard]] bool ReadRecord(uint32_t slot, LogRecord& record) const noexcept {
+    if (slot >= CAPACITY) {
+      return false;
+    }
+    record = slots_[slot];
+    return true;
+  }
+  [[nodiscard]] bool Format(const LogHeader& header) noexcept {
+    header_ = header;
+    std::memset(static_cast<void*>(slots_.data()), 0xFF, sizeof(slots_)); // Erased
+    return true;
+  }
+  [[nodiscard]] bool WriteRecord(uint32_t slot, const LogRecord& record) noexcept {
+    if (slot >= CAPACITY) {
+      return false;
+    }
+    slots_[slot] = record;
+    return true;
+  }
+  [[nodiscard]] bool Invalidate(uint32_t slot) noexcept {
+    if (slot >= CAPACITY) {
+      return false;
+    }
+    slots_[slot] = LogRecord{};
+    return true;
+  }
+
+  /// Flip a payload bit, as a torn or decayed write would
+  void Corrupt(uint32_t slot) noexcept {
+    slots_[slot].payload[0] ^= 0x01;
+  }
+
+private:
+  LogHeader header_{};
+  std::array<LogRecord, CAPACITY> slots_{};
+};
+
+bool testLogRecovery(Bench& /*bench*/) {
+  RamLogBackend backend;
+  RecordLog<RamLogBackend, 4> log(backend);
+  LogRecovery recovery{};
+  CHECK(log.Open(&recovery) && recovery.formatted);
+  for (uint64_t i = 1; i <= 6; ++i) {
+    LogRecord record{};
+    record.timestamp_us = 100 * i;
+    CHECK(log.Append(record));
+  }
+
+  // A corrupted slot in the middle costs that record only
+  backend.Corrupt(2);
+  RecordLog<RamLogBackend, 4> reopened(backend);
+  CHECK(reopened.Open(&recovery));
+  CHECK(!recovery.formatted && recovery.records == 5 && recovery.skipped == 1);
+  CHECK(reopened.Count() == 5 && reopened.SlotsUsed() == 6);
+  uint32_t iterated = 0;
+  LogRecord record{};
+  for (LogCursor cursor = reopened.Begin(); reopened.Next(cursor, record);) {
+    CHECK(record.timestamp_us != 300);
+    ++iterated;
+  }
+  CHECK(iterated == reopened.Count());
+  LogCursor cursor = reopened.Seek(250);
+  CHECK(reopened.Next(cursor, record) && record.timestamp_us == 400);
+
+  // Appends continue after the highest recovered sequence and survive the next Open()
+  CHECK(reopened.Append(LogRecord{}));
+  CHECK(backend.ReadRecord(6, record) && record.sequence == 6);
+  RecordLog<RamLogBackend, 4> again(backend);
+  CHECK(again.Open(&recovery) && recovery.records == 6 && recovery.skipped == 1);
+  return true;
+}
+
+//=============================================================================
+// ERROR CONDITION TESTS
+//=============================================================================
+
+bool testErrorConditions(Bench& bench) {
+  CHECK(ensureConfigMode(bench));
+  const std::size_t frames = bench.comm.Frames();
+  CHECK(!bench.driver.EnableChannel(Channel::CH0, true));
+  CHECK(bench.comm.Frames() == frames); // Rejected before touching the bus
+  CHECK(bench.comm.ChannelEnables() == 0);
+
+  CHECK(ensureMissionMode(bench));
+  const uint16_t mode_register = GetChannelRegister(Channel::CH0, ChannelReg::MODE);
+  const uint16_t mode = bench.comm.Register(mode_register);
+  CHECK(!bench.driver.SetChannelMode(Channel::CH0, ChannelMode::DIRECT_DRIVE_SPI));
+  CHECK(bench.comm.Register(mode_register) == mode);
+
+  const uint16_t global = bench.comm.Register(CentralReg::GLOBAL_CONFIG);
+  CHECK(!bench.driver.ConfigureGlobal(GlobalConfig{}));
+  CHECK(bench.comm.Register(CentralReg::GLOBAL_CONFIG) == global);
+  return true;
+}
+
+//=============================================================================
+// TEST TABLE
+//=============================================================================
+
+struct TestCase {
+  const char* section;        ///< ESP32 suite section
+  const char* name;           ///< ESP32 suite test name
+  bool (*run)(Bench&);        ///< Test body
+  bool init;                  ///< Run Driver::Init() before the test (not measured)
+  std::size_t max_frames;     ///< SPI frame budget
+  uint32_t max_wall_us;       ///< Host time budget (before scaling)
+};
+
+// clang-format off
+constexpr TestCase TESTS[] = {
+    {"initialization", "hal_initialization", testHalInitialization, false, 0, 50},
+    {"initialization", "driver_initialization", testDriverInitialization, false, 100, 300},
+    {"initialization", "chip_id", testChipId, true, 6, 50},
+    {"initialization", "ic_version", testIcVersion, true, 2, 50},
+    {"initialization", "device_verification", testDeviceVerification, true, 2, 50},
+    {"mode_control", "enter_mission_mode", testEnterMissionMode, true, 2, 50},
+    {"mode_control", "enter_config_mode", testEnterConfigMode, true, 4, 50},
+    {"mode_control", "mode_transitions", testModeTransitions, true, 12, 50},
+    {"global_config", "crc_control", testCrcControl, true, 14, 50},
+    {"global_config", "crc_integrity", testCrcIntegrity, true, 10, 50},
+    {"global_config", "vbat_thresholds", testVbatThresholds, true, 32, 100},
+    {"global_config", "global_configuration", testGlobalConfiguration, true, 24, 100},
+    {"global_config", "config_bundle", testConfigBundle, false, 103, 300},
+    {"channel_control", "single_channel_control", testSingleChannelControl, true, 6, 50},
+    {"channel_control", "all_channels_control", testAllChannelsControl, true, 6, 50},
+    {"channel_control", "channel_mask_control", testChannelMaskControl, true, 6, 50},
+    {"channel_control", "channel_mode_configuration", testChannelModeConfiguration, true, 28, 100},
+    {"channel_control", "lazy_channel_defaults", testLazyChannelDefaults, false, 57, 100},
+    {"current_control", "current_setpoint", testCurrentSetpoint, true, 38, 100},
+    {"current_control", "current_ramping", testCurrentRamping, true, 94, 250},
+    {"current_control", "peak_and_hold", testPeakAndHold, true, 16, 100},
+    {"current_control", "peak_hold_cancellation", testPeakHoldCancellation, true, 24, 100},
+    {"pwm_config", "pwm_period_configuration", testPwmPeriodConfiguration, true, 24, 100},
+    {"pwm_config", "pwm_period_raw", testPwmPeriodRaw, true, 16, 50},
+    {"dither_config", "dither_configuration", testDitherConfiguration, true, 30, 100},
+    {"dither_config", "dither_raw", testDitherRaw, true, 24, 100},
+    {"diagnostics", "device_status", testDeviceStatus, true, 10, 50},
+    {"diagnostics", "channel_diagnostics", testChannelDiagnostics, true, 12, 50},
+    {"diagnostics", "voltage_reading", testVoltageReading, true, 4, 50},
+    {"diagnostics", "current_reading", testCurrentReading, true, 4, 50},
+    {"diagnostics", "all_channels_telemetry", testAllChannelsTelemetry, true, 108, 300},
+    {"diagnostics", "device_telemetry", testDeviceTelemetry, true, 14, 50},
+    {"diagnostics", "telemetry_with_active_channel", testTelemetryWithActiveChannel, true, 28, 100},
+    {"diagnostics", "channel_views", testChannelViews, true, 37, 50},
+    {"diagnostics", "thermal_derating", testThermalDerating, true, 19, 50},
+    {"fault_management", "fault_reporting", testFaultReporting, true, 74, 200},
+    {"fault_management", "fault_clearing", testFaultClearing, true, 30, 100},
+    {"fault_management", "software_reset", testSoftwareReset, true, 16, 50},
+    {"fault_management", "harness_scan", testHarnessScan, true, 100, 50},
+    {"watchdog", "spi_watchdog", testSpiWatchdog, true, 16, 50},
+    {"gpio_control", "gpio_control", testGpioControl, true, 0, 50},
+    {"multi_channel", "all_channels_individually", testAllChannelsIndividually, true, 62, 200},
+    {"multi_channel", "synchronized_activation", testSynchronizedActivation, true, 18, 100},
+    {"parallel_operation", "parallel_operation", testParallelOperation, true, 12, 50},
+    {"record_log", "log_recovery", testLogRecovery, false, 0, 50},
+    {"error_conditions", "error_conditions", testErrorConditions, true, 2, 50},
+};
+// clang-format on
+
+constexpr int RUNS = 3; ///< Runs per test; the fastest one is compared with the budget
+
+struct Outcome {
+  bool passed{true};
+  std::size_t frames{0};
+  double wall_us{0.0};
+};
+
+Outcome runTest(const TestCase& test, bool verbose) {
+  Outcome outcome{};
+  for (int run = 0; run < RUNS; ++run) {
+    auto bench = std::make_unique<Bench>();
+    bench->comm.SetVerbose(verbose);
+    if (test.init && !bench->driver.Init()) {
+      std::fprintf(stderr, "    setup: Init() failed\n");
+      outcome.passed = false;
+      return outcome;
+    }
+    bench->comm.ResetCounters();
+    const auto start = std::chrono::steady_clock::now();
+    const bool passed = test.run(*bench);
+    const auto stop = std::chrono::steady_clock::now();
+    if (!passed) {
+      outcome.passed = false;
+      return outcome;
+    }
+    const double wall_us = std::chrono::duration<double, std::micro>(stop - start).count();
+    outcome.wall_us = run == 0 ? wall_us : std::min(outcome.wall_us, wall_us);
+    outcome.frames = bench->comm.Frames(); // Deterministic: the same on every run
+  }
+  return outcome;
+}
+
+bool selected(const TestCase& test, int argc, char** argv, int first) {
+  if (first >= argc) {
+    return true;
+  }
+  for (int i = first; i < argc; ++i) {
+    if (std::strcmp(argv[i], test.name) == 0 || std::strcmp(argv[i], test.section) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  bool verbose = false;
+  int first = 1;
+  for (; first < argc && argv[first][0] == '-'; ++first) {
+    if (std::strcmp(argv[first], "-v") == 0) {
+      verbose = true;
+    } else if (std::strcmp(argv[first], "--list") == 0) {
+      for (const auto& test : TESTS) {
+        std::printf("%s %s\n", test.section, test.name);
+      }
+      return 0;
+    } else {
+      std::fprintf(stderr, "usage: %s [-v] [--list] [test_or_section...]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  double scale = 1.0;
+  if (const char* env = std::getenv("TLE92466ED_WALL_BUDGET_SCALE"); env != nullptr) {
+    scale = std::max(std::atof(env), 0.0);
+  }
+
+  int run = 0;
+  int failed = 0;
+  std::printf("%-32s %15s %21s\n", "test", "frames/budget", "wall us/budget");
+  for (const auto& test : TESTS) {
+    if (!selected(test, argc, argv, first)) {
+      continue;
+    }
+    ++run;
+    const Outcome outcome = runTest(test, verbose);
+    const double wall_budget = test.max_wall_us * scale;
+    const bool frames_ok = outcome.frames <= test.max_frames;
+    const bool wall_ok = scale == 0.0 || outcome.wall_us <= wall_budget;
+    const bool passed = outcome.passed && frames_ok && wall_ok;
+    failed += passed ? 0 : 1;
+    std::printf("%-32s %7zu/%-7zu %10.1f/%-10.0f %s%s%s\n", test.name, outcome.frames,
+                test.max_frames, outcome.wall_us, wall_budget, passed ? "PASS" : "FAIL",
+                outcome.passed && !frames_ok ? " (frames)" : "",
+                outcome.passed && !wall_ok ? " (time)" : "");
+  }
+  if (run == 0) {
+    std::fprintf(stderr, "no test matches\n");
+    return 1;
+  }
+  std::printf("%d/%d passed\n", run - failed, run);
+  return failed == 0 ? 0 : 1;
+}
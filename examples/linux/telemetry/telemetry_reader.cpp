@@ -0,0 +1,61 @@
+/**
+ * @file telemetry_reader.cpp
+ * @brief Reads TLE92466ED telemetry from POSIX shared memory
+ *
+ * @details
+ * Attaches read-only to the segment of a publisher and prints each new sample.
+ * Reads are plain loads from the mapping; any number of readers can run
+ * without affecting the bus owner.
+ *
+ * Usage: tle92466ed_telemetry_reader [segment] [count]
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "posix_shared_telemetry.hpp"
+
+using tle92466ed::TelemetrySample;
+using tle92466ed::posix::SharedTelemetry;
+
+int main(int argc, char** argv) {
+  const char* segment = argc > 1 ? argv[1] : "/tle92466ed0";
+  const long count = argc > 2 ? std::atol(argv[2]) : -1;
+
+  SharedTelemetry shared;
+  if (auto result = shared.Attach(segment); !result) {
+    std::fprintf(stderr, "shm attach %s failed: %s\n", segment, std::strerror(result.error()));
+    return 1;
+  }
+
+  uint32_t seen = shared.Publications();
+  TelemetrySample sample{};
+  for (long printed = 0; count < 0 || printed < count;) {
+    // Poll the publication counter; only copy the payload when it changed
+    const uint32_t current = shared.Publications();
+    if (current == seen || !shared.Read(sample)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      continue;
+    }
+    seen = current;
+    ++printed;
+
+    std::printf("#%" PRIu32 " t=%" PRIu64 "us VBAT=%umV VIO=%umV VDD=%umV DIAG0=0x%04X EN=0x%02X\n",
+                sample.capture_count, sample.timestamp_us, sample.vbat_mv, sample.vio_mv,
+                sample.vdd_mv, sample.global_diag0, sample.enable_mask);
+    for (std::size_t ch = 0; ch < sample.channels.size(); ++ch) {
+      const auto& channel = sample.channels[ch];
+      std::printf("  CH%zu set=%5u iavg=%5u dc=%5u err=0x%04X warn=0x%04X\n", ch, channel.setpoint,
+                  channel.average_current, channel.duty_cycle, channel.diag_err,
+                  channel.diag_warn);
+    }
+  }
+  return 0;
+}
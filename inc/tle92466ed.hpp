@@ -70,9 +70,33 @@
 
 #include "tle92466ed_spi_interface.hpp"
 #include "tle92466ed_registers.hpp"
+#include "tle92466ed_bundle.hpp"
+#include "tle92466ed_feedback.hpp"
+#include "tle92466ed_integrity.hpp"
+#include "tle92466ed_peak_hold.hpp"
+#include "tle92466ed_profiler.hpp"
+#include "tle92466ed_qos.hpp"
+#include "tle92466ed_trace.hpp"
+#include "tle92466ed_telemetry.hpp"
+#include "tle92466ed_thermal.hpp"
+#include "tle92466ed_usage.hpp"
+#include "tle92466ed_views.hpp"
 
 namespace tle92466ed {
 
+/**
+ * @brief Mark the entry of a public API
+ *
+ * @details
+ * Opens a Driver::CallScope: bus QoS admission is decided once per outermost
+ * call, with TLE92466ED_ENABLE_PROFILER defined the call's register accesses
+ * are attributed to it, and with TLE92466ED_ENABLE_TRACE defined its span is
+ * recorded. TLE92466ED_API_ENTRY_OF() names the driver
+ * (static members).
+ */
+#define TLE92466ED_API_ENTRY_OF(driver) const CallScope tle92466ed_call_scope((driver), __func__)
+#define TLE92466ED_API_ENTRY() TLE92466ED_API_ENTRY_OF(*this)
+
 /**
  * @brief Driver error codes
  */
@@ -91,7 +115,10 @@ enum class DriverError : uint8_t {
   TimeoutError,        ///< Operation timeout
   WrongMode,           ///< Operation not allowed in current mode
   SPIFrameError,       ///< SPI frame error from device
-  WriteToReadOnly      ///< Attempted write to read-only register
+  WriteToReadOnly,     ///< Attempted write to read-only register
+  Busy,                ///< Another resumable operation is in progress
+  CapacityExceeded,    ///< Fixed-size table is full
+  Deferred             ///< Bus QoS budget of the caller's class exhausted, retry later
 };
 
 /**
@@ -248,6 +275,39 @@ struct FaultReport {
   bool supply_nok_external{false}; ///< External supply fault summary
 };
 
+/**
+ * @brief Wiring verdict of one channel from an off-state harness scan
+ */
+enum class WiringVerdict : uint8_t {
+  NotScanned = 0,  ///< Channel not in the scan mask
+  Ok,              ///< No off-state fault
+  OpenLoad,        ///< Open load (load or harness disconnected)
+  ShortToGround,   ///< Output shorted to ground
+  OpenLoadOrShort, ///< Open load or short to ground (not distinguishable)
+  Overcurrent      ///< Over-current flagged (e.g. short to battery)
+};
+
+/**
+ * @brief Off-state harness scan parameters
+ */
+struct HarnessScanConfig {
+  uint8_t channel_mask{0x3F};                     ///< Channels to scan (bit N = channel N)
+  DiagCurrent diag_current{DiagCurrent::I_190UA}; ///< OFF-state diagnostic current
+  uint32_t settle_us{1000};                       ///< Wait for currents and diagnosis filters
+  bool restore_config{true};                      ///< Write the previous CH_CONFIG back after
+};
+
+/**
+ * @brief Off-state harness scan result
+ */
+struct HarnessScanResult {
+  std::array<WiringVerdict, 6> verdicts{}; ///< Verdict per channel
+  std::array<uint16_t, 6> diag_err{};      ///< Raw DIAG_ERR_CHGRx per channel
+  std::array<uint16_t, 6> diag_warn{};     ///< Raw DIAG_WARN_CHGRx per channel
+  uint8_t scanned_mask{0};                 ///< Channels scanned
+  uint8_t fault_mask{0};                   ///< Scanned channels with a verdict other than Ok
+};
+
 /**
  * @brief Global configuration structure
  */
@@ -261,6 +321,114 @@ struct GlobalConfig {
   uint16_t spi_watchdog_reload{1000}; ///< SPI watchdog reload value
 };
 
+/**
+ * @brief How Driver::ActivateSynchronized() releases the staged channels
+ */
+enum class SyncRelease : uint8_t {
+  SharedEnable, ///< Gate EN low while staging, then one EN edge releases all devices
+  FrameBurst    ///< Send the precomputed CH_CTRL frames of all devices back to back
+};
+
+/**
+ * @brief Per-device request for Driver::ActivateSynchronized()
+ */
+struct SyncActivation {
+  uint8_t channel_mask{0};              ///< Channels enabled after release (bit N = CHN)
+  uint8_t setpoint_mask{0};             ///< Channels whose setpoint is staged first
+  std::array<uint16_t, 6> current_ma{}; ///< Setpoints in mA (for setpoint_mask channels)
+};
+
+/**
+ * @brief Timing of a synchronized activation
+ *
+ * @details
+ * Times come from the first device's NowUs() and are 0 without a time source.
+ * With SyncRelease::FrameBurst, skew_us is the duration of the release loop,
+ * an upper bound of the first-to-last switching skew; with SharedEnable all
+ * devices switch on the same EN edge and skew_us is 0.
+ *
+ * A report is also returned when the activation failed after some devices had
+ * switched: switched_mask names them and error holds the first failure.
+ */
+struct SyncReport {
+  SyncRelease release{SyncRelease::FrameBurst}; ///< Release method used
+  uint8_t devices{0};                           ///< Devices requested
+  uint8_t switched_mask{0};                     ///< Devices switched (bit i = devices[i])
+  DriverError error{DriverError::None};         ///< First failure, None if all devices switched
+  uint64_t staged_us{0};                        ///< Staging finished
+  uint64_t released_us{0};                      ///< Last device released
+  uint32_t skew_us{0};                          ///< First-to-last switching skew (upper bound)
+};
+
+/**
+ * @brief Pre-validated channel of a Driver, for hot per-tick calls
+ *
+ * @details
+ * Only Driver::GetChannelHandle() (after Init()) and the Channel template
+ * overloads create handles, so holding one proves the channel is valid. The
+ * channel register base is resolved once, at creation, instead of through
+ * GetChannelBase() on every call.
+ *
+ * @code
+ *   auto ch0 = driver.GetChannelHandle(Channel::CH0);  // once, after Init()
+ *   driver.SetCurrentSetpoint(*ch0, 1500);              // per tick
+ *   driver.SetCurrentSetpoint<Channel::CH1>(1500);      // address fixed at compile time
+ * @endcode
+ */
+class ChannelHandle {
+public:
+  /**
+   * @brief The channel
+   */
+  [[nodiscard]] constexpr Channel GetChannel() const noexcept {
+    return channel_;
+  }
+
+  /**
+   * @brief Channel index (0-5)
+   */
+  [[nodiscard]] constexpr uint8_t Index() const noexcept {
+    return ToIndex(channel_);
+  }
+
+  /**
+   * @brief Address of a channel register
+   * @param offset ChannelReg offset
+   */
+  [[nodiscard]] constexpr uint16_t Register(uint16_t offset) const noexcept {
+    return base_ + offset;
+  }
+
+private:
+  template <typename CommType>
+  friend class Driver;
+
+  constexpr explicit ChannelHandle(Channel channel) noexcept
+      : channel_(channel), base_(GetChannelBase(channel)) {}
+
+  Channel channel_; ///< Validated channel
+  uint16_t base_;   ///< Channel register base address
+};
+
+/**
+ * @brief Long-running driver operation that can be advanced with Driver::Step()
+ */
+enum class Operation : uint8_t {
+  None = 0,        ///< No operation in progress
+  Init,            ///< Started by Driver::BeginInit()
+  GetAllFaults,    ///< Started by Driver::BeginGetAllFaults()
+  PrintAllFaults,  ///< Started by Driver::BeginPrintAllFaults()
+  ConfigureChannel ///< Started by Driver::BeginConfigureChannel()
+};
+
+/**
+ * @brief Progress reported by Driver::Step()
+ */
+enum class StepStatus : uint8_t {
+  InProgress, ///< More Step() calls are needed
+  Done        ///< Operation completed successfully
+};
+
 /**
  * @brief Main TLE92466ED driver class
  *
@@ -332,7 +500,8 @@ public:
    * 1. Initialize CommInterface (SPI peripheral)
    * 2. Verify device communication
    * 3. Read and verify device ID
-   * 4. Apply default configuration (in Config Mode)
+   * 4. Apply default configuration (in Config Mode; channel defaults are deferred
+   *    to first use with SetLazyChannelInit())
    * 5. Clear any power-on faults
    *
    * After init(), device is in Config Mode. Call enter_mission_mode() to enable outputs.
@@ -342,7 +511,7 @@ public:
    * @retval DriverError::DeviceNotResponding No SPI response
    * @retval DriverError::WrongDeviceID Device ID mismatch
    */
-  [[nodiscard]] DriverResult<void> Init() noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void> Init() noexcept;
 
   /**
    * @brief Enter Mission Mode (enables channel control)
@@ -384,6 +553,39 @@ public:
     return !mission_mode_;
   }
 
+  /**
+   * @brief Defer each channel's default configuration to its first use
+   *
+   * @details
+   * Takes effect at the next Init(). Init() then writes only the global
+   * defaults (GLOBAL_CONFIG, VBAT thresholds); the channel defaults (MODE =
+   * ICC, CH_CONFIG slew rate, SETPOINT = 0) of a channel are sent with the
+   * first write to one of its registers in Config Mode, in the same burst as
+   * that write (ConfigureChannel(), ReconfigureChannel(), SetChannelMode(),
+   * ApplyConfigBundle(), ...). Registers the user writes in that burst are not
+   * written with their default.
+   *
+   * In Mission Mode the CH_CONFIG and SETPOINT defaults are sent the same way,
+   * but MODE only accepts writes in Config Mode: its default stays pending,
+   * and enabling the channel fails with DriverError::WrongMode (the device
+   * would leave it in its reset mode, OFF). Configure a channel's mode before
+   * EnterMissionMode(). Enabling a channel whose MODE is set sends its
+   * remaining defaults first.
+   *
+   * @param enabled true for lazy channel defaults, false to apply all of them in Init()
+   */
+  void SetLazyChannelInit(bool enabled) noexcept {
+    lazy_channel_init_ = enabled;
+  }
+
+  /**
+   * @brief Channels whose default configuration has not been written yet
+   * @return Channel mask (bit N = channel N), 0 unless lazy channel init is used
+   */
+  [[nodiscard]] uint8_t GetPendingChannelDefaults() const noexcept {
+    return pendingChannels();
+  }
+
   //==========================================================================
   // GLOBAL CONFIGURATION
   //==========================================================================
@@ -396,7 +598,8 @@ public:
    * @retval DriverError::NotInitialized Driver not initialized
    * @retval DriverError::WrongMode Must be in Config Mode
    */
-  [[nodiscard]] DriverResult<void> ConfigureGlobal(const GlobalConfig& config) noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void>
+  ConfigureGlobal(const GlobalConfig& config) noexcept;
 
   /**
    * @brief Enable/disable CRC checking
@@ -404,7 +607,7 @@ public:
    * @param enabled true to enable CRC
    * @return DriverResult<void> Success or error
    */
-  [[nodiscard]] DriverResult<void> SetCrcEnabled(bool enabled) noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void> SetCrcEnabled(bool enabled) noexcept;
 
   /**
    * @brief Set VBAT under/overvoltage thresholds from voltage values (High-Level API)
@@ -420,7 +623,8 @@ public:
    * @note This is the recommended API for most users. Use SetVbatThresholdsRaw()
    *       only if you need direct control over register values.
    */
-  [[nodiscard]] DriverResult<void> SetVbatThresholds(float uv_voltage, float ov_voltage) noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void> SetVbatThresholds(float uv_voltage,
+                                                                     float ov_voltage) noexcept;
 
   /**
    * @brief Set VBAT under/overvoltage thresholds (Low-Level API)
@@ -432,8 +636,8 @@ public:
    * @note For most users, prefer SetVbatThresholds(uv_voltage, ov_voltage) which
    *       automatically calculates these values from voltage.
    */
-  [[nodiscard]] DriverResult<void> SetVbatThresholdsRaw(uint8_t uv_threshold,
-                                                        uint8_t ov_threshold) noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void>
+  SetVbatThresholdsRaw(uint8_t uv_threshold, uint8_t ov_threshold) noexcept;
 
   //==========================================================================
   // CHANNEL CONTROL
@@ -457,6 +661,46 @@ public:
    */
   [[nodiscard]] DriverResult<void> EnableChannels(uint8_t channel_mask) noexcept;
 
+  /// Maximum devices released by one ActivateSynchronized() call
+  static constexpr std::size_t MAX_SYNC_DEVICES = 8;
+
+  /**
+   * @brief Enable channels on several devices at the same instant
+   *
+   * @details
+   * Calling EnableChannels() per device switches the devices one full write
+   * (two frames plus logging) apart. This stages setpoints and CH_CTRL first
+   * and then releases all devices together:
+   * - SyncRelease::SharedEnable: EN is driven low through the first device's
+   *   interface (all EN pins share that line), setpoints and CH_CTRL are
+   *   written to every device, and one EN rising edge releases them. Refused
+   *   while a channel of any of the devices is on, since gating EN would
+   *   interrupt it; other devices on the EN line are the caller's concern. EN
+   *   is driven high again on every path after it was gated, which releases
+   *   the devices staged before a failure.
+   * - SyncRelease::FrameBurst: setpoints are written, the CH_CTRL frames are
+   *   precomputed, and the release loop only sends one frame per device. The
+   *   write replies of all sent frames are collected and checked after the
+   *   release.
+   *
+   * If some devices switched before a failure, the report is returned with
+   * SyncReport::switched_mask and SyncReport::error set; the caches of the
+   * switched devices follow their new CH_CTRL. An error result means no device
+   * switched.
+   *
+   * @param devices Drivers to release, initialized and in Mission Mode
+   * @param activations One request per device (same order)
+   * @param release Release method
+   * @return SyncReport Achieved timing, or error
+   * @retval DriverError::InvalidParameter Size mismatch, no devices or more than
+   *         MAX_SYNC_DEVICES
+   * @retval DriverError::WrongMode A device is not in Mission Mode
+   * @retval DriverError::Busy SharedEnable while a channel of a device is on
+   */
+  [[nodiscard]] static DriverResult<SyncReport>
+  ActivateSynchronized(std::span<Driver* const> devices,
+                       std::span<const SyncActivation> activations, SyncRelease release) noexcept;
+
   /**
    * @brief Enable all channels
    */
@@ -501,6 +745,7 @@ public:
    *
    * @note Current is regulated by the Integrated Current Controller (ICC)
    * @note Resolution: 15-bit (0.061mA per LSB in single mode)
+   * @note With SetSetpointCoalescing(true) the value is only staged until Flush()
    *
    * @par Current Limits (from datasheet):
    * - **Single channel**: 1.5A typical continuous, 2.0A absolute maximum
@@ -510,8 +755,8 @@ public:
    *          thermal limiting, reduced accuracy, or current regulation at the
    *          device's natural limit rather than the requested setpoint.
    */
-  [[nodiscard]] DriverResult<void> SetCurrentSetpoint(Channel channel, uint16_t current_ma,
-                                                      bool parallel_mode = false) noexcept;
+  [[nodiscard]] TLE92466ED_HOT DriverResult<void>
+  SetCurrentSetpoint(Channel channel, uint16_t current_ma, bool parallel_mode = false) noexcept;
 
   /**
    * @brief Get current setpoint for channel
@@ -520,8 +765,42 @@ public:
    * @param parallel_mode true if channel is in parallel mode
    * @return DriverResult<uint16_t> Current in mA or error
    */
-  [[nodiscard]] DriverResult<uint16_t> GetCurrentSetpoint(Channel channel,
-                                                          bool parallel_mode = false) noexcept;
+  [[nodiscard]] TLE92466ED_HOT DriverResult<uint16_t>
+  GetCurrentSetpoint(Channel channel, bool parallel_mode = false) noexcept;
+
+  /**
+   * @brief Enable or disable setpoint write coalescing
+   *
+   * @details
+   * While enabled, SetCurrentSetpoint() only stages the target per channel
+   * (last value wins) and Flush() writes all staged channels in one pipelined
+   * burst. Bus traffic then scales with the number of channels per control
+   * period instead of the number of callers. Disabling flushes pending values.
+   *
+   * @param enabled true to stage setpoints until Flush()
+   * @return DriverResult<void> Success or error from the implicit flush
+   */
+  [[nodiscard]] DriverResult<void> SetSetpointCoalescing(bool enabled) noexcept;
+
+  /**
+   * @brief Write all staged setpoints in a single burst
+   *
+   * @details
+   * Call once per control period (or whenever a staged value must reach the
+   * device immediately). No-op if nothing is staged.
+   *
+   * @param verify If true, read all flushed SETPOINT registers back in one burst
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::RegisterError Readback did not match (verify=true)
+   */
+  [[nodiscard]] TLE92466ED_HOT DriverResult<void> Flush(bool verify = false) noexcept;
+
+  /**
+   * @brief Get the mask of channels with staged, not yet flushed setpoints
+   */
+  [[nodiscard]] uint8_t GetPendingSetpointMask() const noexcept {
+    return staged_setpoint_mask_;
+  }
 
   /**
    * @brief Configure PWM period from desired period in microseconds (High-Level API)
@@ -572,8 +851,9 @@ public:
    * @return DriverResult<void> Success or error
    *
    * @details
-   * Automatically calculates step_size, num_steps, and flat_steps to achieve
-   * the desired amplitude and frequency.
+   * Selects step_size, num_steps, and flat_steps jointly with the exact
+   * DITHER::SolveFromAmplitudeFrequency() and logs the achieved amplitude and
+   * frequency next to the requested ones (warning above DITHER_WARN_ERROR_PPM).
    *
    * **Formulas**:
    * - I_dither = STEPS × STEP_SIZE × 2A / 32767
@@ -586,6 +866,31 @@ public:
                                                    float frequency_hz,
                                                    bool parallel_mode = false) noexcept;
 
+  /**
+   * @brief Configure dither from a precomputed solution
+   *
+   * @param channel Channel to configure
+   * @param solution Result of DITHER::Solve() or DITHER::Lookup()
+   * @return DriverResult<void> Success or error
+   *
+   * @details
+   * Use with a constexpr DITHER::Solve() to compute the exact joint optimum at
+   * compile time:
+   * @code
+   * constexpr auto dither =
+   *     DITHER::Solve(DITHER::PeriodTicks(50'000), DITHER::AmplitudeUnits(100'000));
+   * driver.ConfigureDither(Channel::CH0, dither);
+   * @endcode
+   */
+  [[nodiscard]] DriverResult<void>
+  ConfigureDither(Channel channel, const DITHER::DitherSolution& solution) noexcept {
+    return ConfigureDitherRaw(channel, solution.config.step_size, solution.config.num_steps,
+                              solution.config.flat_steps);
+  }
+
+  /// Combined dither error above which ConfigureDither() logs a warning (5 %)
+  static constexpr uint32_t DITHER_WARN_ERROR_PPM = 50'000;
+
   /**
    * @brief Configure dither parameters (Low-Level API)
    *
@@ -614,8 +919,279 @@ public:
    * @param config Channel configuration
    * @return DriverResult<void> Success or error
    */
-  [[nodiscard]] DriverResult<void> ConfigureChannel(Channel channel,
-                                                    const ChannelConfig& config) noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void>
+  ConfigureChannel(Channel channel, const ChannelConfig& config) noexcept;
+
+  /**
+   * @brief Apply one variant of a configuration bundle
+   *
+   * @details
+   * Clocks the variant's prebuilt write frames out of the bundle memory in a
+   * single TransferMulti() burst (N writes + 1 frame) and checks every reply.
+   * Driver caches (CRC/VIO mode, CH_CTRL, setpoints) are updated from the
+   * frames. Reply CRCs are checked when CRC is enabled before and after the
+   * burst; a bundle that toggles CRC_EN only has reply status checked.
+   *
+   * With SetLazyChannelInit(), the pending defaults of the channels the
+   * variant touches are sent first, in their own burst (defaults + 1 frames).
+   *
+   * Bundles hold the registers that differ from the post-Init() state, so
+   * apply a variant right after Init().
+   *
+   * @param bundle Validated bundle view (see tle92466ed_bundle.hpp)
+   * @param variant_id Variant to apply
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::WrongMode Not in Config Mode
+   * @retval DriverError::InvalidParameter Invalid bundle or unknown variant
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void>
+  ApplyConfigBundle(const ConfigBundleView& bundle, uint32_t variant_id) noexcept;
+
+  /**
+   * @brief Change the configuration of a running channel without glitches
+   *
+   * @details
+   * ConfigurePwmPeriod()/ConfigureDither()/ConfigureChannel() issued one by one
+   * leave the channel running on a half-applied configuration between calls.
+   * This reads the channel's current registers in one burst, computes the
+   * complete new register set (SETPOINT, CTRL, PERIOD, DITHER_CTRL,
+   * DITHER_STEP, CH_CONFIG), drops the writes that change nothing, and sends
+   * the rest in one back-to-back WriteMulti() burst. The channel stays enabled
+   * and in regulation; CH_CTRL is not touched.
+   *
+   * Write order avoids intermediate states outside both the old and the new
+   * configuration: PWM period and CH_CONFIG first, a shrinking dither before
+   * the setpoint and a growing dither after it, and of the two dither factors
+   * (step size, steps) the decreasing one first.
+   *
+   * As in ConfigureChannel(), pwm_period_mantissa 0 and dither_step_size 0 keep
+   * the current PWM period and dither. The channel mode cannot change in
+   * Mission Mode, so config.mode must match the MODE register.
+   *
+   * @param channel Channel to reconfigure
+   * @param config New configuration
+   * @param verify Read the written registers back once, in one burst
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::WrongMode config.mode differs from the channel's mode
+   * @retval DriverError::RegisterError Readback differs from the new configuration
+   */
+  [[nodiscard]] DriverResult<void> ReconfigureChannel(Channel channel, const ChannelConfig& config,
+                                                      bool verify = true) noexcept;
+
+  //==========================================================================
+  // CHANNEL HANDLES (HOT PATH)
+  //==========================================================================
+
+  /**
+   * @brief Validate a channel once and get a handle for the hot-path overloads
+   *
+   * @details
+   * The handle overloads below skip the channel validation and the register
+   * base lookup of their Channel counterparts (which forward to them). The
+   * `Channel` template overloads go further and resolve the register address
+   * at compile time.
+   *
+   * @return DriverResult<ChannelHandle> Handle or error
+   * @retval DriverError::NotInitialized Driver not initialized
+   * @retval DriverError::InvalidChannel Invalid channel
+   */
+  [[nodiscard]] DriverResult<ChannelHandle> GetChannelHandle(Channel channel) const noexcept {
+    if (auto result = checkInitialized(); !result) {
+      return std::unexpected(result.error());
+    }
+    if (!isValidChannelInternal(channel)) {
+      return std::unexpected(DriverError::InvalidChannel);
+    }
+    return ChannelHandle(channel);
+  }
+
+  /**
+   * @brief SetCurrentSetpoint() on a validated channel
+   */
+  [[nodiscard]] TLE92466ED_HOT DriverResult<void>
+  SetCurrentSetpoint(ChannelHandle channel, uint16_t current_ma,
+                     bool parallel_mode = false) noexcept;
+
+  /**
+   * @brief GetCurrentSetpoint() on a validated channel
+   */
+  [[nodiscard]] TLE92466ED_HOT DriverResult<uint16_t>
+  GetCurrentSetpoint(ChannelHandle channel, bool parallel_mode = false) noexcept;
+
+  /**
+   * @brief GetAverageCurrent() on a validated channel
+   */
+  [[nodiscard]] TLE92466ED_HOT DriverResult<uint16_t>
+  GetAverageCurrent(ChannelHandle channel, bool parallel_mode = false) noexcept;
+
+  /**
+   * @brief GetDutyCycle() on a validated channel
+   */
+  [[nodiscard]] DriverResult<uint16_t> GetDutyCycle(ChannelHandle channel) noexcept;
+
+  /**
+   * @brief ConfigurePwmPeriod() on a validated channel
+   */
+  [[nodiscard]] DriverResult<void> ConfigurePwmPeriod(ChannelHandle channel,
+                                                      float period_us) noexcept;
+
+  /**
+   * @brief SetCurrentSetpoint() on a channel fixed at compile time
+   */
+  template <Channel CH>
+  [[nodiscard]] DriverResult<void> SetCurrentSetpoint(uint16_t current_ma,
+                                                      bool parallel_mode = false) noexcept {
+    static_assert(IsValidChannel(CH), "Invalid channel");
+    return SetCurrentSetpoint(ChannelHandle(CH), current_ma, parallel_mode);
+  }
+
+  /**
+   * @brief GetCurrentSetpoint() on a channel fixed at compile time
+   */
+  template <Channel CH>
+  [[nodiscard]] DriverResult<uint16_t> GetCurrentSetpoint(bool parallel_mode = false) noexcept {
+    static_assert(IsValidChannel(CH), "Invalid channel");
+    return GetCurrentSetpoint(ChannelHandle(CH), parallel_mode);
+  }
+
+  /**
+   * @brief GetAverageCurrent() on a channel fixed at compile time
+   */
+  template <Channel CH>
+  [[nodiscard]] DriverResult<uint16_t> GetAverageCurrent(bool parallel_mode = false) noexcept {
+    static_assert(IsValidChannel(CH), "Invalid channel");
+    return GetAverageCurrent(ChannelHandle(CH), parallel_mode);
+  }
+
+  /**
+   * @brief GetDutyCycle() on a channel fixed at compile time
+   */
+  template <Channel CH>
+  [[nodiscard]] DriverResult<uint16_t> GetDutyCycle() noexcept {
+    static_assert(IsValidChannel(CH), "Invalid channel");
+    return GetDutyCycle(ChannelHandle(CH));
+  }
+
+  /**
+   * @brief ConfigurePwmPeriod() on a channel fixed at compile time
+   */
+  template <Channel CH>
+  [[nodiscard]] DriverResult<void> ConfigurePwmPeriod(float period_us) noexcept {
+    static_assert(IsValidChannel(CH), "Invalid channel");
+    return ConfigurePwmPeriod(ChannelHandle(CH), period_us);
+  }
+
+  //==========================================================================
+  // PEAK AND HOLD
+  //==========================================================================
+
+  /**
+   * @brief Configure the peak-and-hold profile of a channel
+   *
+   * @details
+   * Converts both levels with the cached parallel state and prebuilds the hold
+   * setpoint frame, so the transition only sends it. A running profile of the
+   * channel is stopped. SetParallelOperation() removes the profiles of the
+   * channels whose parallel state it changes; configure them again afterwards.
+   *
+   * @param channel Channel to configure
+   * @param profile Peak level, peak duration and hold level
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::InvalidChannel Invalid channel
+   * @retval DriverError::InvalidParameter peak_us is 0, hold above peak or peak
+   *         above the register scale (2000 mA single, 4000 mA parallel)
+   */
+  [[nodiscard]] DriverResult<void> ConfigurePeakHold(Channel channel,
+                                                     const PeakHoldProfile& profile) noexcept;
+
+  /**
+   * @brief Remove the profiles of channels (pending transitions are dropped)
+   * @param channel_mask Channels (bit n = CHn)
+   */
+  void ClearPeakHold(uint8_t channel_mask) noexcept {
+    peak_hold_.Clear(static_cast<uint8_t>(channel_mask & CH_CTRL::ALL_CH_MASK));
+  }
+
+  /**
+   * @brief Start the profiles of channels at peak current
+   *
+   * @details
+   * Writes the peak setpoints of all channels in channel_mask and, with
+   * enable, CH_CTRL with these channels added, in one pipelined burst. Each
+   * channel's transition to hold current is then due peak_us after the burst
+   * and is released by ServicePeakHold(). Staged setpoints of these channels
+   * are discarded. A later write to a channel's SETPOINT (SetCurrentSetpoint(),
+   * ConfigureChannel(), ReconfigureChannel(), ApplyConfigBundle(),
+   * WriteRegister(), ...), disabling the channel or EnterConfigMode() cancels
+   * its pending transition.
+   *
+   * @param channel_mask Channels to start (bit n = CHn), each with a profile
+   * @param enable true to enable the channels in the same burst (Mission Mode)
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::NotInitialized Driver not initialized
+   * @retval DriverError::InvalidParameter Empty mask or a channel without profile
+   * @retval DriverError::WrongMode enable outside Mission Mode
+   * @retval DriverError::ConfigurationError CommInterface has no GetTimeUs() time source
+   */
+  [[nodiscard]] DriverResult<void> StartPeakHold(uint8_t channel_mask,
+                                                 bool enable = true) noexcept;
+
+  /**
+   * @brief Release due peak-to-hold transitions
+   *
+   * @details
+   * Call from the transport's timer hook, armed at
+   * GetNextPeakHoldTransitionUs() - lead_us, or from the control loop. If the
+   * earliest pending transition is due within lead_us, this waits for it
+   * through the CommInterface DelayUntil() hook and sends the prebuilt hold
+   * frames of all transitions due by then or within the merge window in one
+   * burst, without readback. Reply status and CRC are checked after the
+   * release; on error the transitions stay pending.
+   *
+   * @param lead_us How early the caller may be (0 = release only due transitions)
+   * @return DriverResult<uint8_t> Channels switched to hold current (bit n = CHn)
+   * @retval DriverError::NotInitialized Driver not initialized
+   */
+  [[nodiscard]] DriverResult<uint8_t> ServicePeakHold(uint32_t lead_us = 0) noexcept;
+
+  /**
+   * @brief Due time of the next transition (GetTimeUs() time base), 0 if none is pending
+   */
+  [[nodiscard]] uint64_t GetNextPeakHoldTransitionUs() const noexcept {
+    uint64_t due_us = 0;
+    return peak_hold_.NextDue(due_us) ? due_us : 0;
+  }
+
+  /**
+   * @brief Channels at peak current with a pending transition (bit n = CHn)
+   */
+  [[nodiscard]] uint8_t GetActivePeakHoldMask() const noexcept {
+    return peak_hold_.ActiveMask();
+  }
+
+  /**
+   * @brief Let transitions due within window_us after the first share its burst
+   *
+   * @param window_us Merge window (default PeakHoldScheduler::DEFAULT_MERGE_WINDOW_US);
+   *                  merged transitions are released up to window_us early
+   */
+  void SetPeakHoldMergeWindow(uint32_t window_us) noexcept {
+    peak_hold_.SetMergeWindow(window_us);
+  }
+
+  /**
+   * @brief Transition timing counters
+   */
+  [[nodiscard]] const PeakHoldStats& GetPeakHoldStats() const noexcept {
+    return peak_hold_.Stats();
+  }
+
+  /**
+   * @brief Clear the transition timing counters
+   */
+  void ResetPeakHoldStats() noexcept {
+    peak_hold_.ResetStats();
+  }
 
   //==========================================================================
   // STATUS AND DIAGNOSTICS
@@ -643,8 +1219,8 @@ public:
    * @param parallel_mode true if in parallel mode
    * @return DriverResult<uint16_t> Average current in mA or error
    */
-  [[nodiscard]] DriverResult<uint16_t> GetAverageCurrent(Channel channel,
-                                                         bool parallel_mode = false) noexcept;
+  [[nodiscard]] TLE92466ED_HOT DriverResult<uint16_t>
+  GetAverageCurrent(Channel channel, bool parallel_mode = false) noexcept;
 
   /**
    * @brief Get PWM duty cycle for a channel
@@ -726,7 +1302,34 @@ public:
    *
    * @return DriverResult<void> Success or error
    */
-  [[nodiscard]] DriverResult<void> PrintAllFaults() noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void> PrintAllFaults() noexcept;
+
+  /**
+   * @brief Decode one fault register value into a report, as GetAllFaults() does
+   *
+   * @details
+   * For offline decoding of recorded frames (GLOBAL_DIAG0-2, FB_STAT,
+   * DIAG_ERR_CHGRx, DIAG_WARN_CHGRx). Call SummarizeFaults() once all
+   * registers of interest have been decoded.
+   *
+   * @return false if address is not one of the fault registers
+   */
+  static bool DecodeFaultRegister(FaultReport& report, uint16_t address, uint16_t value) noexcept {
+    for (uint8_t index = 0; index < FAULT_SCAN_COUNT; ++index) {
+      if (faultScanAddress(index) == address) {
+        decodeFaultRegister(report, index, value);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Derive has_fault and any_fault from decoded registers
+   */
+  static void SummarizeFaults(FaultReport& report) noexcept {
+    summarizeFaults(report);
+  }
 
   /**
    * @brief Software reset of the device
@@ -736,48 +1339,189 @@ public:
    *
    * @return DriverResult<void> Success or error
    */
-  [[nodiscard]] DriverResult<void> SoftwareReset() noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void> SoftwareReset() noexcept;
 
   //==========================================================================
-  // WATCHDOG MANAGEMENT
+  // HARNESS SCAN
   //==========================================================================
 
   /**
-   * @brief Reload SPI watchdog counter
+   * @brief Check the wiring of several channels with the off-state diagnostics
    *
    * @details
-   * Must be called periodically when SPI watchdog is enabled to prevent
-   * watchdog timeout.
-   *
-   * @param reload_value Reload value (watchdog period)
-   * @return DriverResult<void> Success or error
+   * Runs the open-load / short-to-ground check of all channels in the mask at
+   * once instead of channel by channel:
+   * 1. one burst reads CH_CONFIG of the channels
+   * 2. one burst switches them to full off-state diagnosis with diag_current
+   *    (slew rate and open-load thresholds are kept) and clears their latched
+   *    DIAG_ERR_CHGRx and DIAG_WARN_CHGRx flags
+   * 3. a single settle_us wait (TimingRequirement::Settle)
+   * 4. one burst reads DIAG_ERR_CHGRx and DIAG_WARN_CHGRx of the channels
+   * 5. one burst writes the previous CH_CONFIG back (restore_config), also
+   *    when step 3 or 4 failed
+   *
+   * Requires Config Mode, where all outputs are off. Flags latched before the
+   * scan are cleared in step 2, so the verdicts reflect the scan only.
+   *
+   * @param config Scan parameters
+   * @return DriverResult<HarnessScanResult> Verdicts and raw diagnosis registers
+   * @retval DriverError::WrongMode Device is in Mission Mode
+   * @retval DriverError::InvalidParameter Empty or invalid channel mask
    */
-  [[nodiscard]] DriverResult<void> ReloadSpiWatchdog(uint16_t reload_value) noexcept;
+  [[nodiscard]] DriverResult<HarnessScanResult>
+  ScanHarness(const HarnessScanConfig& config = {}) noexcept;
 
+#ifdef TLE92466ED_ENABLE_RESUMABLE_OPS
   //==========================================================================
-  // DEVICE INFORMATION
+  // RESUMABLE OPERATIONS (TLE92466ED_ENABLE_RESUMABLE_OPS)
   //==========================================================================
 
+  /// Default frame budget of a single Step() call
+  static constexpr uint16_t DEFAULT_STEP_FRAMES = 8;
+
   /**
-   * @brief Read IC version and ID
+   * @brief Start a resumable Init()
    *
-   * @return DriverResult<uint16_t> ICVID register value
+   * @details
+   * Init(), GetAllFaults(), PrintAllFaults() and ConfigureChannel() hold the bus
+   * for dozens of frames (Init() also waits 20 ms for the reset pulse). Their
+   * Begin*() counterparts only record the request; the work is done by Step(),
+   * which advances a bounded number of frames per call so urgent traffic on the
+   * same bus can be interleaved. The blocking functions run the very same state
+   * machine to completion, so the end result is identical.
+   *
+   * The RESN pulse and recovery waits of Init() do not block inside Step() when
+   * the CommInterface provides the GetTimeUs() hook; Step() returns
+   * StepStatus::InProgress until the deadline has passed. Without a time source
+   * the waits are performed with Delay() inside the Step() that reaches them.
+   *
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::Busy Another resumable operation is in progress
    */
-  [[nodiscard]] DriverResult<uint16_t> GetIcVersion() noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void> BeginInit() noexcept;
 
   /**
-   * @brief Read unique chip ID
+   * @brief Start a resumable GetAllFaults()
    *
-   * @return DriverResult<std::array<uint16_t, 3>> Three 16-bit ID registers
+   * @details
+   * The report is available from GetOperationFaultReport() once Step() returns
+   * StepStatus::Done.
+   *
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::NotInitialized Driver not initialized
+   * @retval DriverError::Busy Another resumable operation is in progress
    */
-  [[nodiscard]] DriverResult<std::array<uint16_t, 3>> GetChipId() noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void> BeginGetAllFaults() noexcept;
 
   /**
-   * @brief Verify device ID matches expected value
+   * @brief Start a resumable PrintAllFaults()
    *
-   * @return DriverResult<bool> true if ID matches
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::NotInitialized Driver not initialized
+   * @retval DriverError::Busy Another resumable operation is in progress
    */
-  [[nodiscard]] DriverResult<bool> VerifyDevice() noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void> BeginPrintAllFaults() noexcept;
+
+  /**
+   * @brief Start a resumable ConfigureChannel()
+   *
+   * @details
+   * The configuration is copied. Config Mode is re-checked before every register
+   * access; entering Mission Mode while the operation is pending aborts it with
+   * DriverError::WrongMode.
+   *
+   * @param channel Channel to configure
+   * @param config Channel configuration
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::NotInitialized Driver not initialized
+   * @retval DriverError::WrongMode Must be in Config Mode
+   * @retval DriverError::InvalidChannel Invalid channel
+   * @retval DriverError::Busy Another resumable operation is in progress
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void>
+  BeginConfigureChannel(Channel channel, const ChannelConfig& config) noexcept;
+
+  /**
+   * @brief Advance the pending resumable operation
+   *
+   * @details
+   * Runs register accesses until the next one would exceed max_frames. At least
+   * one access is made per call, so a Step() costs at most
+   * max(max_frames, 8) frames (the largest single access is ConfigureChannel's
+   * dither setup with two verified writes). On error the operation is dropped.
+   *
+   * @param max_frames SPI frame budget for this call
+   * @return DriverResult<StepStatus> InProgress, Done (also when nothing is pending) or error
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<StepStatus>
+  Step(uint16_t max_frames = DEFAULT_STEP_FRAMES) noexcept;
+
+  /**
+   * @brief Get the resumable operation in progress
+   */
+  [[nodiscard]] Operation GetPendingOperation() const noexcept {
+    return op_.kind;
+  }
+
+  /**
+   * @brief Drop the pending resumable operation
+   *
+   * @details
+   * Register accesses already made are not undone. An aborted Init() leaves
+   * the driver uninitialized; start it again with BeginInit() or Init().
+   */
+  void AbortOperation() noexcept {
+    op_.kind = Operation::None;
+  }
+
+  /**
+   * @brief Fault report of the last completed BeginGetAllFaults()/BeginPrintAllFaults()
+   */
+  [[nodiscard]] const FaultReport& GetOperationFaultReport() const noexcept {
+    return op_.report;
+  }
+#endif // TLE92466ED_ENABLE_RESUMABLE_OPS
+
+  //==========================================================================
+  // WATCHDOG MANAGEMENT
+  //==========================================================================
+
+  /**
+   * @brief Reload SPI watchdog counter
+   *
+   * @details
+   * Must be called periodically when SPI watchdog is enabled to prevent
+   * watchdog timeout.
+   *
+   * @param reload_value Reload value (watchdog period)
+   * @return DriverResult<void> Success or error
+   */
+  [[nodiscard]] DriverResult<void> ReloadSpiWatchdog(uint16_t reload_value) noexcept;
+
+  //==========================================================================
+  // DEVICE INFORMATION
+  //==========================================================================
+
+  /**
+   * @brief Read IC version and ID
+   *
+   * @return DriverResult<uint16_t> ICVID register value
+   */
+  [[nodiscard]] DriverResult<uint16_t> GetIcVersion() noexcept;
+
+  /**
+   * @brief Read unique chip ID
+   *
+   * @return DriverResult<std::array<uint16_t, 3>> Three 16-bit ID registers
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<std::array<uint16_t, 3>> GetChipId() noexcept;
+
+  /**
+   * @brief Verify device ID matches expected value
+   *
+   * @return DriverResult<bool> true if ID matches
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<bool> VerifyDevice() noexcept;
 
   /**
    * @brief Check if driver is initialized
@@ -788,6 +1532,391 @@ public:
     return initialized_;
   }
 
+#ifdef TLE92466ED_ENABLE_USAGE
+  //==========================================================================
+  // USAGE TRACKING (TLE92466ED_ENABLE_USAGE)
+  //==========================================================================
+
+  /**
+   * @brief Get per-channel actuation usage (dwell per current band, on/off cycles)
+   *
+   * @details
+   * Counters are updated incrementally from the setpoints and enable masks the
+   * driver writes; the running intervals are closed out up to now before
+   * returning. Dwell time requires a CommInterface time source (GetTimeUs()).
+   * Persist with UsageAccumulator::Serialize() and restore with RestoreUsage().
+   *
+   * @return Reference to the usage accumulator
+   */
+  [[nodiscard]] const UsageAccumulator& GetUsage() noexcept;
+
+  /**
+   * @brief Restore lifetime usage counters from a persisted blob
+   *
+   * @param blob Blob produced by UsageAccumulator::Serialize()
+   * @return true if the blob was valid and restored
+   */
+  [[nodiscard]] TLE92466ED_COLD bool RestoreUsage(std::span<const uint8_t> blob) noexcept;
+
+  /**
+   * @brief Feed GetAverageCurrent() samples into the usage histogram
+   *
+   * @param enabled true to record FB_I_AVG samples (default: false)
+   */
+  void SetUsageFeedbackEnabled(bool enabled) noexcept {
+    usage_feedback_enabled_ = enabled;
+  }
+#endif // TLE92466ED_ENABLE_USAGE
+
+#ifdef TLE92466ED_ENABLE_THERMAL
+  //==========================================================================
+  // THERMAL ESTIMATION (TLE92466ED_ENABLE_THERMAL)
+  //==========================================================================
+
+  /**
+   * @brief Set the thermal model of a channel's load and switch
+   *
+   * @param channel Channel to configure
+   * @param params Model parameters (coil resistance, thermal resistances/time constants, limits)
+   */
+  void SetThermalModel(Channel channel, const ThermalModelParams& params) noexcept {
+    thermal_.SetParams(ToIndex(channel), params);
+  }
+
+  /**
+   * @brief Sample feedback and advance the thermal estimate of all channels
+   *
+   * @details
+   * Reads VBAT (FB_VOLTAGE2) and FB_I_AVG of every active channel in one
+   * pipelined burst and integrates I²R losses into the first-order thermal
+   * model. Inactive channels cool down; without an active channel no frame
+   * is sent. Call periodically (e.g. every 10-100 ms).
+   *
+   * @param elapsed_us Time since the previous update; 0 = measure with the
+   *                   CommInterface time source (GetTimeUs())
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::InvalidParameter elapsed_us is 0 and no time source is available
+   */
+  [[nodiscard]] DriverResult<void> UpdateThermalEstimate(uint32_t elapsed_us = 0) noexcept;
+
+  /**
+   * @brief Get predicted coil/die temperature rise and losses of a channel
+   *
+   * @param channel Channel to query
+   * @return DriverResult<ThermalEstimate> Estimate or error
+   */
+  [[nodiscard]] DriverResult<ThermalEstimate> GetThermalEstimate(Channel channel) const noexcept {
+    if (!isValidChannelInternal(channel)) {
+      return std::unexpected(DriverError::InvalidChannel);
+    }
+    return thermal_.Get(ToIndex(channel));
+  }
+
+  /**
+   * @brief Cap setpoints pre-emptively when the predicted rise approaches its limit
+   *
+   * @param enabled true to let SetCurrentSetpoint() derate (default: false)
+   */
+  void SetThermalDerating(bool enabled) noexcept {
+    thermal_derating_ = enabled;
+  }
+#endif // TLE92466ED_ENABLE_THERMAL
+
+  //==========================================================================
+  // TELEMETRY
+  //==========================================================================
+
+  /**
+   * @brief Capture a telemetry snapshot in one pipelined burst
+   *
+   * @details
+   * Reads GLOBAL_DIAG0-2, FB_STAT, FB_VOLTAGE1/2 and, per channel, FB_I_AVG,
+   * FB_DC, DIAG_ERR and DIAG_WARN (30 registers, 31 frames, one CS
+   * transaction). Setpoints and the enable mask come from the driver cache.
+   * Publish the result with TelemetryBlock::Publish() to share it with other
+   * threads or processes without giving them access to the bus.
+   *
+   * @param sample Destination (only written on success)
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::NotInitialized Driver not initialized
+   */
+  [[nodiscard]] DriverResult<void> CaptureTelemetry(TelemetrySample& sample) noexcept;
+
+  //==========================================================================
+  // CHANNEL VIEWS
+  //==========================================================================
+
+  /**
+   * @brief Lazy range over all channels
+   *
+   * @details
+   * Refine with the stages of namespace views (OnlyEnabled(), WithFeedback(),
+   * Where(), ...). Nothing is read until iteration begins; then the union of
+   * the registers required by all stages is fetched in one sweep
+   * (FetchChannels()). See tle92466ed_views.hpp.
+   *
+   * @code
+   *   for (const auto& ch : driver.Channels() | views::OnlyFaulted()) { ... }
+   * @endcode
+   */
+  [[nodiscard]] ChannelView<Driver> Channels() noexcept {
+    return ChannelView<Driver>(*this, views::ChannelSelect{}, ChannelField::None,
+                               views::AcceptAll{});
+  }
+
+  /**
+   * @brief Enabled channels from the driver cache (bit n = CHn, no bus access)
+   */
+  [[nodiscard]] uint8_t GetEnabledChannelMask() const noexcept {
+    return static_cast<uint8_t>(channel_enable_cache_ & CH_CTRL::ALL_CH_MASK);
+  }
+
+  /**
+   * @brief Read fields of several channels in one pipelined sweep
+   *
+   * @details
+   * Reads one register per channel and field (FB_I_AVG, FB_DC, FB_IMIN_IMAX,
+   * FB_VBAT, DIAG_ERR, DIAG_WARN), channel by channel. Sweeps above
+   * SpiInterface::MAX_BURST_REGISTERS registers are split into two bursts.
+   * Setpoint, enable and parallel state come from the driver cache; average
+   * currents are converted to mA using the cached parallel state.
+   *
+   * @param channel_mask Channels to read (bit n = CHn)
+   * @param fields Fields to read (ChannelField::None = cached data only)
+   * @param sweep Destination (only written on success)
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::NotInitialized Driver not initialized
+   */
+  [[nodiscard]] DriverResult<void> FetchChannels(uint8_t channel_mask, ChannelField fields,
+                                                 ChannelSweep& sweep) noexcept;
+
+#ifdef TLE92466ED_ENABLE_FEEDBACK
+  //==========================================================================
+  // FEEDBACK SUBSCRIPTIONS (TLE92466ED_ENABLE_FEEDBACK)
+  //==========================================================================
+
+  /**
+   * @brief Subscribe to significant changes of a feedback quantity
+   *
+   * @details
+   * Events are produced by PollFeedback(): an initial event, then one per
+   * deadband step or threshold crossing (see FeedbackSubscription). Without a
+   * callback, events are queued for PopFeedbackEvent().
+   *
+   * @param subscription Quantity, channel, deadband/threshold and delivery
+   * @return DriverResult<uint8_t> Subscription ID or error
+   * @retval DriverError::InvalidChannel Invalid channel for a per-channel quantity
+   * @retval DriverError::InvalidParameter Neither deadband nor threshold set
+   * @retval DriverError::CapacityExceeded All FeedbackMonitor::MAX_SUBSCRIPTIONS in use
+   */
+  [[nodiscard]] DriverResult<uint8_t>
+  SubscribeFeedback(const FeedbackSubscription& subscription) noexcept;
+
+  /**
+   * @brief Remove a feedback subscription
+   *
+   * @param id ID returned by SubscribeFeedback()
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::InvalidParameter Unknown ID
+   */
+  DriverResult<void> UnsubscribeFeedback(uint8_t id) noexcept {
+    if (!feedback_.Unsubscribe(id)) {
+      return std::unexpected(DriverError::InvalidParameter);
+    }
+    return {};
+  }
+
+  /**
+   * @brief Sample subscribed feedback once and deliver significant changes
+   *
+   * @details
+   * Reads the union of the registers needed by all subscriptions (FB_I_AVG,
+   * FB_DC per subscribed channel, FB_VOLTAGE2 for VBAT) in one pipelined
+   * burst, independent of the number of subscribers. Call once per period.
+   * Average currents are converted to mA using the cached parallel state.
+   *
+   * @return DriverResult<uint8_t> Number of events delivered or queued
+   * @retval DriverError::NotInitialized Driver not initialized
+   */
+  [[nodiscard]] DriverResult<uint8_t> PollFeedback() noexcept;
+
+  /**
+   * @brief Take the oldest queued feedback event
+   * @return false if no event is queued
+   */
+  [[nodiscard]] bool PopFeedbackEvent(FeedbackEvent& event) noexcept {
+    return feedback_.PopEvent(event);
+  }
+
+  /**
+   * @brief Feedback events lost because the queue was full
+   */
+  [[nodiscard]] uint32_t GetDroppedFeedbackEvents() const noexcept {
+    return feedback_.DroppedEvents();
+  }
+#endif
+
+  //==========================================================================
+  // BUS QOS
+  //==========================================================================
+
+  /**
+   * @brief Configure per-class SPI frame budgets
+   *
+   * @details
+   * Each BusClass gets a token bucket of frames_per_second, up to burst_frames
+   * deep. Admission is decided at the first register access of each public
+   * call: a Telemetry or Maintenance call whose bucket is empty fails with
+   * DriverError::Deferred before touching the bus; Control and Safety calls
+   * are always admitted and only counted. The frames of an admitted call are
+   * charged as they are sent (a bucket may go into debt). All budgets at 0
+   * disable QoS (the default).
+   *
+   * @param config Budgets; bus_frames_per_second, if set, must cover their sum
+   *               so that every class can get its budget at the same time
+   * @return DriverResult<void> Success or error
+   * @retval DriverError::InvalidParameter Budgets exceed the bus capacity, or
+   *         budgets set without a time source (NowUs() returns 0)
+   */
+  [[nodiscard]] DriverResult<void> ConfigureBusQos(const BusQosConfig& config) noexcept;
+
+  /**
+   * @brief Select the traffic class of subsequent calls
+   *
+   * @details
+   * Calls run as BusClass::Control unless a client selects otherwise. Prefer
+   * BusClassScope, which restores the previous class on exit.
+   *
+   * @return The previous class
+   */
+  BusClass SetBusClass(BusClass bus_class) noexcept {
+    const BusClass previous = bus_class_;
+    bus_class_ = bus_class;
+    return previous;
+  }
+
+  /**
+   * @brief Admission and traffic counters of a class
+   */
+  [[nodiscard]] const BusClassStats& GetBusClassStats(BusClass bus_class) const noexcept {
+    return qos_.Stats(bus_class);
+  }
+
+  /**
+   * @brief Clear the admission and traffic counters of all classes
+   */
+  void ResetBusClassStats() noexcept {
+    qos_.ResetStats();
+  }
+
+#ifdef TLE92466ED_ENABLE_INTEGRITY
+  //==========================================================================
+  // RX INTEGRITY (TLE92466ED_ENABLE_INTEGRITY)
+  //==========================================================================
+
+  /**
+   * @brief Select how reply CRCs are verified
+   *
+   * @details
+   * IntegrityMode::Full (the default) verifies every reply before its value is
+   * used. IntegrityMode::Adaptive does the same during a qualification window
+   * of qualification_frames clean replies; afterwards telemetry replies
+   * (channel feedback, FB_VOLTAGE1/2) read by ReadRegister() and
+   * ReadRegisters() are returned at once and verified batch_frames at a time.
+   * CH_CTRL, diagnosis, fault and all other registers stay verified inline. A
+   * batched failure is logged and restarts qualification; the telemetry values
+   * it covers have already been returned. Only applies while CRC checking is
+   * enabled (see SetCrcEnabled()).
+   *
+   * Pending replies are verified before the new configuration takes effect.
+   *
+   * @retval DriverError::InvalidParameter batch_frames is 0 or above
+   *         IntegrityMonitor::MAX_BATCH (configuration unchanged)
+   * @retval DriverError::CRCError A pending reply failed verification (the new
+   *         configuration is applied)
+   */
+  [[nodiscard]] DriverResult<void> ConfigureIntegrity(const IntegrityConfig& config) noexcept;
+
+  /**
+   * @brief Verify the deferred telemetry replies now
+   *
+   * @details
+   * Call before acting on telemetry that must be known good, or at the end of a
+   * control cycle so that pending replies do not wait for a full batch.
+   *
+   * @retval DriverError::CRCError At least one deferred reply was corrupted
+   */
+  [[nodiscard]] DriverResult<void> VerifyPendingReplies() noexcept;
+
+  /**
+   * @brief Verification coverage: inline, batched, pending and unverified replies
+   */
+  [[nodiscard]] const IntegrityStats& GetIntegrityStats() const noexcept {
+    return integrity_.Stats();
+  }
+
+  /**
+   * @brief Clear the coverage counters (qualification and pending replies are kept)
+   */
+  void ResetIntegrityStats() noexcept {
+    integrity_.ResetStats();
+  }
+#endif // TLE92466ED_ENABLE_INTEGRITY
+
+#ifdef TLE92466ED_ENABLE_PROFILER
+  //==========================================================================
+  // REGISTER ACCESS PROFILER (TLE92466ED_ENABLE_PROFILER)
+  //==========================================================================
+
+  /**
+   * @brief Register access counters collected so far
+   */
+  [[nodiscard]] const RegisterProfiler& GetProfiler() const noexcept {
+    return profiler_;
+  }
+
+  /**
+   * @brief Clear the register access counters
+   */
+  void ResetProfiler() noexcept {
+    profiler_.Reset();
+  }
+
+  /**
+   * @brief Log per-API costs and the cache/poll-less/batch candidates
+   *
+   * @details
+   * Prints one line per profiled API (calls, reads, single-frame reads and
+   * writes per call) followed by RegisterProfiler::Advise() for the busiest
+   * registers. No bus traffic.
+   */
+  TLE92466ED_COLD void PrintProfileReport() const noexcept;
+#endif
+
+#ifdef TLE92466ED_ENABLE_TRACE
+  //==========================================================================
+  // CALL AND FRAME TRACE (TLE92466ED_ENABLE_TRACE)
+  //==========================================================================
+
+  /**
+   * @brief Trace recorded so far
+   *
+   * @details
+   * Dump it with TraceBuffer::Serialize() (e.g. to a file or a debug port) and
+   * convert it on the host with tools/trace_convert.
+   */
+  [[nodiscard]] const TraceBuffer& GetTrace() const noexcept {
+    return trace_;
+  }
+
+  /**
+   * @brief Drop all trace records
+   */
+  void ResetTrace() noexcept {
+    trace_.Reset();
+  }
+#endif
+
   //==========================================================================
   // GPIO CONTROL (Reset, Enable, Fault Status)
   //==========================================================================
@@ -910,8 +2039,8 @@ public:
    * @note If verify_crc is not explicitly provided, uses internal CRC enable state
    *       which tracks GLOBAL_CONFIG::CRC_EN. Set to false to override (e.g., during init).
    */
-  [[nodiscard]] DriverResult<uint32_t> ReadRegister(uint16_t address,
-                                                    bool verify_crc = false) noexcept;
+  [[nodiscard]] TLE92466ED_FORCE_INLINE DriverResult<uint32_t>
+  ReadRegister(uint16_t address, bool verify_crc = false) noexcept;
 
   /**
    * @brief Write 16-bit register
@@ -927,9 +2056,9 @@ public:
    *       if the read value doesn't match. Some registers may be write-only (e.g., GLOBAL_CONFIG),
    *       in which case verification will fail gracefully.
    */
-  [[nodiscard]] DriverResult<void> WriteRegister(uint16_t address, uint16_t value,
-                                                 bool verify_crc = false,
-                                                 bool verify_write = true) noexcept;
+  [[nodiscard]] TLE92466ED_FORCE_INLINE DriverResult<void>
+  WriteRegister(uint16_t address, uint16_t value, bool verify_crc = false,
+                bool verify_write = true) noexcept;
 
   /**
    * @brief Modify register bits
@@ -942,11 +2071,241 @@ public:
   [[nodiscard]] DriverResult<void> ModifyRegister(uint16_t address, uint16_t mask,
                                                   uint16_t value) noexcept;
 
+  /**
+   * @brief Read several registers in one pipelined burst
+   *
+   * @param addresses Register addresses (at most SpiInterface::MAX_BURST_REGISTERS)
+   * @param values Output values, same size as addresses
+   * @param verify_crc If true, force CRC verification (default: use CRC enable state)
+   * @return DriverResult<void> Success or error
+   *
+   * @note N registers cost N+1 SPI frames instead of 2N.
+   */
+  [[nodiscard]] TLE92466ED_FORCE_INLINE DriverResult<void>
+  ReadRegisters(std::span<const uint16_t> addresses, std::span<uint32_t> values,
+                bool verify_crc = false) noexcept;
+
 private:
   //==========================================================================
   // PRIVATE METHODS
   //==========================================================================
 
+  /**
+   * @brief Scope of a public API call (see TLE92466ED_API_ENTRY())
+   *
+   * @details
+   * Tracks the call nesting so that bus QoS admission covers the outermost
+   * call only, attributes accesses to it when the profiler is enabled, and
+   * records the call span when tracing is enabled.
+   */
+  class CallScope {
+  public:
+    CallScope(Driver& driver, [[maybe_unused]] const char* api) noexcept
+        : driver_(driver)
+#ifdef TLE92466ED_ENABLE_PROFILER
+          ,
+          api_scope_(driver.profiler_, api)
+#endif
+    {
+      if (driver_.call_depth_++ == 0) {
+        driver_.call_admitted_ = false;
+        driver_.call_deferred_ = false;
+      }
+#ifdef TLE92466ED_ENABLE_TRACE
+      driver_.trace_.Begin(api, driver_.comm_.NowUs());
+#endif
+    }
+    ~CallScope() noexcept {
+#ifdef TLE92466ED_ENABLE_TRACE
+      driver_.trace_.End(driver_.comm_.NowUs());
+#endif
+      --driver_.call_depth_;
+    }
+    CallScope(const CallScope&) = delete;
+    CallScope& operator=(const CallScope&) = delete;
+
+  private:
+    Driver& driver_; ///< Driver whose call is tracked
+#ifdef TLE92466ED_ENABLE_PROFILER
+    ApiScope api_scope_; ///< Profiler attribution
+#endif
+  };
+
+  /**
+   * @brief Bus QoS gate of the register access layer
+   *
+   * @details
+   * The first access of a call decides admission for the whole call, later
+   * accesses are only charged. Free when QoS is not configured.
+   *
+   * @param frames SPI frames the access is about to send
+   * @retval DriverError::Deferred Budget of the current class exhausted
+   */
+  [[nodiscard]] DriverResult<void> admitAccess(std::size_t frames) noexcept {
+    if (!qos_.Enabled()) [[likely]] {
+      return {};
+    }
+    if (!call_admitted_) {
+      if (call_deferred_ || !qos_.Admit(bus_class_, comm_.NowUs())) {
+        call_deferred_ = call_depth_ > 0; // The rest of the call fails without recounting
+        return std::unexpected(DriverError::Deferred);
+      }
+      call_admitted_ = call_depth_ > 0;
+    }
+    qos_.Charge(bus_class_, frames);
+    return {};
+  }
+
+  /**
+   * @brief true if reads need no QoS admission, reply deferral or recording
+   *
+   * @details
+   * ReadRegister() and ReadRegisters() then send their frames inline;
+   * otherwise they take the out-of-line full path.
+   */
+  [[nodiscard]] bool plainReads() const noexcept {
+#if defined(TLE92466ED_ENABLE_PROFILER) || defined(TLE92466ED_ENABLE_TRACE)
+    return false;
+#else
+    return !qos_.Enabled() && !(crc_enabled_ && integrityQualified());
+#endif
+  }
+
+  /**
+   * @brief true if writes need no QoS admission, lazy defaults, transition cancel or recording
+   */
+  [[nodiscard]] bool plainWrites() const noexcept {
+#if defined(TLE92466ED_ENABLE_PROFILER) || defined(TLE92466ED_ENABLE_TRACE)
+    return false;
+#else
+    return !qos_.Enabled() && pending_defaults_ == 0 && peak_hold_.ActiveMask() == 0;
+#endif
+  }
+
+  /**
+   * @brief ReadRegister() with admission, deferral and recording
+   */
+  [[nodiscard]] TLE92466ED_NOINLINE DriverResult<uint32_t>
+  readRegisterFull(uint16_t address, bool verify_crc) noexcept;
+
+  /**
+   * @brief WriteRegister() with admission, lazy defaults and recording
+   */
+  [[nodiscard]] TLE92466ED_NOINLINE DriverResult<void>
+  writeRegisterFull(uint16_t address, uint16_t value, bool verify_crc,
+                    bool verify_write) noexcept;
+
+  /**
+   * @brief ReadRegisters() with admission, deferral and recording
+   */
+  [[nodiscard]] TLE92466ED_NOINLINE DriverResult<void>
+  readRegistersFull(std::span<const uint16_t> addresses, std::span<uint32_t> values,
+                    bool verify_crc) noexcept;
+
+  /**
+   * @brief true once adaptive integrity may defer telemetry replies (false unless enabled)
+   */
+  [[nodiscard]] bool integrityQualified() const noexcept {
+#ifdef TLE92466ED_ENABLE_INTEGRITY
+    return integrity_.Stats().qualified;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * @brief true if the reply of @p address is verified later, in a batch (false unless enabled)
+   */
+  [[nodiscard]] bool defersReply([[maybe_unused]] uint16_t address) const noexcept {
+#ifdef TLE92466ED_ENABLE_INTEGRITY
+    return integrity_.Defers(address);
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * @brief Count inline-checked replies for the integrity statistics (no-op unless enabled)
+   */
+  void noteReplies([[maybe_unused]] std::size_t count,
+                   [[maybe_unused]] bool verified) noexcept {
+#ifdef TLE92466ED_ENABLE_INTEGRITY
+    integrity_.OnReplies(count, verified);
+#endif
+  }
+
+  /**
+   * @brief Map a comm error, counting CRC failures for the integrity statistics
+   */
+  [[nodiscard]] DriverError replyError(CommError error) noexcept {
+#ifdef TLE92466ED_ENABLE_INTEGRITY
+    if (error == CommError::CRCError) {
+      integrity_.OnInlineFailure();
+    }
+#endif
+    return mapCommError(error);
+  }
+
+  /**
+   * @brief Queue a deferred telemetry reply and verify the batch once it is full
+   *        (no-op unless enabled)
+   */
+  void deferReply([[maybe_unused]] uint32_t reply_word) noexcept {
+#ifdef TLE92466ED_ENABLE_INTEGRITY
+    if (integrity_.Defer(reply_word)) {
+      (void)verifyDeferred();
+    }
+#endif
+  }
+
+#ifdef TLE92466ED_ENABLE_INTEGRITY
+  /**
+   * @brief Verify the queued telemetry replies
+   * @return Number of corrupted replies (logged)
+   */
+  std::size_t verifyDeferred() noexcept;
+#endif
+
+  /**
+   * @brief Report a register read to the profiler and the trace (no-op unless enabled)
+   */
+  void recordRead([[maybe_unused]] uint16_t address, [[maybe_unused]] uint16_t value,
+                  [[maybe_unused]] bool burst) noexcept {
+#ifdef TLE92466ED_ENABLE_PROFILER
+    profiler_.RecordRead(address, value, burst);
+#endif
+#ifdef TLE92466ED_ENABLE_TRACE
+    trace_.Frame(false, address, value, comm_.NowUs());
+#endif
+  }
+
+  /**
+   * @brief Report a register write to the profiler and the trace (no-op unless enabled)
+   */
+  void recordWrite([[maybe_unused]] uint16_t address,
+                   [[maybe_unused]] uint16_t value) noexcept {
+#ifdef TLE92466ED_ENABLE_PROFILER
+    profiler_.RecordWrite(address, value);
+#endif
+#ifdef TLE92466ED_ENABLE_TRACE
+    trace_.Frame(true, address, value, comm_.NowUs());
+#endif
+  }
+
+  /**
+   * @brief Wait for a timing deadline (traced when enabled)
+   */
+  [[nodiscard]] CommResult<void> awaitDeadline(const TimingDeadline& deadline) noexcept {
+#ifdef TLE92466ED_ENABLE_TRACE
+    const uint64_t start = comm_.NowUs();
+    auto result = comm_.AwaitDeadline(deadline);
+    trace_.Wait(static_cast<uint8_t>(deadline.requirement), start, comm_.NowUs());
+    return result;
+#else
+    return comm_.AwaitDeadline(deadline);
+#endif
+  }
+
   /**
    * @brief Transfer SPI frame with CRC calculation and verification
    */
@@ -990,24 +2349,126 @@ private:
     return {};
   }
 
+  /// Number of register writes making up the default configuration
+  static constexpr uint8_t DEFAULT_CONFIG_STEPS = 3 + (3 * static_cast<uint8_t>(Channel::COUNT));
+  /// Leading steps of the default configuration that are global (the rest are per channel)
+  static constexpr uint8_t GLOBAL_DEFAULT_STEPS = 3;
+  /// Default configuration writes per channel
+  static constexpr uint8_t CHANNEL_DEFAULT_WRITES = 3;
+  /// Every channel default pending (bit 8 * write index + channel, see pending_defaults_)
+  static constexpr uint32_t ALL_CHANNEL_DEFAULTS = 0x003F3F3FU;
+
+  /**
+   * @brief One register write of a channel's default configuration
+   * @param index Write index (0 to CHANNEL_DEFAULT_WRITES - 1)
+   */
+  [[nodiscard]] static constexpr RegisterWrite channelDefaultWrite(Channel channel,
+                                                                   uint8_t index) noexcept {
+    const uint16_t base = GetChannelBase(channel);
+    switch (index) {
+    case 0:
+      return {static_cast<uint16_t>(base + ChannelReg::MODE),
+              static_cast<uint16_t>(ChannelMode::ICC)};
+    case 1:
+      return {static_cast<uint16_t>(base + ChannelReg::CH_CONFIG), CH_CONFIG::SLEWR_2V5_US};
+    default:
+      return {static_cast<uint16_t>(base + ChannelReg::SETPOINT), 0};
+    }
+  }
+
+  /**
+   * @brief Channels with at least one default still pending (bit n = CHn)
+   */
+  [[nodiscard]] uint8_t pendingChannels() const noexcept {
+    return static_cast<uint8_t>(
+        (pending_defaults_ | (pending_defaults_ >> 8) | (pending_defaults_ >> 16)) &
+        CH_CTRL::ALL_CH_MASK);
+  }
+
+  /**
+   * @brief Pending-defaults bit of the channel owning a register (0 if none)
+   */
+  [[nodiscard]] uint8_t pendingDefaultsOf(uint16_t address) const noexcept {
+    for (uint8_t ch = 0; ch < 6; ++ch) {
+      if ((address & 0xFFF0U) == GetChannelBase(static_cast<Channel>(ch))) {
+        return pendingChannels() & static_cast<uint8_t>(1U << ch);
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * @brief Collect the pending default writes of channels, skipping registers in written
+   *
+   * @details
+   * The MODE default is held back in Mission Mode, where MODE is not writable.
+   *
+   * @return Number of writes stored in out
+   */
+  [[nodiscard]] std::size_t collectChannelDefaults(uint8_t channels,
+                                                   std::span<const RegisterWrite> written,
+                                                   std::span<RegisterWrite> out) const noexcept;
+
+  /**
+   * @brief Mark the defaults of registers written by a burst as no longer pending
+   */
+  void clearPendingDefaults(std::span<const RegisterWrite> written) noexcept;
+
+  /**
+   * @brief Default value of a register whose lazy channel default is still pending
+   * @return true (value set) if the register has a pending default the next write would send
+   */
+  [[nodiscard]] bool pendingDefaultValue(uint16_t address, uint16_t& value) const noexcept;
+
+  /**
+   * @brief Write a register burst, preceded by the pending defaults of the channels it touches
+   *
+   * @details
+   * Charges the bus class, sends everything in one WriteMulti() transaction and
+   * records the frames. A MODE default waits for Config Mode.
+   */
+  [[nodiscard]] DriverResult<void> writeBurst(std::span<const RegisterWrite> writes,
+                                              bool verify_crc) noexcept;
+
+  /**
+   * @brief Send the pending defaults of channels about to be enabled
+   * @retval DriverError::WrongMode A channel's MODE default is pending in Mission Mode
+   */
+  [[nodiscard]] DriverResult<void> applyPendingDefaults(uint8_t enable_mask) noexcept;
+
   /**
-   * @brief Apply default configuration after initialization
+   * @brief Apply one register write of the default configuration (used during Init)
+   * @param step Write index (0 to DEFAULT_CONFIG_STEPS - 1)
    */
-  [[nodiscard]] DriverResult<void> applyDefaultConfig() noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void> applyDefaultConfigStep(uint8_t step) noexcept;
+
+  /// Number of GLOBAL_DIAGx registers cleared by clearFaultsInternal()
+  static constexpr uint8_t FAULT_CLEAR_COUNT = 3;
 
   /**
    * @brief Clear faults without checking initialization status (used during Init)
    */
   [[nodiscard]] DriverResult<void> clearFaultsInternal() noexcept;
 
+  /**
+   * @brief Clear one GLOBAL_DIAGx register (index 0-2)
+   */
+  [[nodiscard]] DriverResult<void> clearFaultRegister(uint8_t index) noexcept;
+
+  /**
+   * @brief Clear the VBAT_UV/VBAT_OV latches after a threshold change (logs on failure)
+   */
+  TLE92466ED_COLD void clearVbatFaultLatch() noexcept;
+
   /**
    * @brief Set VBAT thresholds without checking initialization status (used during Init)
    * @param uv_voltage Under-voltage threshold in volts
    * @param ov_voltage Over-voltage threshold in volts
+   * @param clear_latch Clear the VBAT fault latches afterwards (see clearVbatFaultLatch())
    * @return DriverResult<void> Success or error
    */
-  [[nodiscard]] DriverResult<void> setVbatThresholdsInternal(float uv_voltage,
-                                                             float ov_voltage) noexcept;
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void>
+  setVbatThresholdsInternal(float uv_voltage, float ov_voltage, bool clear_latch = true) noexcept;
 
   /**
    * @brief Parse SPI status from reply frame
@@ -1028,7 +2489,285 @@ private:
    * Reads and logs the CLK_DIV register to help diagnose clock-related
    * critical faults. This is called during initialization.
    */
-  void diagnoseClockConfiguration() noexcept;
+  TLE92466ED_COLD void diagnoseClockConfiguration() noexcept;
+
+  /**
+   * @brief Read back a written register and log the outcome (WriteRegister verify path)
+   */
+  TLE92466ED_HOT void verifyWrite(uint16_t address, uint16_t value, bool verify_crc,
+                                  const TimingDeadline& readback_deadline) noexcept;
+
+  /**
+   * @brief Log a write verification mismatch, classifying known register quirks
+   */
+  TLE92466ED_COLD void reportWriteMismatch(uint16_t address, uint16_t written,
+                                           uint16_t read) noexcept;
+
+#ifdef TLE92466ED_ENABLE_THERMAL
+  /**
+   * @brief Log a setpoint capped by thermal derating
+   */
+  TLE92466ED_COLD void reportThermalCap(Channel channel, uint16_t requested_ma,
+                                        uint16_t allowed_ma) noexcept;
+#endif
+
+  /**
+   * @brief Map a CommInterface error to the driver error space
+   */
+  [[nodiscard]] static constexpr DriverError mapCommError(CommError error) noexcept {
+    switch (error) {
+    case CommError::Timeout:
+      return DriverError::TimeoutError;
+    case CommError::CRCError:
+      return DriverError::CRCError;
+    case CommError::InvalidParameter:
+      return DriverError::InvalidParameter;
+    default:
+      return DriverError::HardwareError;
+    }
+  }
+
+  /**
+   * @brief Write the setpoints of a synchronized activation and compute its CH_CTRL value
+   *
+   * @details
+   * With SyncRelease::SharedEnable the CH_CTRL value is also written (EN is low).
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void>
+  stageActivation(const SyncActivation& activation, SyncRelease release,
+                  uint16_t& ch_ctrl) noexcept;
+
+  /**
+   * @brief Release loop of SyncRelease::FrameBurst: send the CH_CTRL frames, then collect replies
+   *
+   * @details
+   * Fills SyncReport::released_us, skew_us and switched_mask.
+   *
+   * @return First failure, DriverError::None if every device switched
+   */
+  [[nodiscard]] TLE92466ED_HOT static DriverError
+  releaseFrameBurst(std::span<Driver* const> devices, std::span<const uint32_t> frames,
+                    std::span<const uint16_t> ch_ctrl, SyncReport& report) noexcept;
+
+  /**
+   * @brief Log the outcome of a synchronized activation
+   */
+  TLE92466ED_COLD void reportSyncActivation(const SyncReport& report) noexcept;
+
+  /**
+   * @brief Update register caches after a write that bypassed the setters
+   */
+  void noteRegisterWritten(uint16_t address, uint16_t value) noexcept;
+
+  /**
+   * @brief Drop the pending peak-to-hold transition of a channel whose SETPOINT is written
+   */
+  void cancelPeakHoldOn(uint16_t address) noexcept {
+    if (peak_hold_.ActiveMask() == 0) [[likely]] {
+      return;
+    }
+    for (uint8_t ch = 0; ch < 6; ++ch) {
+      if (address == GetChannelRegister(static_cast<Channel>(ch), ChannelReg::SETPOINT)) {
+        peak_hold_.Cancel(static_cast<uint8_t>(1U << ch));
+      }
+    }
+  }
+
+  /**
+   * @brief Check parallel operation from the CH_CTRL cache (no bus access)
+   */
+  [[nodiscard]] bool isChannelParallelCached(Channel channel) const noexcept;
+
+  /**
+   * @brief Report the effective output enable mask to the usage accumulator (no-op unless enabled)
+   */
+  void noteActuation() noexcept {
+#ifdef TLE92466ED_ENABLE_USAGE
+    // Outputs only drive in Mission Mode; Config Mode forces all channels off
+    const auto mask =
+        static_cast<uint8_t>(mission_mode_ ? (ch_ctrl_cache_ & CH_CTRL::ALL_CH_MASK) : 0U);
+    usage_.OnEnableMask(mask, comm_.NowUs());
+#endif
+  }
+
+  /**
+   * @brief Report the cached setpoints of @p channel_mask to the usage accumulator
+   *        (no-op unless enabled)
+   */
+  void noteSetpoints([[maybe_unused]] uint8_t channel_mask) noexcept {
+#ifdef TLE92466ED_ENABLE_USAGE
+    const uint64_t now = comm_.NowUs();
+    for (uint8_t ch = 0; ch < 6; ++ch) {
+      if ((channel_mask & (1U << ch)) != 0) {
+        usage_.OnSetpoint(ch, channel_setpoints_[ch], now);
+      }
+    }
+#endif
+  }
+
+  /**
+   * @brief Report a raw FB_I_AVG sample to the usage accumulator (no-op unless enabled)
+   */
+  void noteFeedbackSample([[maybe_unused]] uint8_t channel_index,
+                          [[maybe_unused]] uint16_t raw) noexcept {
+#ifdef TLE92466ED_ENABLE_USAGE
+    if (usage_feedback_enabled_) {
+      usage_.OnFeedbackSample(channel_index, raw);
+    }
+#endif
+  }
+
+  //==========================================================================
+  // RESUMABLE OPERATION ENGINE
+  //==========================================================================
+
+  /**
+   * @brief Position inside a resumable operation (each phase is at most one register access)
+   */
+  enum class OpPhase : uint8_t {
+    InitReset,           ///< comm_.Init(), EN low, RESN low
+    InitResetPulse,      ///< Wait for the RESN pulse deadline
+    InitRelease,         ///< RESN high
+    InitResetRecovery,   ///< Wait for the reset recovery deadline
+    InitClock,           ///< CLK_DIV diagnosis
+    InitVerify,          ///< ICVID check
+    InitDefaults,        ///< Default configuration (index = applyDefaultConfigStep() step)
+    InitClearFaults,     ///< Clear GLOBAL_DIAGx (index = clearFaultRegister() index)
+    InitFinish,          ///< Reset cached state
+    FaultRead,           ///< Fault register scan (index = faultScanAddress() position)
+    FaultSummary,        ///< Derive has_fault/any_fault
+    PrintVoltages,       ///< VBAT/VIO/VDD feedback (index = supply)
+    PrintVbatThresholds, ///< VBAT_TH
+    PrintVioMode,        ///< GLOBAL_CONFIG VIO_SEL and fixed thresholds
+    PrintReport,         ///< Log the report
+    ConfigParallel,      ///< ConfigureChannel step 1: parallel detection
+    ConfigMode,          ///< ConfigureChannel step 2: MODE, SETPOINT and CH_CONFIG
+    ConfigOlsgWarning,   ///< ConfigureChannel step 3a: OLSG warning enable
+    ConfigPwm,           ///< ConfigureChannel step 4: PERIOD
+    ConfigDither,        ///< ConfigureChannel step 5: DITHER_CTRL/DITHER_STEP
+    ConfigDeepDither,    ///< ConfigureChannel step 5a: deep dither
+    Done                 ///< Operation complete
+  };
+
+  /**
+   * @brief Supply measurements and thresholds printed next to voltage faults
+   */
+  struct SupplySnapshot {
+    uint16_t vbat_mv{0};       ///< VBAT feedback (mV)
+    uint16_t vio_mv{0};        ///< VIO feedback (mV)
+    uint16_t vdd_mv{0};        ///< VDD feedback (mV)
+    uint16_t vbat_uv_th_mv{0}; ///< VBAT UV threshold (mV)
+    uint16_t vbat_ov_th_mv{0}; ///< VBAT OV threshold (mV)
+    uint16_t vio_uv_th_mv{0};  ///< VIO UV threshold, fixed hardware estimate (mV)
+    uint16_t vio_ov_th_mv{0};  ///< VIO OV threshold, fixed hardware estimate (mV)
+    uint16_t vdd_uv_th_mv{0};  ///< VDD UV threshold, fixed hardware estimate (mV)
+    uint16_t vdd_ov_th_mv{0};  ///< VDD OV threshold, fixed hardware estimate (mV)
+  };
+
+  /**
+   * @brief State of a resumable operation
+   */
+  struct OperationState {
+    Operation kind{Operation::None};  ///< Operation in progress
+    OpPhase phase{OpPhase::Done};     ///< Next phase to run
+    uint8_t index{0};                 ///< Position within indexed phases
+    bool parallel{false};             ///< ConfigureChannel: detected parallel operation
+    Channel channel{Channel::CH0};    ///< ConfigureChannel: target channel
+    TimingDeadline deadline{};        ///< Init: pending reset deadline
+    ChannelConfig config{};           ///< ConfigureChannel: requested configuration
+    FaultReport report{};             ///< GetAllFaults/PrintAllFaults: collected faults
+    SupplySnapshot supply{};          ///< PrintAllFaults: supply context
+  };
+
+  static constexpr uint8_t FRAMES_READ = 2;           ///< ReadRegister(): command + reply
+  static constexpr uint8_t FRAMES_VERIFIED_WRITE = 4; ///< WriteRegister() with readback
+  static constexpr uint8_t FRAMES_MODIFY = 6;         ///< ModifyRegister(): read + verified write
+  static constexpr uint8_t FRAMES_CHANNEL_CORE = 8;   ///< 3-register burst + readback burst
+
+  /// Fault registers read by GetAllFaults()
+  static constexpr uint8_t FAULT_SCAN_COUNT = 4 + (2 * static_cast<uint8_t>(Channel::COUNT));
+
+  /**
+   * @brief Address of a fault scan position
+   *
+   * @details
+   * GLOBAL_DIAG0, GLOBAL_DIAG1, GLOBAL_DIAG2, FB_STAT, then DIAG_ERR_CHGRx and
+   * DIAG_WARN_CHGRx for each channel in turn.
+   */
+  [[nodiscard]] static constexpr uint16_t faultScanAddress(uint8_t index) noexcept {
+    switch (index) {
+    case 0:
+      return CentralReg::GLOBAL_DIAG0;
+    case 1:
+      return CentralReg::GLOBAL_DIAG1;
+    case 2:
+      return CentralReg::GLOBAL_DIAG2;
+    case 3:
+      return CentralReg::FB_STAT;
+    default: {
+      const auto ch = static_cast<uint16_t>((index - 4) / 2);
+      return ((index - 4) % 2 == 0) ? CentralReg::DIAG_ERR_CHGR0 + ch
+                                    : CentralReg::DIAG_WARN_CHGR0 + ch;
+    }
+    }
+  }
+
+  /**
+   * @brief Decode one fault scan register into the report
+   */
+  static void decodeFaultRegister(FaultReport& report, uint8_t index, uint16_t value) noexcept;
+
+  /**
+   * @brief Derive per-channel has_fault and the global any_fault flag
+   */
+  static void summarizeFaults(FaultReport& report) noexcept;
+
+  /**
+   * @brief Log a fault report (PrintAllFaults() output)
+   */
+  TLE92466ED_COLD void printFaultReport(const FaultReport& report,
+                                        const SupplySnapshot& supply) noexcept;
+
+  /**
+   * @brief Prepare an operation state (argument checks happen here)
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void>
+  beginOperation(OperationState& op, Operation kind, Channel channel = Channel::CH0,
+                 const ChannelConfig& config = {}) noexcept;
+
+  /**
+   * @brief Run phases until the frame budget is spent, a deadline is pending or the end
+   * @param blocking Wait for deadlines instead of yielding
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<StepStatus>
+  advanceOperation(OperationState& op, uint16_t max_frames, bool blocking) noexcept;
+
+  /**
+   * @brief Run an operation to completion (blocking API)
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<void> runOperation(OperationState& op) noexcept;
+
+  /**
+   * @brief SPI frames the next phase of an operation costs
+   */
+  [[nodiscard]] static uint8_t phaseFrames(const OperationState& op) noexcept;
+
+  /**
+   * @brief Run one Init phase
+   * @return true if the phase completed, false if a deadline is still pending
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<bool> runInitPhase(OperationState& op,
+                                                                bool blocking) noexcept;
+
+  /**
+   * @brief Run one GetAllFaults/PrintAllFaults phase
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<bool> runFaultPhase(OperationState& op) noexcept;
+
+  /**
+   * @brief Run one ConfigureChannel phase
+   */
+  [[nodiscard]] TLE92466ED_COLD DriverResult<bool> runChannelPhase(OperationState& op) noexcept;
 
   //==========================================================================
   // MEMBER VARIABLES
@@ -1041,7 +2780,42 @@ private:
   bool vio_5v_mode_{false};       ///< VIO mode state (tracks GLOBAL_CONFIG::VIO_SEL, false=3.3V, true=5V)
   uint16_t ch_ctrl_cache_{0U}; ///< Cached CH_CTRL register value (reads return 0x0000)
   uint16_t channel_enable_cache_{0U};             ///< Cached channel enable state
+  bool lazy_channel_init_{false};     ///< Init() defers channel defaults to first use
+  uint32_t pending_defaults_{0};      ///< Unwritten defaults (bit 8 * write index + channel)
   std::array<uint16_t, 6> channel_setpoints_; ///< Cached current setpoints
+  bool coalesce_setpoints_{false};            ///< Stage setpoints until Flush()
+  uint8_t staged_setpoint_mask_{0};           ///< Channels with staged setpoints
+  uint32_t telemetry_count_{0};               ///< Telemetry captures made
+  BusQos qos_{};                              ///< Per-class frame budgets
+  BusClass bus_class_{BusClass::Control};     ///< Class of the calls in progress
+  PeakHoldScheduler peak_hold_{};             ///< Peak-and-hold profiles and transitions
+  uint8_t call_depth_{0};                     ///< Nesting of public API calls
+  bool call_admitted_{false};                 ///< Outermost call passed admission
+  bool call_deferred_{false};                 ///< Outermost call was deferred
+#ifdef TLE92466ED_ENABLE_USAGE
+  UsageAccumulator usage_{};                  ///< Per-channel actuation usage histogram
+  bool usage_feedback_enabled_{false};        ///< Record FB_I_AVG samples into usage_
+#endif
+#ifdef TLE92466ED_ENABLE_THERMAL
+  ThermalEstimator thermal_{};                ///< Per-channel thermal model
+  uint64_t thermal_last_us_{0};               ///< Timestamp of the last thermal update
+  bool thermal_derating_{false};              ///< Cap setpoints from thermal_ predictions
+#endif
+#ifdef TLE92466ED_ENABLE_RESUMABLE_OPS
+  OperationState op_{};                       ///< Resumable operation driven by Step()
+#endif
+#ifdef TLE92466ED_ENABLE_INTEGRITY
+  IntegrityMonitor integrity_{};              ///< RX CRC policy and coverage
+#endif
+#ifdef TLE92466ED_ENABLE_FEEDBACK
+  FeedbackMonitor feedback_{};                ///< Feedback subscriptions
+#endif
+#ifdef TLE92466ED_ENABLE_PROFILER
+  RegisterProfiler profiler_{};               ///< Register access profiler
+#endif
+#ifdef TLE92466ED_ENABLE_TRACE
+  TraceBuffer trace_{};                       ///< Call and frame trace
+#endif
 };
 
 // Include template implementation (must be inside namespace before it closes)
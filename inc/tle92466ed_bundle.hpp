@@ -0,0 +1,227 @@
+/**
+ * @file tle92466ed_bundle.hpp
+ * @brief Versioned binary configuration bundle for TLE92466ED driver
+ *
+ * @details
+ * A configuration bundle holds pre-resolved register images for any number of
+ * device variants. Each variant is stored as ready-to-send SPI write frames
+ * (CRC included) followed by one NOP read frame, so Driver::ApplyConfigBundle()
+ * clocks the frames straight out of flash (or an mmap'd file) in a single
+ * TransferMulti() burst: no parsing, no intermediate ChannelConfig/GlobalConfig
+ * structs, no copy of the frames.
+ *
+ * Layout (little-endian, every offset 4-byte aligned):
+ * @code
+ *   ConfigBundleHeader                     24 bytes
+ *   ConfigBundleVariant[variant_count]     32 bytes each
+ *   uint32_t frames[...]                   per variant: writes + 1 NOP read
+ * @endcode
+ * The header CRC-32 covers the whole bundle except the CRC field itself.
+ *
+ * Bundles are generated on the host from a text description with
+ * tools/config_bundle (which resolves the description through the real driver).
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_BUNDLE_HPP
+#define TLE92466ED_BUNDLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "tle92466ed_spi_interface.hpp"
+#include "tle92466ed_registers.hpp"
+
+namespace tle92466ed {
+
+/**
+ * @brief Bundle header
+ */
+struct ConfigBundleHeader {
+  static constexpr uint32_t MAGIC = 0x444E4254; ///< "TBND" as little-endian bytes
+  static constexpr uint16_t VERSION = 1;        ///< Bundle format version
+
+  uint32_t magic{MAGIC};      ///< Bundle identification
+  uint16_t version{VERSION};  ///< Bundle format version
+  uint16_t variant_count{0};  ///< Entries in the variant table
+  uint32_t total_size{0};     ///< Bundle size in bytes (header included)
+  uint32_t revision{0};       ///< Content revision chosen by the bundle author
+  uint32_t reserved{0};       ///< Reserved (0)
+  uint32_t crc{0};            ///< CRC-32 over the bundle without this field
+};
+
+/**
+ * @brief Variant table entry
+ */
+struct ConfigBundleVariant {
+  static constexpr std::size_t NAME_SIZE = 16; ///< Name bytes (NUL-padded)
+
+  uint32_t id{0};                 ///< Variant ID (selected at boot)
+  char name[NAME_SIZE]{};         ///< Human-readable name
+  uint32_t frame_offset{0};       ///< Offset of the first frame from the bundle start
+  uint16_t frame_count{0};        ///< Frames including the trailing NOP read
+  uint16_t flags{0};              ///< Reserved (0)
+  uint32_t reserved{0};           ///< Reserved (0)
+};
+
+static_assert(sizeof(ConfigBundleHeader) == 24, "Bundle header layout is part of the format");
+static_assert(sizeof(ConfigBundleVariant) == 32, "Variant entry layout is part of the format");
+
+/**
+ * @brief Read-only, zero-copy view of a configuration bundle
+ *
+ * @details
+ * The constructor validates the bundle once (header, CRC, and that every
+ * variant consists of CRC-correct write frames ending in a NOP read); all
+ * accessors then read the data in place. The viewed memory must stay mapped
+ * and 4-byte aligned for the lifetime of the view.
+ */
+class ConfigBundleView {
+public:
+  static constexpr std::size_t MAX_FRAMES = 128; ///< Frames per variant (one burst)
+
+  /**
+   * @brief NOP read frame that terminates every variant
+   */
+  [[nodiscard]] static uint32_t NopFrame() noexcept {
+    SPIFrame frame = SPIFrame::MakeRead(0);
+    frame.tx_fields.crc = CalculateFrameCrc(frame);
+    return frame.word;
+  }
+
+  /**
+   * @brief CRC-32 of a bundle image as stored in ConfigBundleHeader::crc
+   */
+  [[nodiscard]] static uint32_t ComputeCrc(std::span<const uint8_t> image) noexcept {
+    const uint32_t crc = UpdateCrc32(0, image.data(), offsetof(ConfigBundleHeader, crc));
+    return UpdateCrc32(crc, image.data() + sizeof(ConfigBundleHeader),
+                       image.size() - sizeof(ConfigBundleHeader));
+  }
+
+  ConfigBundleView() noexcept = default;
+
+  /**
+   * @brief Validate and view a bundle image
+   * @param data Bundle bytes (e.g. a flash partition or an mmap'd file)
+   */
+  explicit ConfigBundleView(std::span<const uint8_t> data) noexcept {
+    if (validate(data)) {
+      data_ = data;
+      data_ = data_.first(header().total_size);
+      valid_ = true;
+    }
+  }
+
+  /**
+   * @brief true if the bundle passed validation
+   */
+  [[nodiscard]] bool IsValid() const noexcept {
+    return valid_;
+  }
+
+  /**
+   * @brief Content revision (0 if invalid)
+   */
+  [[nodiscard]] uint32_t Revision() const noexcept {
+    return valid_ ? header().revision : 0;
+  }
+
+  /**
+   * @brief Number of variants (0 if invalid)
+   */
+  [[nodiscard]] uint16_t VariantCount() const noexcept {
+    return valid_ ? header().variant_count : 0;
+  }
+
+  /**
+   * @brief Variant table entry by position
+   * @return nullptr if out of range
+   */
+  [[nodiscard]] const ConfigBundleVariant* GetVariant(std::size_t index) const noexcept {
+    return index < VariantCount() ? variants(data_) + index : nullptr;
+  }
+
+  /**
+   * @brief Variant table entry by ID
+   * @return nullptr if the bundle has no such variant
+   */
+  [[nodiscard]] const ConfigBundleVariant* FindVariant(uint32_t id) const noexcept {
+    for (std::size_t i = 0; i < VariantCount(); ++i) {
+      if (variants(data_)[i].id == id) {
+        return variants(data_) + i;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Frames of a variant, in place (writes followed by the NOP read)
+   */
+  [[nodiscard]] std::span<const uint32_t>
+  Frames(const ConfigBundleVariant& variant) const noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) - frames are stored as words
+    return {reinterpret_cast<const uint32_t*>(data_.data() + variant.frame_offset),
+            variant.frame_count};
+  }
+
+private:
+  [[nodiscard]] const ConfigBundleHeader& header() const noexcept {
+    return *reinterpret_cast<const ConfigBundleHeader*>(data_.data());
+  }
+
+  [[nodiscard]] static const ConfigBundleVariant*
+  variants(std::span<const uint8_t> data) noexcept {
+    return reinterpret_cast<const ConfigBundleVariant*>(data.data() + sizeof(ConfigBundleHeader));
+  }
+
+  [[nodiscard]] static bool validate(std::span<const uint8_t> data) noexcept {
+    if (data.size() < sizeof(ConfigBundleHeader) ||
+        reinterpret_cast<std::uintptr_t>(data.data()) % alignof(uint32_t) != 0) {
+      return false;
+    }
+    const auto& head = *reinterpret_cast<const ConfigBundleHeader*>(data.data());
+    const std::size_t table_end =
+        sizeof(ConfigBundleHeader) + (head.variant_count * sizeof(ConfigBundleVariant));
+    if (head.magic != ConfigBundleHeader::MAGIC || head.version != ConfigBundleHeader::VERSION ||
+        head.total_size > data.size() || head.total_size < table_end) {
+      return false;
+    }
+    const auto image = data.first(head.total_size);
+    if (ComputeCrc(image) != head.crc) {
+      return false;
+    }
+
+    const uint32_t nop = NopFrame();
+    for (std::size_t i = 0; i < head.variant_count; ++i) {
+      const auto& variant = variants(image)[i];
+      const std::size_t end = variant.frame_offset + (variant.frame_count * sizeof(uint32_t));
+      if (variant.frame_offset % alignof(uint32_t) != 0 || variant.frame_offset < table_end ||
+          end > image.size() || variant.frame_count < 2 || variant.frame_count > MAX_FRAMES) {
+        return false;
+      }
+      const auto* frames = reinterpret_cast<const uint32_t*>(image.data() + variant.frame_offset);
+      for (std::size_t f = 0; f + 1 < variant.frame_count; ++f) {
+        SPIFrame frame{};
+        frame.word = frames[f];
+        if (frame.tx_fields.rw != 1 || !VerifyFrameCrc(frame)) {
+          return false;
+        }
+      }
+      if (frames[variant.frame_count - 1] != nop) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::span<const uint8_t> data_{}; ///< Validated bundle image
+  bool valid_{false};               ///< Validation result
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_BUNDLE_HPP
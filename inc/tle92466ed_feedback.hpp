@@ -0,0 +1,264 @@
+/**
+ * @file tle92466ed_feedback.hpp
+ * @brief Report-by-exception feedback subscriptions for TLE92466ED driver
+ *
+ * @details
+ * Consumers that poll GetAverageCurrent()/GetDutyCycle()/GetVbatVoltage() spend
+ * bus time even when nothing changed, and N consumers of the same channel cost
+ * N reads. FeedbackMonitor inverts this: consumers register a deadband and/or a
+ * threshold per feedback quantity, Driver::PollFeedback() samples the union of
+ * the required registers once in one pipelined burst, and only significant
+ * changes are delivered (callback or event queue). The driver holds a
+ * FeedbackMonitor only with TLE92466ED_ENABLE_FEEDBACK defined.
+ *
+ * Cost per poll:
+ * - Bus: one frame per distinct source register plus one (at most 13 + 1)
+ * - CPU: one comparison per subscription
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_FEEDBACK_HPP
+#define TLE92466ED_FEEDBACK_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "tle92466ed_spi_interface.hpp"
+#include "tle92466ed_registers.hpp"
+
+namespace tle92466ed {
+
+/**
+ * @brief Feedback quantity a subscription watches
+ */
+enum class FeedbackQuantity : uint8_t {
+  AverageCurrent = 0, ///< FB_I_AVG of a channel (mA)
+  DutyCycle,          ///< FB_DC of a channel (raw value)
+  Vbat                ///< VBAT from FB_VOLTAGE2 (mV), channel ignored
+};
+
+struct FeedbackEvent;
+
+/**
+ * @brief Feedback event callback
+ *
+ * @details
+ * Called from Driver::PollFeedback(); keep it short.
+ */
+using FeedbackCallback = void (*)(const FeedbackEvent& event, void* context);
+
+/**
+ * @brief Subscription parameters
+ *
+ * @details
+ * An event is delivered
+ * - on the first poll after subscribing (initial value),
+ * - when the value moved by at least deadband since the last delivered event
+ *   (deadband 1 = every change, 0 = disabled),
+ * - when the value crosses threshold in either direction (if use_threshold).
+ */
+struct FeedbackSubscription {
+  FeedbackQuantity quantity{FeedbackQuantity::AverageCurrent}; ///< Watched quantity
+  Channel channel{Channel::CH0};      ///< Channel (AverageCurrent/DutyCycle)
+  uint16_t deadband{0};               ///< Minimum change to report (0 = disabled)
+  uint16_t threshold{0};              ///< Level whose crossing is reported
+  bool use_threshold{false};          ///< Enable threshold crossing events
+  FeedbackCallback callback{nullptr}; ///< Event callback (nullptr = queue events)
+  void* context{nullptr};             ///< Passed to callback
+};
+
+/**
+ * @brief Delivered feedback event
+ */
+struct FeedbackEvent {
+  uint64_t timestamp_us{0};                                    ///< Poll time (0 = no time source)
+  uint8_t subscription{0};                                     ///< Subscription ID
+  FeedbackQuantity quantity{FeedbackQuantity::AverageCurrent}; ///< Watched quantity
+  Channel channel{Channel::CH0};                               ///< Channel of the quantity
+  uint16_t value{0};                                           ///< New value
+  uint16_t previous{0};                                        ///< Last delivered value
+  bool initial{false};                                         ///< First event of the subscription
+  bool threshold_crossed{false};                               ///< Raised by a threshold crossing
+};
+
+/**
+ * @brief Subscription table, change detection and event queue
+ *
+ * @details
+ * Sources are numbered 0-5 (FB_I_AVG CH0-CH5), 6-11 (FB_DC CH0-CH5) and 12
+ * (VBAT). The driver samples the sources in SourceMask() and hands the values
+ * to Evaluate().
+ */
+class FeedbackMonitor {
+public:
+  static constexpr std::size_t MAX_SUBSCRIPTIONS = 16; ///< Subscription table size
+  static constexpr std::size_t QUEUE_DEPTH = 32;       ///< Queued events (no callback)
+  static constexpr std::size_t SOURCE_COUNT = 13;      ///< Distinct feedback sources
+  static constexpr uint8_t VBAT_SOURCE = 12;           ///< Source index of VBAT
+
+  /**
+   * @brief Source index of a quantity
+   */
+  [[nodiscard]] static constexpr uint8_t SourceIndex(FeedbackQuantity quantity,
+                                                     Channel channel) noexcept {
+    switch (quantity) {
+      case FeedbackQuantity::AverageCurrent:
+        return ToIndex(channel);
+      case FeedbackQuantity::DutyCycle:
+        return static_cast<uint8_t>(6 + ToIndex(channel));
+      default:
+        return VBAT_SOURCE;
+    }
+  }
+
+  /**
+   * @brief Add a subscription
+   *
+   * @param subscription Parameters (channel must be valid for per-channel quantities)
+   * @param id Assigned subscription ID
+   * @return false if the table is full or the subscription reports nothing
+   */
+  [[nodiscard]] bool Subscribe(const FeedbackSubscription& subscription, uint8_t& id) noexcept {
+    if (subscription.deadband == 0 && !subscription.use_threshold) {
+      return false;
+    }
+    for (std::size_t i = 0; i < MAX_SUBSCRIPTIONS; ++i) {
+      if (!entries_[i].active) {
+        entries_[i] = Entry{subscription, 0, false, true, true};
+        id = static_cast<uint8_t>(i);
+        updateSourceMask();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Remove a subscription
+   * @return false if the ID is not active
+   */
+  bool Unsubscribe(uint8_t id) noexcept {
+    if (id >= MAX_SUBSCRIPTIONS || !entries_[id].active) {
+      return false;
+    }
+    entries_[id].active = false;
+    updateSourceMask();
+    return true;
+  }
+
+  /**
+   * @brief Sources needed by the active subscriptions (bit n = source n)
+   */
+  [[nodiscard]] uint16_t SourceMask() const noexcept {
+    return source_mask_;
+  }
+
+  /**
+   * @brief Check all subscriptions against freshly sampled sources
+   *
+   * @param values Sampled values, indexed by source (only SourceMask() bits are read)
+   * @param timestamp_us Poll time
+   * @return Number of events delivered or queued
+   */
+  uint8_t Evaluate(const std::array<uint16_t, SOURCE_COUNT>& values,
+                   uint64_t timestamp_us) noexcept {
+    uint8_t events = 0;
+    for (std::size_t i = 0; i < MAX_SUBSCRIPTIONS; ++i) {
+      auto& entry = entries_[i];
+      if (!entry.active) {
+        continue;
+      }
+      const auto& sub = entry.subscription;
+      const uint16_t value = values[SourceIndex(sub.quantity, sub.channel)];
+      const bool above = sub.use_threshold && value >= sub.threshold;
+
+      FeedbackEvent event{timestamp_us, static_cast<uint8_t>(i), sub.quantity, sub.channel,
+                          value,        entry.last_value,        entry.pending_initial, false};
+      if (entry.pending_initial) {
+        event.previous = value;
+      } else if (sub.use_threshold && above != entry.above) {
+        event.threshold_crossed = true;
+      } else {
+        const uint16_t delta =
+            value > entry.last_value ? value - entry.last_value : entry.last_value - value;
+        if (sub.deadband == 0 || delta < sub.deadband) {
+          continue;
+        }
+      }
+
+      entry.last_value = value;
+      entry.above = above;
+      entry.pending_initial = false;
+      deliver(sub, event);
+      ++events;
+    }
+    return events;
+  }
+
+  /**
+   * @brief Take the oldest queued event
+   * @return false if the queue is empty
+   */
+  [[nodiscard]] bool PopEvent(FeedbackEvent& event) noexcept {
+    if (queue_count_ == 0) {
+      return false;
+    }
+    event = queue_[queue_head_];
+    queue_head_ = (queue_head_ + 1) % QUEUE_DEPTH;
+    --queue_count_;
+    return true;
+  }
+
+  /**
+   * @brief Events lost because the queue was full
+   */
+  [[nodiscard]] uint32_t DroppedEvents() const noexcept {
+    return dropped_events_;
+  }
+
+private:
+  struct Entry {
+    FeedbackSubscription subscription{}; ///< Parameters
+    uint16_t last_value{0};              ///< Last delivered value
+    bool above{false};                   ///< Last delivered side of the threshold
+    bool pending_initial{false};         ///< Initial event not yet delivered
+    bool active{false};                  ///< Slot in use
+  };
+
+  void updateSourceMask() noexcept {
+    source_mask_ = 0;
+    for (const auto& entry : entries_) {
+      if (entry.active) {
+        source_mask_ |= static_cast<uint16_t>(
+            1U << SourceIndex(entry.subscription.quantity, entry.subscription.channel));
+      }
+    }
+  }
+
+  void deliver(const FeedbackSubscription& sub, const FeedbackEvent& event) noexcept {
+    if (sub.callback != nullptr) {
+      sub.callback(event, sub.context);
+      return;
+    }
+    if (queue_count_ == QUEUE_DEPTH) {
+      ++dropped_events_;
+      return;
+    }
+    queue_[(queue_head_ + queue_count_) % QUEUE_DEPTH] = event;
+    ++queue_count_;
+  }
+
+  std::array<Entry, MAX_SUBSCRIPTIONS> entries_{};   ///< Subscription table
+  uint16_t source_mask_{0};                          ///< Sources needed by active entries
+  std::array<FeedbackEvent, QUEUE_DEPTH> queue_{};   ///< Event queue (no callback)
+  std::size_t queue_head_{0};                        ///< Oldest queued event
+  std::size_t queue_count_{0};                       ///< Queued events
+  uint32_t dropped_events_{0};                       ///< Events lost to a full queue
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_FEEDBACK_HPP
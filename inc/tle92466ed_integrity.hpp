@@ -0,0 +1,229 @@
+/**
+ * @file tle92466ed_integrity.hpp
+ * @brief Adaptive RX CRC verification for TLE92466ED driver replies
+ *
+ * @details
+ * By default the driver checks the CRC of every reply frame inline, before the
+ * value is used. IntegrityMonitor adds an adaptive mode that amortizes this
+ * check for high-volume telemetry reads:
+ * - Qualification: after configuration and after every CRC failure, all
+ *   replies are verified inline until qualification_frames replies in a row
+ *   passed.
+ * - Once qualified, replies of telemetry registers (channel feedback FB_*,
+ *   FB_VOLTAGE1/2) are returned unverified and their raw frames are queued.
+ *   A full queue is checked in one batch (CountFrameCrcErrors()). Every other
+ *   register, in particular CH_CTRL, diagnosis and fault registers, is still
+ *   verified inline.
+ * - A batch failure cannot recall the values already returned; it is counted,
+ *   logged by the driver and restarts qualification.
+ *
+ * IntegrityStats reports the coverage actually achieved: every reply frame is
+ * counted exactly once as verified inline, verified in a batch, pending (queued)
+ * or unverified (CRC checking disabled).
+ *
+ * Cost per reply: one counter update; per deferred reply additionally one
+ * queue store, and about three table lookups when its batch is checked.
+ *
+ * The driver holds an IntegrityMonitor only with TLE92466ED_ENABLE_INTEGRITY
+ * defined; otherwise every reply is verified inline (IntegrityMode::Full).
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_INTEGRITY_HPP
+#define TLE92466ED_INTEGRITY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "tle92466ed_spi_interface.hpp"
+#include "tle92466ed_registers.hpp"
+
+namespace tle92466ed {
+
+/**
+ * @brief RX CRC verification policy
+ */
+enum class IntegrityMode : uint8_t {
+  Full = 0, ///< Verify every reply inline (default)
+  Adaptive  ///< After qualification, verify telemetry replies in batches
+};
+
+/**
+ * @brief Integrity monitor configuration
+ */
+struct IntegrityConfig {
+  IntegrityMode mode{IntegrityMode::Full};
+  uint32_t qualification_frames{1024}; ///< Clean inline-verified replies before deferring
+  uint8_t batch_frames{32};            ///< Deferred replies per batch check (1..MAX_BATCH)
+};
+
+/**
+ * @brief Verification coverage counters
+ */
+struct IntegrityStats {
+  uint64_t verified_inline{0};  ///< Replies checked before their value was used
+  uint64_t verified_batched{0}; ///< Telemetry replies checked after their value was used
+  uint64_t unverified{0};       ///< Replies received with CRC checking disabled
+  uint32_t pending{0};          ///< Deferred replies not checked yet
+  uint32_t inline_failures{0};  ///< Inline CRC failures (the call failed with CRCError)
+  uint32_t batch_failures{0};   ///< Batched CRC failures (value already returned)
+  uint32_t requalifications{0}; ///< Qualification restarts after a failure
+  bool qualified{false};        ///< Telemetry replies are currently deferred
+
+  /// Reply frames received
+  [[nodiscard]] uint64_t Replies() const noexcept {
+    return verified_inline + verified_batched + unverified + pending;
+  }
+
+  /// Share of replies whose CRC was checked (1.0 before the first reply)
+  [[nodiscard]] float Coverage() const noexcept {
+    const uint64_t replies = Replies();
+    return replies == 0 ? 1.0F
+                        : static_cast<float>(verified_inline + verified_batched) /
+                              static_cast<float>(replies);
+  }
+};
+
+/**
+ * @brief Qualification state, deferred reply queue and coverage counters
+ */
+class IntegrityMonitor {
+public:
+  static constexpr std::size_t MAX_BATCH = 64; ///< Deferred replies held at most
+
+  /**
+   * @brief true for registers whose replies may be verified in a batch
+   *
+   * @details
+   * Channel feedback registers (FB_DC ... FB_PERIOD_MIN_MAX of CH0-CH5) and the
+   * supply voltage feedback FB_VOLTAGE1/2.
+   */
+  [[nodiscard]] static constexpr bool IsTelemetry(uint16_t address) noexcept {
+    return (address >= ChannelBase::CH4 + ChannelReg::FB_DC &&
+            address <= ChannelBase::CH3 + ChannelReg::FB_PERIOD_MIN_MAX &&
+            (address & 0x000FU) <= (ChannelReg::FB_PERIOD_MIN_MAX & 0x000FU)) ||
+           address == CentralReg::FB_VOLTAGE1 || address == CentralReg::FB_VOLTAGE2;
+  }
+
+  /**
+   * @brief Apply a configuration and restart qualification
+   *
+   * @note Check queued replies (VerifyBatch()) before reconfiguring; the queue
+   *       is dropped and its replies are counted as unverified.
+   * @return false if batch_frames is 0 or above MAX_BATCH
+   */
+  [[nodiscard]] bool Configure(const IntegrityConfig& config) noexcept {
+    if (config.batch_frames == 0 || config.batch_frames > MAX_BATCH) {
+      return false;
+    }
+    config_ = config;
+    stats_.unverified += count_;
+    stats_.pending = 0;
+    count_ = 0;
+    requalify();
+    return true;
+  }
+
+  [[nodiscard]] const IntegrityConfig& Config() const noexcept {
+    return config_;
+  }
+
+  /**
+   * @brief true if a reply of the register is to be deferred now
+   */
+  [[nodiscard]] bool Defers(uint16_t address) const noexcept {
+    return stats_.qualified && IsTelemetry(address);
+  }
+
+  /**
+   * @brief Count replies that were verified inline (verified) or not checked
+   */
+  void OnReplies(std::size_t count, bool verified) noexcept {
+    if (!verified) {
+      stats_.unverified += count;
+      return;
+    }
+    stats_.verified_inline += count;
+    if (!stats_.qualified && config_.mode == IntegrityMode::Adaptive) {
+      remaining_ = count >= remaining_ ? 0 : remaining_ - static_cast<uint32_t>(count);
+      stats_.qualified = remaining_ == 0;
+    }
+  }
+
+  /**
+   * @brief Count an inline CRC failure and restart qualification
+   */
+  void OnInlineFailure() noexcept {
+    ++stats_.verified_inline;
+    ++stats_.inline_failures;
+    ++stats_.requalifications;
+    requalify();
+  }
+
+  /**
+   * @brief Queue the raw frame of a deferred reply
+   * @return true if the queue is full and VerifyBatch() is due
+   */
+  [[nodiscard]] bool Defer(uint32_t reply_word) noexcept {
+    if (count_ < MAX_BATCH) {
+      queue_[count_++] = reply_word;
+      ++stats_.pending;
+    } else {
+      ++stats_.unverified;
+    }
+    return count_ >= config_.batch_frames;
+  }
+
+  /**
+   * @brief Check all queued replies in one batch
+   *
+   * @return Number of CRC failures; any failure restarts qualification
+   */
+  std::size_t VerifyBatch() noexcept {
+    const std::size_t failures =
+        CountFrameCrcErrors(std::span<const uint32_t>(queue_.data(), count_));
+    stats_.verified_batched += count_;
+    stats_.pending = 0;
+    count_ = 0;
+    if (failures != 0) {
+      stats_.batch_failures += static_cast<uint32_t>(failures);
+      ++stats_.requalifications;
+      requalify();
+    }
+    return failures;
+  }
+
+  [[nodiscard]] const IntegrityStats& Stats() const noexcept {
+    return stats_;
+  }
+
+  /**
+   * @brief Clear the counters (qualification state and queue are kept)
+   */
+  void ResetStats() noexcept {
+    const bool qualified = stats_.qualified;
+    stats_ = IntegrityStats{};
+    stats_.qualified = qualified;
+    stats_.pending = static_cast<uint32_t>(count_);
+  }
+
+private:
+  void requalify() noexcept {
+    remaining_ = config_.qualification_frames;
+    stats_.qualified = config_.mode == IntegrityMode::Adaptive && remaining_ == 0;
+  }
+
+  IntegrityConfig config_{};                 ///< Active configuration
+  IntegrityStats stats_{};                   ///< Coverage counters
+  uint32_t remaining_{0};                    ///< Clean replies left until qualified
+  std::array<uint32_t, MAX_BATCH> queue_{};  ///< Raw frames of deferred replies
+  std::size_t count_{0};                     ///< Queued frames
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_INTEGRITY_HPP
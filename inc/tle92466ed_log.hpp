@@ -0,0 +1,761 @@
+/**
+ * @file tle92466ed_log.hpp
+ * @brief Crash-safe, fixed-record fault and telemetry log for TLE92466ED driver
+ *
+ * @details
+ * After a reset the in-RAM fault state is gone. RecordLog keeps fault events
+ * (FaultReport), channel diagnostics (ChannelDiagnostics) and telemetry
+ * snapshots (TelemetrySample) in non-volatile storage as an append-only array
+ * of 64-byte binary records:
+ * - Appending packs a few fields and hands one record to the backend; there is
+ *   no text formatting and no sync/flush on the control path
+ * - Every record carries the log epoch, its sequence number and a CRC-32, so a
+ *   torn or stale record is never mistaken for data
+ * - Open() recovers the valid prefix after a crash and rebuilds a sparse time
+ *   index, so Seek() by timestamp reads at most one index stride of records
+ *
+ * Storage is abstracted by a backend (see LogBackend). This header provides a
+ * NOR-flash sector backend (FlashSectorBackend); the Linux mmap backend lives
+ * with the Linux examples (examples/linux/common/posix_mmap_log.hpp).
+ *
+ * Slot states:
+ * - Blank (all bytes 0xFF): end of the log
+ * - Valid (CRC and epoch match, sequence above the previous record): a record
+ * - Anything else (torn by a crash, invalidated): skipped
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_LOG_HPP
+#define TLE92466ED_LOG_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "tle92466ed.hpp"
+
+namespace tle92466ed {
+
+//==========================================================================
+// RECORD FORMAT
+//==========================================================================
+
+/**
+ * @brief Kind of log record
+ */
+enum class LogRecordType : uint8_t {
+  Fault = 1,           ///< FaultReport (FaultLogPayload)
+  ChannelSnapshot = 2, ///< ChannelDiagnostics of one channel (ChannelLogPayload)
+  Telemetry = 3        ///< TelemetrySample (TelemetryLogPayload)
+};
+
+/**
+ * @brief One fixed-size log record (64 bytes)
+ */
+struct LogRecord {
+  static constexpr std::size_t PAYLOAD_SIZE = 40; ///< Payload bytes
+
+  uint32_t sequence{0};                   ///< Record number within the epoch (0, 1, 2, ...)
+  uint32_t epoch{0};                      ///< LogHeader::epoch at the time of writing
+  uint64_t timestamp_us{0};               ///< Caller-supplied time (non-decreasing for Seek())
+  uint8_t type{0};                        ///< LogRecordType
+  uint8_t channel{0};                     ///< Channel index (ChannelSnapshot), 0 otherwise
+  uint16_t reserved{0};                   ///< Reserved (0)
+  std::array<uint8_t, PAYLOAD_SIZE> payload{}; ///< Type-specific payload
+  uint32_t crc{0};                        ///< CRC-32 over all preceding bytes
+
+  /**
+   * @brief Compute the CRC of this record (excluding the crc field)
+   */
+  [[nodiscard]] uint32_t ComputeCrc() const noexcept {
+    return CalculateCrc32(reinterpret_cast<const uint8_t*>(this), offsetof(LogRecord, crc));
+  }
+};
+
+static_assert(sizeof(LogRecord) == 64, "Log record layout must stay 64 bytes");
+static_assert(std::is_trivially_copyable_v<LogRecord>);
+
+/**
+ * @brief Log header stored by the backend next to the record slots
+ */
+struct LogHeader {
+  static constexpr uint32_t MAGIC = 0x474F4C54; ///< Header magic ("TLOG" as big-endian)
+  static constexpr uint16_t VERSION = 1;        ///< Record format version
+
+  uint32_t magic{MAGIC};                                        ///< Header identification
+  uint16_t version{VERSION};                                    ///< Record format version
+  uint16_t record_size{static_cast<uint16_t>(sizeof(LogRecord))}; ///< sizeof(LogRecord)
+  uint32_t capacity{0};                                         ///< Record slots
+  uint32_t epoch{0};                                            ///< Incremented by every Format()
+  uint32_t crc{0};                                              ///< CRC-32 over preceding bytes
+
+  [[nodiscard]] uint32_t ComputeCrc() const noexcept {
+    return CalculateCrc32(reinterpret_cast<const uint8_t*>(this), offsetof(LogHeader, crc));
+  }
+
+  /**
+   * @brief Check header integrity and format compatibility
+   */
+  [[nodiscard]] bool IsValid(uint32_t slot_capacity) const noexcept {
+    return magic == MAGIC && version == VERSION && record_size == sizeof(LogRecord) &&
+           capacity == slot_capacity && crc == ComputeCrc();
+  }
+};
+
+static_assert(std::is_trivially_copyable_v<LogHeader>);
+
+/**
+ * @brief Payload of a Fault record: FaultReport as bit masks
+ */
+struct FaultLogPayload {
+  uint32_t global_flags{0};                ///< Bit n = FAULT_LOG_GLOBAL_FLAGS[n]
+  std::array<uint16_t, 6> channel_flags{}; ///< Bit n = FAULT_LOG_CHANNEL_FLAGS[n]
+};
+
+/**
+ * @brief Payload of a ChannelSnapshot record: ChannelDiagnostics
+ */
+struct ChannelLogPayload {
+  uint16_t flags{0};           ///< Bit n = CHANNEL_LOG_FLAGS[n]
+  uint16_t average_current{0}; ///< Average current (raw value)
+  uint16_t duty_cycle{0};      ///< PWM duty cycle (raw value)
+  uint16_t min_current{0};     ///< Minimum current
+  uint16_t max_current{0};     ///< Maximum current
+  uint16_t vbat_feedback{0};   ///< VBAT feedback
+};
+
+/**
+ * @brief Payload of a Telemetry record: condensed TelemetrySample
+ *
+ * @details
+ * Duty cycles and setpoints are dropped to fit one record; channels with a
+ * non-zero DIAG_ERR/DIAG_WARN word are flagged in err_mask/warn_mask.
+ */
+struct TelemetryLogPayload {
+  uint32_t capture_count{0};               ///< TelemetrySample::capture_count
+  uint16_t global_diag0{0};                ///< GLOBAL_DIAG0 raw value
+  uint16_t global_diag1{0};                ///< GLOBAL_DIAG1 raw value
+  uint16_t global_diag2{0};                ///< GLOBAL_DIAG2 raw value
+  uint16_t fb_stat{0};                     ///< FB_STAT raw value
+  uint16_t vbat_mv{0};                     ///< VBAT (mV)
+  uint16_t vio_mv{0};                      ///< VIO (mV)
+  uint16_t vdd_mv{0};                      ///< VDD (mV)
+  uint8_t enable_mask{0};                  ///< Channel enable state (bits 0-5)
+  uint8_t mission_mode{0};                 ///< 1 = Mission Mode
+  uint8_t err_mask{0};                     ///< Channels with DIAG_ERR != 0 (bits 0-5)
+  uint8_t warn_mask{0};                    ///< Channels with DIAG_WARN != 0 (bits 0-5)
+  std::array<uint16_t, 6> average_current{}; ///< FB_I_AVG raw value per channel
+};
+
+static_assert(sizeof(FaultLogPayload) <= LogRecord::PAYLOAD_SIZE);
+static_assert(sizeof(ChannelLogPayload) <= LogRecord::PAYLOAD_SIZE);
+static_assert(sizeof(TelemetryLogPayload) <= LogRecord::PAYLOAD_SIZE);
+
+/// FaultReport flags packed into FaultLogPayload::global_flags (bit order is part of the format)
+inline constexpr std::array<bool FaultReport::*, 26> FAULT_LOG_GLOBAL_FLAGS{
+    &FaultReport::any_fault,   &FaultReport::vbat_uv,
+    &FaultReport::vbat_ov,     &FaultReport::vio_uv,
+    &FaultReport::vio_ov,      &FaultReport::vdd_uv,
+    &FaultReport::vdd_ov,      &FaultReport::vr_iref_uv,
+    &FaultReport::vr_iref_ov,  &FaultReport::vdd2v5_uv,
+    &FaultReport::vdd2v5_ov,   &FaultReport::ref_uv,
+    &FaultReport::ref_ov,      &FaultReport::vpre_ov,
+    &FaultReport::hvadc_err,   &FaultReport::clock_fault,
+    &FaultReport::spi_wd_error, &FaultReport::ot_error,
+    &FaultReport::ot_warning,  &FaultReport::por_event,
+    &FaultReport::reset_event, &FaultReport::reg_ecc_err,
+    &FaultReport::otp_ecc_err, &FaultReport::otp_virgin,
+    &FaultReport::supply_nok_internal, &FaultReport::supply_nok_external};
+
+/// FaultReport::ChannelFaults flags packed into FaultLogPayload::channel_flags
+inline constexpr std::array<bool FaultReport::ChannelFaults::*, 10> FAULT_LOG_CHANNEL_FLAGS{
+    &FaultReport::ChannelFaults::has_fault,
+    &FaultReport::ChannelFaults::overcurrent,
+    &FaultReport::ChannelFaults::short_to_ground,
+    &FaultReport::ChannelFaults::open_load,
+    &FaultReport::ChannelFaults::over_temperature,
+    &FaultReport::ChannelFaults::open_load_short_ground,
+    &FaultReport::ChannelFaults::ot_warning,
+    &FaultReport::ChannelFaults::current_regulation_warning,
+    &FaultReport::ChannelFaults::pwm_regulation_warning,
+    &FaultReport::ChannelFaults::olsg_warning};
+
+/// ChannelDiagnostics flags packed into ChannelLogPayload::flags
+inline constexpr std::array<bool ChannelDiagnostics::*, 9> CHANNEL_LOG_FLAGS{
+    &ChannelDiagnostics::overcurrent,
+    &ChannelDiagnostics::short_to_ground,
+    &ChannelDiagnostics::open_load,
+    &ChannelDiagnostics::over_temperature,
+    &ChannelDiagnostics::open_load_short_ground,
+    &ChannelDiagnostics::ot_warning,
+    &ChannelDiagnostics::current_regulation_warning,
+    &ChannelDiagnostics::pwm_regulation_warning,
+    &ChannelDiagnostics::olsg_warning};
+
+namespace detail {
+
+template <typename Struct, std::size_t N>
+[[nodiscard]] constexpr uint32_t PackFlags(const Struct& value,
+                                           const std::array<bool Struct::*, N>& flags) noexcept {
+  uint32_t bits = 0;
+  for (std::size_t i = 0; i < N; ++i) {
+    bits |= static_cast<uint32_t>(value.*flags[i]) << i;
+  }
+  return bits;
+}
+
+template <typename Struct, std::size_t N>
+constexpr void UnpackFlags(uint32_t bits, Struct& value,
+                           const std::array<bool Struct::*, N>& flags) noexcept {
+  for (std::size_t i = 0; i < N; ++i) {
+    value.*flags[i] = ((bits >> i) & 1U) != 0;
+  }
+}
+
+template <typename Payload>
+[[nodiscard]] LogRecord MakeRecord(LogRecordType type, uint64_t timestamp_us, uint8_t channel,
+                                   const Payload& payload) noexcept {
+  LogRecord record{};
+  record.timestamp_us = timestamp_us;
+  record.type = static_cast<uint8_t>(type);
+  record.channel = channel;
+  std::memcpy(record.payload.data(), &payload, sizeof(Payload));
+  return record;
+}
+
+template <typename Payload>
+[[nodiscard]] bool ReadPayload(const LogRecord& record, LogRecordType type,
+                               Payload& payload) noexcept {
+  if (record.type != static_cast<uint8_t>(type)) {
+    return false;
+  }
+  std::memcpy(static_cast<void*>(&payload), record.payload.data(), sizeof(Payload));
+  return true;
+}
+
+} // namespace detail
+
+/**
+ * @brief Encode a fault report as a log record
+ */
+[[nodiscard]] inline LogRecord MakeFaultRecord(uint64_t timestamp_us,
+                                               const FaultReport& report) noexcept {
+  FaultLogPayload payload{};
+  payload.global_flags = detail::PackFlags(report, FAULT_LOG_GLOBAL_FLAGS);
+  for (std::size_t ch = 0; ch < report.channels.size(); ++ch) {
+    payload.channel_flags[ch] =
+        static_cast<uint16_t>(detail::PackFlags(report.channels[ch], FAULT_LOG_CHANNEL_FLAGS));
+  }
+  return detail::MakeRecord(LogRecordType::Fault, timestamp_us, 0, payload);
+}
+
+/**
+ * @brief Encode the diagnostics of one channel as a log record
+ */
+[[nodiscard]] inline LogRecord MakeChannelRecord(uint64_t timestamp_us, Channel channel,
+                                                 const ChannelDiagnostics& diag) noexcept {
+  ChannelLogPayload payload{};
+  payload.flags = static_cast<uint16_t>(detail::PackFlags(diag, CHANNEL_LOG_FLAGS));
+  payload.average_current = diag.average_current;
+  payload.duty_cycle = diag.duty_cycle;
+  payload.min_current = diag.min_current;
+  payload.max_current = diag.max_current;
+  payload.vbat_feedback = diag.vbat_feedback;
+  return detail::MakeRecord(LogRecordType::ChannelSnapshot, timestamp_us,
+                            ToIndex(channel), payload);
+}
+
+/**
+ * @brief Encode a telemetry snapshot as a log record (timestamp from the sample)
+ */
+[[nodiscard]] inline LogRecord MakeTelemetryRecord(const TelemetrySample& sample) noexcept {
+  TelemetryLogPayload payload{};
+  payload.capture_count = sample.capture_count;
+  payload.global_diag0 = sample.global_diag0;
+  payload.global_diag1 = sample.global_diag1;
+  payload.global_diag2 = sample.global_diag2;
+  payload.fb_stat = sample.fb_stat;
+  payload.vbat_mv = sample.vbat_mv;
+  payload.vio_mv = sample.vio_mv;
+  payload.vdd_mv = sample.vdd_mv;
+  payload.enable_mask = sample.enable_mask;
+  payload.mission_mode = sample.mission_mode;
+  for (std::size_t ch = 0; ch < sample.channels.size(); ++ch) {
+    const auto& channel = sample.channels[ch];
+    payload.err_mask |= static_cast<uint8_t>((channel.diag_err != 0 ? 1U : 0U) << ch);
+    payload.warn_mask |= static_cast<uint8_t>((channel.diag_warn != 0 ? 1U : 0U) << ch);
+    payload.average_current[ch] = channel.average_current;
+  }
+  return detail::MakeRecord(LogRecordType::Telemetry, sample.timestamp_us, 0, payload);
+}
+
+/**
+ * @brief Decode a Fault record
+ * @return false if the record is of another type
+ */
+[[nodiscard]] inline bool DecodeFaultRecord(const LogRecord& record, FaultReport& report) noexcept {
+  FaultLogPayload payload{};
+  if (!detail::ReadPayload(record, LogRecordType::Fault, payload)) {
+    return false;
+  }
+  report = FaultReport{};
+  detail::UnpackFlags(payload.global_flags, report, FAULT_LOG_GLOBAL_FLAGS);
+  for (std::size_t ch = 0; ch < report.channels.size(); ++ch) {
+    detail::UnpackFlags(payload.channel_flags[ch], report.channels[ch], FAULT_LOG_CHANNEL_FLAGS);
+  }
+  return true;
+}
+
+/**
+ * @brief Decode a ChannelSnapshot record (channel index in LogRecord::channel)
+ * @return false if the record is of another type
+ */
+[[nodiscard]] inline bool DecodeChannelRecord(const LogRecord& record,
+                                              ChannelDiagnostics& diag) noexcept {
+  ChannelLogPayload payload{};
+  if (!detail::ReadPayload(record, LogRecordType::ChannelSnapshot, payload)) {
+    return false;
+  }
+  diag = ChannelDiagnostics{};
+  detail::UnpackFlags(payload.flags, diag, CHANNEL_LOG_FLAGS);
+  diag.average_current = payload.average_current;
+  diag.duty_cycle = payload.duty_cycle;
+  diag.min_current = payload.min_current;
+  diag.max_current = payload.max_current;
+  diag.vbat_feedback = payload.vbat_feedback;
+  return true;
+}
+
+/**
+ * @brief Decode a Telemetry record
+ * @return false if the record is of another type
+ */
+[[nodiscard]] inline bool DecodeTelemetryRecord(const LogRecord& record,
+                                                TelemetryLogPayload& payload) noexcept {
+  return detail::ReadPayload(record, LogRecordType::Telemetry, payload);
+}
+
+//==========================================================================
+// STORAGE BACKEND
+//==========================================================================
+
+/**
+ * @brief Storage backend requirements of RecordLog
+ *
+ * @details
+ * - Capacity(): number of record slots
+ * - ReadHeader()/ReadRecord(): read back stored data
+ * - Format(): make every slot blank (0xFF) and store the header (cold path)
+ * - WriteRecord(): store one record into a blank slot; called on the control
+ *   path, so it must not block (no sync, no erase, no waiting for programming)
+ * - Invalidate(): overwrite a slot with zeros so it is skipped (cold path);
+ *   may fail on storage that cannot be reprogrammed
+ */
+template <typename Backend>
+concept LogBackend = requires(Backend& backend, const Backend& const_backend, uint32_t slot,
+                              LogHeader& header, LogRecord& record) {
+  { const_backend.Capacity() } -> std::convertible_to<uint32_t>;
+  { const_backend.ReadHeader(header) } -> std::same_as<bool>;
+  { const_backend.ReadRecord(slot, record) } -> std::same_as<bool>;
+  { backend.Format(static_cast<const LogHeader&>(header)) } -> std::same_as<bool>;
+  { backend.WriteRecord(slot, static_cast<const LogRecord&>(record)) } -> std::same_as<bool>;
+  { backend.Invalidate(slot) } -> std::same_as<bool>;
+};
+
+/**
+ * @brief NOR-flash sector backend with RAM staging
+ *
+ * @details
+ * Layout: the first sector holds the LogHeader, the remaining sectors hold
+ * records back to back. WriteRecord() only copies the record into a small RAM
+ * staging ring; Flush() programs staged records and is meant to run from a
+ * low-priority task. Slots are never rewritten except by Invalidate(), which
+ * programs zeros (allowed on NOR flash since it only clears bits).
+ *
+ * Flash requirements (addresses relative to the log partition):
+ * - bool Read(uint32_t address, void* data, std::size_t length)
+ * - bool Program(uint32_t address, const void* data, std::size_t length)
+ * - bool EraseSector(uint32_t address)
+ *
+ * @tparam Flash Flash driver
+ * @tparam STAGING_RECORDS Records buffered between Flush() calls
+ */
+template <typename Flash, std::size_t STAGING_RECORDS = 8>
+class FlashSectorBackend {
+public:
+  /**
+   * @param flash Flash driver
+   * @param sector_size Erase sector size in bytes (multiple of sizeof(LogRecord))
+   * @param sector_count Sectors in the log partition (header sector included)
+   */
+  FlashSectorBackend(Flash& flash, uint32_t sector_size, uint32_t sector_count) noexcept
+      : flash_(flash), sector_size_(sector_size),
+        capacity_(sector_count > 1 ? (sector_count - 1) * (sector_size / sizeof(LogRecord))
+                                   : 0),
+        sector_count_(sector_count) {}
+
+  [[nodiscard]] uint32_t Capacity() const noexcept {
+    return capacity_;
+  }
+
+  [[nodiscard]] bool ReadHeader(LogHeader& header) const noexcept {
+    return flash_.Read(0, &header, sizeof(header));
+  }
+
+  [[nodiscard]] bool ReadRecord(uint32_t slot, LogRecord& record) const noexcept {
+    // Staged records are not in flash yet
+    for (std::size_t i = 0; i < staged_count_; ++i) {
+      const auto& entry = staging_[(staging_head_ + i) % STAGING_RECORDS];
+      if (entry.slot == slot) {
+        record = entry.record;
+        return true;
+      }
+    }
+    return flash_.Read(recordAddress(slot), &record, sizeof(record));
+  }
+
+  [[nodiscard]] bool Format(const LogHeader& header) noexcept {
+    staged_count_ = 0;
+    for (uint32_t sector = 0; sector < sector_count_; ++sector) {
+      if (!flash_.EraseSector(sector * sector_size_)) {
+        return false;
+      }
+    }
+    return flash_.Program(0, &header, sizeof(header));
+  }
+
+  [[nodiscard]] bool WriteRecord(uint32_t slot, const LogRecord& record) noexcept {
+    if (staged_count_ == STAGING_RECORDS) {
+      return false;
+    }
+    staging_[(staging_head_ + staged_count_) % STAGING_RECORDS] = {slot, record};
+    ++staged_count_;
+    return true;
+  }
+
+  [[nodiscard]] bool Invalidate(uint32_t slot) noexcept {
+    const LogRecord zeros{};
+    return flash_.Program(recordAddress(slot), &zeros, sizeof(zeros));
+  }
+
+  /**
+   * @brief Program staged records into flash (call outside the control path)
+   * @return false if programming failed (the record stays staged)
+   */
+  bool Flush() noexcept {
+    while (staged_count_ != 0) {
+      const auto& entry = staging_[staging_head_];
+      if (!flash_.Program(recordAddress(entry.slot), &entry.record, sizeof(entry.record))) {
+        return false;
+      }
+      staging_head_ = (staging_head_ + 1) % STAGING_RECORDS;
+      --staged_count_;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Records waiting for Flush()
+   */
+  [[nodiscard]] std::size_t Pending() const noexcept {
+    return staged_count_;
+  }
+
+private:
+  struct StagedRecord {
+    uint32_t slot{0};
+    LogRecord record{};
+  };
+
+  [[nodiscard]] uint32_t recordAddress(uint32_t slot) const noexcept {
+    return sector_size_ + slot * static_cast<uint32_t>(sizeof(LogRecord));
+  }
+
+  Flash& flash_;                                         ///< Flash driver
+  uint32_t sector_size_;                                 ///< Erase sector size (bytes)
+  uint32_t capacity_;                                    ///< Record slots
+  uint32_t sector_count_;                                ///< Sectors in the partition
+  std::array<StagedRecord, STAGING_RECORDS> staging_{}; ///< Records waiting for Flush()
+  std::size_t staging_head_{0};                          ///< Oldest staged record
+  std::size_t staged_count_{0};                          ///< Number of staged records
+};
+
+//==========================================================================
+// RECORD LOG
+//==========================================================================
+
+/**
+ * @brief Result of RecordLog::Open()
+ */
+struct LogRecovery {
+  uint32_t records{0};     ///< Valid records recovered
+  uint32_t skipped{0};     ///< Torn or invalidated slots skipped before the end
+  uint32_t discarded{0};   ///< Stale slots after the end that were invalidated
+  bool formatted{false};   ///< No valid header was found; the log was formatted
+};
+
+/**
+ * @brief Position in the log for sequential reads
+ */
+struct LogCursor {
+  uint32_t slot{0}; ///< Next slot to examine
+};
+
+/**
+ * @brief Append-only, crash-safe record log
+ *
+ * @details
+ * Append() is the only call meant for the control path: it fills in sequence,
+ * epoch and CRC and passes one record to the backend. Open(), Format() and
+ * the read side are cold.
+ *
+ * The time index samples one record every Capacity()/INDEX_ENTRIES slots, so
+ * Seek() is a binary search over the index plus a bounded forward scan.
+ * Timestamps must be non-decreasing for Seek() to be exact.
+ *
+ * When all slots are used, Append() fails and counts the record as dropped;
+ * call Format() to start a new epoch.
+ *
+ * @tparam Backend Storage backend (see LogBackend)
+ * @tparam INDEX_ENTRIES Time index size
+ */
+template <LogBackend Backend, std::size_t INDEX_ENTRIES = 64>
+class RecordLog {
+public:
+  explicit RecordLog(Backend& backend) noexcept : backend_(backend) {}
+
+  /**
+   * @brief Recover the log from storage
+   *
+   * @details
+   * Scans slots from the start: valid records are counted and indexed, torn
+   * slots are skipped, and the first blank slot ends the log. A slot with a
+   * valid CRC but a sequence number not above the last valid record is
+   * invalidated, so Next() and Count() see the same records. Slots after the
+   * end that are not blank (left behind when writes reached storage out of
+   * order) are invalidated so they can never reappear. A missing or
+   * incompatible header formats the log.
+   *
+   * @param recovery Optional recovery statistics
+   * @return false on a backend error
+   */
+  [[nodiscard]] bool Open(LogRecovery* recovery = nullptr) noexcept {
+    LogRecovery result{};
+    LogHeader header{};
+    if (!backend_.ReadHeader(header) || !header.IsValid(backend_.Capacity())) {
+      result.formatted = true;
+      if (!Format()) {
+        return false;
+      }
+    } else {
+      reset(header.epoch);
+      uint32_t slot = 0;
+      LogRecord record{};
+      for (; slot < backend_.Capacity(); ++slot) {
+        if (!backend_.ReadRecord(slot, record)) {
+          return false;
+        }
+        if (isBlank(record)) {
+          break;
+        }
+        if (!isIntact(record)) {
+          ++result.skipped;
+          continue;
+        }
+        if (record.sequence < sequence_) {
+          (void)backend_.Invalidate(slot); // Out of order: never returned by Next()
+          ++result.skipped;
+          continue;
+        }
+        indexRecord(slot, record.timestamp_us);
+        sequence_ = record.sequence + 1;
+        ++count_;
+      }
+      next_slot_ = slot;
+      for (++slot; slot < backend_.Capacity(); ++slot) {
+        if (!backend_.ReadRecord(slot, record)) {
+          return false;
+        }
+        if (!isBlank(record)) {
+          (void)backend_.Invalidate(slot);
+          ++result.discarded;
+        }
+      }
+    }
+    result.records = count_;
+    if (recovery != nullptr) {
+      *recovery = result;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Erase all records and start a new epoch
+   * @return false on a backend error
+   */
+  [[nodiscard]] bool Format() noexcept {
+    LogHeader header{};
+    LogHeader previous{};
+    const bool valid =
+        backend_.ReadHeader(previous) && previous.IsValid(backend_.Capacity());
+    header.capacity = backend_.Capacity();
+    header.epoch = valid ? previous.epoch + 1 : 1;
+    header.crc = header.ComputeCrc();
+    if (!backend_.Format(header)) {
+      return false;
+    }
+    reset(header.epoch);
+    return true;
+  }
+
+  /**
+   * @brief Append a record (control path)
+   *
+   * @details
+   * sequence, epoch and crc are filled in; the rest is stored as given.
+   *
+   * @return false if the log is full or the backend could not take the record
+   */
+  bool Append(LogRecord record) noexcept {
+    if (next_slot_ >= backend_.Capacity()) {
+      ++dropped_;
+      return false;
+    }
+    record.sequence = sequence_;
+    record.epoch = epoch_;
+    record.crc = record.ComputeCrc();
+    if (!backend_.WriteRecord(next_slot_, record)) {
+      ++dropped_;
+      return false;
+    }
+    indexRecord(next_slot_, record.timestamp_us);
+    ++next_slot_;
+    ++sequence_;
+    ++count_;
+    return true;
+  }
+
+  /**
+   * @brief Cursor at the first record
+   */
+  [[nodiscard]] LogCursor Begin() const noexcept {
+    return LogCursor{0};
+  }
+
+  /**
+   * @brief Cursor at the first record with timestamp >= timestamp_us
+   */
+  [[nodiscard]] LogCursor Seek(uint64_t timestamp_us) const noexcept {
+    // Last index entry before the target, then scan forward
+    const auto* end = index_.data() + index_count_;
+    const auto* entry = std::lower_bound(
+        index_.data(), end, timestamp_us,
+        [](const IndexEntry& e, uint64_t t) { return e.timestamp_us < t; });
+    LogCursor cursor{entry == index_.data() ? 0U : (entry - 1)->slot};
+
+    LogRecord record{};
+    LogCursor position = cursor;
+    while (Next(position, record)) {
+      if (record.timestamp_us >= timestamp_us) {
+        return cursor;
+      }
+      cursor = position;
+    }
+    return cursor;
+  }
+
+  /**
+   * @brief Read the record at the cursor and advance it
+   * @return false at the end of the log
+   */
+  [[nodiscard]] bool Next(LogCursor& cursor, LogRecord& record) const noexcept {
+    while (cursor.slot < next_slot_) {
+      const uint32_t slot = cursor.slot++;
+      if (backend_.ReadRecord(slot, record) && isIntact(record)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Valid records in the log
+   */
+  [[nodiscard]] uint32_t Count() const noexcept {
+    return count_;
+  }
+
+  /**
+   * @brief Slots in use (valid records plus skipped slots)
+   */
+  [[nodiscard]] uint32_t SlotsUsed() const noexcept {
+    return next_slot_;
+  }
+
+  /**
+   * @brief Records rejected by Append() since Open()/Format()
+   */
+  [[nodiscard]] uint32_t Dropped() const noexcept {
+    return dropped_;
+  }
+
+  /**
+   * @brief Current epoch (changes with every Format())
+   */
+  [[nodiscard]] uint32_t Epoch() const noexcept {
+    return epoch_;
+  }
+
+private:
+  struct IndexEntry {
+    uint64_t timestamp_us{0};
+    uint32_t slot{0};
+  };
+
+  void reset(uint32_t epoch) noexcept {
+    epoch_ = epoch;
+    sequence_ = 0;
+    count_ = 0;
+    next_slot_ = 0;
+    dropped_ = 0;
+    index_count_ = 0;
+    const uint32_t capacity = backend_.Capacity();
+    index_stride_ = std::max<uint32_t>(
+        1, static_cast<uint32_t>((capacity + INDEX_ENTRIES - 1) / INDEX_ENTRIES));
+  }
+
+  void indexRecord(uint32_t slot, uint64_t timestamp_us) noexcept {
+    if (count_ % index_stride_ == 0 && index_count_ < INDEX_ENTRIES) {
+      index_[index_count_++] = IndexEntry{timestamp_us, slot};
+    }
+  }
+
+  [[nodiscard]] static bool isBlank(const LogRecord& record) noexcept {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&record);
+    return std::all_of(bytes, bytes + sizeof(record), [](uint8_t b) { return b == 0xFF; });
+  }
+
+  [[nodiscard]] bool isIntact(const LogRecord& record) const noexcept {
+    return record.epoch == epoch_ && record.crc == record.ComputeCrc();
+  }
+
+  Backend& backend_;                                ///< Storage backend
+  std::array<IndexEntry, INDEX_ENTRIES> index_{}; ///< Sparse time index
+  std::size_t index_count_{0};                      ///< Used index entries
+  uint32_t index_stride_{1};                        ///< Records per index entry
+  uint32_t epoch_{0};                               ///< Current epoch
+  uint32_t sequence_{0};                            ///< Sequence of the next Append()
+  uint32_t count_{0};                               ///< Valid records
+  uint32_t next_slot_{0};                           ///< Slot of the next Append()
+  uint32_t dropped_{0};                             ///< Rejected appends
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_LOG_HPP
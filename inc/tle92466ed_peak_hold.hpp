@@ -0,0 +1,236 @@
+/**
+ * @file tle92466ed_peak_hold.hpp
+ * @brief Peak-and-hold current profile scheduling for TLE92466ED driver
+ *
+ * @details
+ * A solenoid pulls in faster with a high peak current and then needs only a
+ * low hold current. Timing the switch-over with application-level
+ * SetCurrentSetpoint() calls adds the jitter of the application loop and of
+ * the setpoint write path (logging, range checks, frame assembly) to the peak
+ * duration. PeakHoldScheduler keeps, per channel,
+ * - the peak and hold targets and the peak duration,
+ * - the hold setpoint write frame, prebuilt with CRC at configuration time,
+ * - the absolute transition time of a running profile.
+ *
+ * Driver::ServicePeakHold() waits for the earliest transition through the
+ * CommInterface deadline hook (DelayUntil()) and sends the prebuilt frames of
+ * every transition due by then, plus those due within the merge window, in
+ * one burst. The frames are written without readback; reply status and CRC
+ * are checked after the release.
+ *
+ * Cost per transition burst: N + 1 frames for N channels and no setpoint
+ * computation; per ServicePeakHold() call without a due transition: one
+ * time stamp and a scan of six entries.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_PEAK_HOLD_HPP
+#define TLE92466ED_PEAK_HOLD_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace tle92466ed {
+
+/**
+ * @brief Peak-and-hold profile of one channel
+ */
+struct PeakHoldProfile {
+  uint16_t peak_ma{0}; ///< Pull-in current (mA)
+  uint32_t peak_us{0}; ///< Time at peak current before switching to hold (> 0)
+  uint16_t hold_ma{0}; ///< Hold current (mA, at most peak_ma)
+};
+
+/**
+ * @brief Peak-to-hold transition timing counters
+ */
+struct PeakHoldStats {
+  uint32_t started{0};      ///< Channels started at peak current
+  uint32_t transitions{0};  ///< Channels switched to hold current
+  uint32_t bursts{0};       ///< Transition bursts sent
+  uint32_t cancelled{0};    ///< Transitions dropped by a setpoint write or reset
+  uint32_t last_late_us{0}; ///< Release after the due time, last transition
+  uint32_t max_late_us{0};  ///< Release after the due time, worst transition
+  uint32_t max_early_us{0}; ///< Release before the due time (merge window), worst transition
+};
+
+/**
+ * @brief Per-channel profiles, prebuilt hold frames and pending transitions
+ */
+class PeakHoldScheduler {
+public:
+  static constexpr uint32_t DEFAULT_MERGE_WINDOW_US = 20; ///< Default burst merge window
+
+  /**
+   * @brief Store the profile of a channel (stops a running transition)
+   *
+   * @param index Channel index (0-5)
+   * @param peak_target SETPOINT value at peak current
+   * @param hold_target SETPOINT value at hold current
+   * @param peak_us Peak duration
+   * @param hold_frame Hold setpoint write frame, with CRC
+   */
+  void Configure(uint8_t index, uint16_t peak_target, uint16_t hold_target, uint32_t peak_us,
+                 uint32_t hold_frame) noexcept {
+    Entry& entry = entries_[index];
+    entry.peak_target = peak_target;
+    entry.hold_target = hold_target;
+    entry.peak_us = peak_us;
+    entry.hold_frame = hold_frame;
+    configured_mask_ |= static_cast<uint8_t>(1U << index);
+    active_mask_ &= static_cast<uint8_t>(~(1U << index));
+  }
+
+  /**
+   * @brief Forget the profiles of channels (running transitions are dropped)
+   */
+  void Clear(uint8_t mask) noexcept {
+    Cancel(mask);
+    configured_mask_ &= static_cast<uint8_t>(~mask);
+  }
+
+  /// Channels with a profile (bit n = CHn)
+  [[nodiscard]] uint8_t ConfiguredMask() const noexcept {
+    return configured_mask_;
+  }
+
+  /// Channels at peak current waiting for their transition (bit n = CHn)
+  [[nodiscard]] uint8_t ActiveMask() const noexcept {
+    return active_mask_;
+  }
+
+  [[nodiscard]] uint16_t PeakTarget(uint8_t index) const noexcept {
+    return entries_[index].peak_target;
+  }
+
+  [[nodiscard]] uint16_t HoldTarget(uint8_t index) const noexcept {
+    return entries_[index].hold_target;
+  }
+
+  /**
+   * @brief Schedule the transitions of channels whose peak started at now_us
+   */
+  void Start(uint8_t mask, uint64_t now_us) noexcept {
+    for (uint8_t i = 0; i < 6; ++i) {
+      if ((mask & (1U << i)) != 0) {
+        entries_[i].due_us = now_us + entries_[i].peak_us;
+        ++stats_.started;
+      }
+    }
+    active_mask_ |= mask;
+  }
+
+  /**
+   * @brief Drop pending transitions of channels
+   */
+  void Cancel(uint8_t mask) noexcept {
+    const auto dropped = static_cast<uint8_t>(active_mask_ & mask);
+    if (dropped != 0) [[unlikely]] {
+      stats_.cancelled += static_cast<uint32_t>(std::popcount(dropped));
+      active_mask_ &= static_cast<uint8_t>(~dropped);
+    }
+  }
+
+  /**
+   * @brief Earliest due time of the pending transitions
+   * @return false if no transition is pending
+   */
+  [[nodiscard]] bool NextDue(uint64_t& due_us) const noexcept {
+    bool found = false;
+    for (uint8_t i = 0; i < 6; ++i) {
+      if ((active_mask_ & (1U << i)) != 0 && (!found || entries_[i].due_us < due_us)) {
+        due_us = entries_[i].due_us;
+        found = true;
+      }
+    }
+    return found;
+  }
+
+  /**
+   * @brief Collect the hold frames of transitions due by release_us + merge window
+   *
+   * @param release_us Release time of the burst
+   * @param frames Hold frames, in channel order
+   * @param count Number of frames collected
+   * @return Channels collected (bit n = CHn)
+   */
+  [[nodiscard]] uint8_t Collect(uint64_t release_us, std::array<uint32_t, 6>& frames,
+                                std::size_t& count) const noexcept {
+    uint8_t mask = 0;
+    count = 0;
+    for (uint8_t i = 0; i < 6; ++i) {
+      if ((active_mask_ & (1U << i)) != 0 &&
+          entries_[i].due_us <= release_us + merge_window_us_) {
+        frames[count++] = entries_[i].hold_frame;
+        mask |= static_cast<uint8_t>(1U << i);
+      }
+    }
+    return mask;
+  }
+
+  /**
+   * @brief Mark collected transitions as released at release_us
+   */
+  void Complete(uint8_t mask, uint64_t release_us) noexcept {
+    for (uint8_t i = 0; i < 6; ++i) {
+      if ((mask & (1U << i)) == 0) {
+        continue;
+      }
+      const uint64_t due = entries_[i].due_us;
+      if (release_us >= due) {
+        stats_.last_late_us = static_cast<uint32_t>(release_us - due);
+        stats_.max_late_us = std::max(stats_.max_late_us, stats_.last_late_us);
+      } else {
+        stats_.last_late_us = 0;
+        stats_.max_early_us =
+            std::max(stats_.max_early_us, static_cast<uint32_t>(due - release_us));
+      }
+      ++stats_.transitions;
+    }
+    ++stats_.bursts;
+    active_mask_ &= static_cast<uint8_t>(~mask);
+  }
+
+  /**
+   * @brief Transitions due within the window after the first share its burst
+   */
+  void SetMergeWindow(uint32_t window_us) noexcept {
+    merge_window_us_ = window_us;
+  }
+
+  [[nodiscard]] uint32_t MergeWindow() const noexcept {
+    return merge_window_us_;
+  }
+
+  [[nodiscard]] const PeakHoldStats& Stats() const noexcept {
+    return stats_;
+  }
+
+  void ResetStats() noexcept {
+    stats_ = PeakHoldStats{};
+  }
+
+private:
+  struct Entry {
+    uint64_t due_us{0};      ///< Absolute transition time while active
+    uint32_t peak_us{0};     ///< Peak duration
+    uint32_t hold_frame{0};  ///< Prebuilt hold setpoint write frame
+    uint16_t peak_target{0}; ///< SETPOINT value at peak current
+    uint16_t hold_target{0}; ///< SETPOINT value at hold current
+  };
+
+  std::array<Entry, 6> entries_{};                    ///< Per-channel profiles
+  PeakHoldStats stats_{};                             ///< Timing counters
+  uint32_t merge_window_us_{DEFAULT_MERGE_WINDOW_US}; ///< Burst merge window
+  uint8_t configured_mask_{0};                        ///< Channels with a profile
+  uint8_t active_mask_{0};                            ///< Channels at peak current
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_PEAK_HOLD_HPP
@@ -0,0 +1,352 @@
+/**
+ * @file tle92466ed_profiler.hpp
+ * @brief Opt-in per-register access profiler for TLE92466ED driver
+ *
+ * @details
+ * Frame counts tell what an API costs; this profiler tells which registers
+ * are hammered and by whom. With TLE92466ED_ENABLE_PROFILER defined, the
+ * driver's register access layer (ReadRegister(), WriteRegister(),
+ * ModifyRegister(), ReadRegisters() and the burst writers) reports every
+ * access, attributed to the outermost public API that caused it (ApiScope).
+ * Without the define the driver contains no profiler code or data.
+ *
+ * Per register the profiler counts reads (single-frame and burst), writes and
+ * "unchanged" reads, i.e. reads that returned the last value read or written.
+ * Advise() turns the counts into tuning hints:
+ * - Cache:    written by the driver and reads (almost) never show anything
+ *             new; keep a shadow copy instead of reading
+ * - PollLess: never written and rarely changes; poll less often or on events
+ * - Batch:    mostly single-frame reads from an API that issues several per
+ *             call; fetch them in one ReadRegisters() burst
+ *
+ * Memory: fixed tables (about 7 KB), no allocation.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_PROFILER_HPP
+#define TLE92466ED_PROFILER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace tle92466ed {
+
+/**
+ * @brief Tuning hint for a register
+ */
+enum class ProfileAdvice : uint8_t {
+  None = 0, ///< Nothing to suggest
+  Cache,    ///< Keep a shadow copy instead of reading
+  PollLess, ///< Read less often (value rarely changes)
+  Batch     ///< Read together with its neighbours in one burst
+};
+
+/**
+ * @brief Access counters of one register
+ */
+struct RegisterProfile {
+  uint16_t address{0};         ///< Register address
+  uint16_t last_value{0};      ///< Last value read or written
+  uint32_t reads{0};           ///< Reads (single-frame and burst)
+  uint32_t burst_reads{0};     ///< Reads made inside a ReadRegisters() burst
+  uint32_t writes{0};          ///< Writes
+  uint32_t unchanged_reads{0}; ///< Reads that returned last_value
+  bool has_value{false};       ///< last_value is known
+};
+
+/**
+ * @brief Access counters of one public API
+ */
+struct ApiProfile {
+  const char* name{nullptr}; ///< API name (__func__ of the outermost call)
+  uint32_t calls{0};         ///< Profiled calls
+  uint32_t reads{0};         ///< Register reads caused
+  uint32_t single_reads{0};  ///< Of those, single-frame reads
+  uint32_t writes{0};        ///< Register writes caused
+};
+
+/**
+ * @brief One line of the profiler report
+ */
+struct RegisterAdvice {
+  uint16_t address{0};                       ///< Register address
+  ProfileAdvice advice{ProfileAdvice::None}; ///< Suggested change
+  const char* top_api{nullptr};              ///< API with most accesses to the register
+  uint32_t reads{0};                         ///< Reads
+  uint32_t writes{0};                        ///< Writes
+  uint32_t unchanged_reads{0};               ///< Reads that returned the last value
+};
+
+/**
+ * @brief Register access counters, attributed to the calling API
+ *
+ * @details
+ * Registers and APIs are kept in small open-addressed tables; accesses that do
+ * not fit are counted in Overflows() instead of being recorded.
+ */
+class RegisterProfiler {
+public:
+  static constexpr std::size_t MAX_REGISTERS = 128; ///< Distinct registers tracked
+  static constexpr std::size_t MAX_APIS = 64;       ///< Distinct APIs tracked
+  static constexpr std::size_t MAX_PAIRS = 256;     ///< Distinct (register, API) pairs
+  static constexpr uint8_t NO_API = 0xFF;           ///< Access outside any ApiScope
+
+  static constexpr uint32_t MIN_READS = 8;               ///< Reads before advising
+  static constexpr uint32_t UNCHANGED_PERCENT = 90;      ///< Cache/PollLess threshold
+  static constexpr uint32_t BATCH_READS_PER_CALL_X10 = 25; ///< Batch: ≥2.5 single reads/call
+
+  /**
+   * @brief Enter an API (only the outermost API is attributed)
+   * @return true if this call became the current API
+   */
+  bool BeginApi(const char* name) noexcept {
+    if (current_api_ != NO_API) {
+      return false;
+    }
+    current_api_ = apiIndex(name);
+    if (current_api_ != NO_API) {
+      ++apis_[current_api_].calls;
+    }
+    return current_api_ != NO_API;
+  }
+
+  /**
+   * @brief Leave an API entered with BeginApi()
+   */
+  void EndApi(bool outermost) noexcept {
+    if (outermost) {
+      current_api_ = NO_API;
+    }
+  }
+
+  /**
+   * @brief Record a register read
+   * @param burst true if the read was part of a ReadRegisters() burst
+   */
+  void RecordRead(uint16_t address, uint16_t value, bool burst) noexcept {
+    RegisterProfile* reg = registerEntry(address);
+    if (reg == nullptr) {
+      return;
+    }
+    ++reg->reads;
+    reg->burst_reads += burst ? 1U : 0U;
+    reg->unchanged_reads += reg->has_value && reg->last_value == value ? 1U : 0U;
+    reg->last_value = value;
+    reg->has_value = true;
+    if (current_api_ != NO_API) {
+      ++apis_[current_api_].reads;
+      apis_[current_api_].single_reads += burst ? 0U : 1U;
+    }
+    if (Pair* pair = pairEntry(address); pair != nullptr) {
+      ++pair->accesses;
+    }
+  }
+
+  /**
+   * @brief Record a register write
+   */
+  void RecordWrite(uint16_t address, uint16_t value) noexcept {
+    RegisterProfile* reg = registerEntry(address);
+    if (reg == nullptr) {
+      return;
+    }
+    ++reg->writes;
+    reg->last_value = value;
+    reg->has_value = true;
+    if (current_api_ != NO_API) {
+      ++apis_[current_api_].writes;
+    }
+    if (Pair* pair = pairEntry(address); pair != nullptr) {
+      ++pair->accesses;
+    }
+  }
+
+  /**
+   * @brief Tracked registers (unused entries have reads == writes == 0)
+   */
+  [[nodiscard]] std::span<const RegisterProfile> Registers() const noexcept {
+    return registers_;
+  }
+
+  /**
+   * @brief Tracked APIs (unused entries have name == nullptr)
+   */
+  [[nodiscard]] std::span<const ApiProfile> Apis() const noexcept {
+    return apis_;
+  }
+
+  /**
+   * @brief Accesses not recorded because a table was full
+   */
+  [[nodiscard]] uint32_t Overflows() const noexcept {
+    return overflows_;
+  }
+
+  /**
+   * @brief Derive tuning hints
+   *
+   * @param out Report lines, one per register with an advice, busiest first
+   * @return Number of lines written
+   */
+  std::size_t Advise(std::span<RegisterAdvice> out) const noexcept {
+    std::size_t count = 0;
+    for (const auto& reg : registers_) {
+      if (reg.reads + reg.writes == 0) {
+        continue;
+      }
+      const uint8_t api = topApi(reg.address);
+      const ProfileAdvice advice = adviseRegister(reg, api);
+      if (advice == ProfileAdvice::None) {
+        continue;
+      }
+      RegisterAdvice line{reg.address, advice,     api != NO_API ? apis_[api].name : nullptr,
+                          reg.reads,   reg.writes, reg.unchanged_reads};
+      // Keep the busiest lines, sorted by reads
+      std::size_t pos = count;
+      if (count < out.size()) {
+        ++count;
+      } else if (count == 0 || out[count - 1].reads >= line.reads) {
+        continue;
+      } else {
+        pos = count - 1;
+      }
+      for (; pos > 0 && out[pos - 1].reads < line.reads; --pos) {
+        out[pos] = out[pos - 1];
+      }
+      out[pos] = line;
+    }
+    return count;
+  }
+
+  /**
+   * @brief Clear all counters
+   */
+  void Reset() noexcept {
+    registers_.fill(RegisterProfile{});
+    apis_.fill(ApiProfile{});
+    pairs_.fill(Pair{});
+    overflows_ = 0;
+    current_api_ = NO_API;
+  }
+
+private:
+  struct Pair {
+    uint16_t address{0};   ///< Register address
+    uint8_t api{NO_API};   ///< API index
+    bool used{false};      ///< Entry in use
+    uint32_t accesses{0};  ///< Reads + writes
+  };
+
+  [[nodiscard]] ProfileAdvice adviseRegister(const RegisterProfile& reg,
+                                             uint8_t api) const noexcept {
+    if (reg.reads < MIN_READS) {
+      return ProfileAdvice::None;
+    }
+    // The first read of a register can never be "unchanged"
+    if (reg.unchanged_reads * 100U >= (reg.reads - 1U) * UNCHANGED_PERCENT) {
+      return reg.writes > 0 ? ProfileAdvice::Cache : ProfileAdvice::PollLess;
+    }
+    const uint32_t single_reads = reg.reads - reg.burst_reads;
+    if (api != NO_API && single_reads * 2U > reg.reads && apis_[api].calls > 0 &&
+        apis_[api].single_reads * 10U >= apis_[api].calls * BATCH_READS_PER_CALL_X10) {
+      return ProfileAdvice::Batch;
+    }
+    return ProfileAdvice::None;
+  }
+
+  [[nodiscard]] uint8_t topApi(uint16_t address) const noexcept {
+    uint8_t best = NO_API;
+    uint32_t best_accesses = 0;
+    for (const auto& pair : pairs_) {
+      if (pair.used && pair.address == address && pair.accesses > best_accesses) {
+        best = pair.api;
+        best_accesses = pair.accesses;
+      }
+    }
+    return best;
+  }
+
+  uint8_t apiIndex(const char* name) noexcept {
+    // __func__ strings are unique objects, so the pointer identifies the API
+    const auto start = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(name) >> 3);
+    for (std::size_t probe = 0; probe < MAX_APIS; ++probe) {
+      const std::size_t i = (start + probe) % MAX_APIS;
+      if (apis_[i].name == name) {
+        return static_cast<uint8_t>(i);
+      }
+      if (apis_[i].name == nullptr) {
+        apis_[i].name = name;
+        return static_cast<uint8_t>(i);
+      }
+    }
+    ++overflows_;
+    return NO_API;
+  }
+
+  RegisterProfile* registerEntry(uint16_t address) noexcept {
+    const std::size_t start = (address * 37U) % MAX_REGISTERS;
+    for (std::size_t probe = 0; probe < MAX_REGISTERS; ++probe) {
+      auto& reg = registers_[(start + probe) % MAX_REGISTERS];
+      if (reg.address == address && (reg.reads + reg.writes) != 0) {
+        return &reg;
+      }
+      if (reg.reads + reg.writes == 0) {
+        reg.address = address;
+        return &reg;
+      }
+    }
+    ++overflows_;
+    return nullptr;
+  }
+
+  Pair* pairEntry(uint16_t address) noexcept {
+    const std::size_t start = ((address * 37U) + (current_api_ * 101U)) % MAX_PAIRS;
+    for (std::size_t probe = 0; probe < MAX_PAIRS; ++probe) {
+      auto& pair = pairs_[(start + probe) % MAX_PAIRS];
+      if (pair.used && pair.address == address && pair.api == current_api_) {
+        return &pair;
+      }
+      if (!pair.used) {
+        pair = Pair{address, current_api_, true, 0};
+        return &pair;
+      }
+    }
+    ++overflows_;
+    return nullptr;
+  }
+
+  std::array<RegisterProfile, MAX_REGISTERS> registers_{}; ///< Per-register counters
+  std::array<ApiProfile, MAX_APIS> apis_{};                ///< Per-API counters
+  std::array<Pair, MAX_PAIRS> pairs_{};                    ///< Per (register, API) counters
+  uint32_t overflows_{0};                                  ///< Accesses lost to full tables
+  uint8_t current_api_{NO_API};                            ///< Outermost API in progress
+};
+
+/**
+ * @brief RAII attribution of register accesses to a public API
+ *
+ * @details
+ * Nested scopes (an API calling another API) keep the outer attribution.
+ */
+class ApiScope {
+public:
+  ApiScope(RegisterProfiler& profiler, const char* api) noexcept
+      : profiler_(profiler), outermost_(profiler.BeginApi(api)) {}
+  ~ApiScope() noexcept {
+    profiler_.EndApi(outermost_);
+  }
+  ApiScope(const ApiScope&) = delete;
+  ApiScope& operator=(const ApiScope&) = delete;
+
+private:
+  RegisterProfiler& profiler_; ///< Profiler being attributed
+  bool outermost_;             ///< This scope set the current API
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_PROFILER_HPP
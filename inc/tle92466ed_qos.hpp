@@ -0,0 +1,228 @@
+/**
+ * @file tle92466ed_qos.hpp
+ * @brief Token-bucket bus bandwidth classes for TLE92466ED driver clients
+ *
+ * @details
+ * Several subsystems usually share one Driver and its SPI bus. BusQos gives
+ * each traffic class a token bucket measured in SPI frames, so a consumer that
+ * polls too often (e.g. a diagnostics dashboard) is deferred instead of
+ * starving setpoint updates:
+ * - Control and Safety are guaranteed classes: they are never deferred. Their
+ *   budget documents the headroom they are entitled to, and frames sent beyond
+ *   it are counted as over budget.
+ * - Telemetry and Maintenance are limited classes: a call is deferred
+ *   (DriverError::Deferred) when its bucket is empty.
+ *
+ * Admission is decided once per public API call, at its first register access,
+ * so a deferred call never leaves a half-applied change. The frames of an
+ * admitted call are charged as they are sent, which may overdraw the bucket;
+ * the debt delays the next call of the class.
+ *
+ * Cost per register access: one bucket update (integer arithmetic).
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_QOS_HPP
+#define TLE92466ED_QOS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace tle92466ed {
+
+/**
+ * @brief Bus traffic class of a driver call
+ */
+enum class BusClass : uint8_t {
+  Control = 0, ///< Setpoints, channel enables (guaranteed)
+  Safety,      ///< Fault handling, watchdog (guaranteed)
+  Telemetry,   ///< Feedback and diagnostics polling (limited)
+  Maintenance, ///< Configuration, identification, dashboards (limited)
+  COUNT        ///< Number of classes
+};
+
+/**
+ * @brief Frame budget of one bus class
+ */
+struct BusClassBudget {
+  uint32_t frames_per_second{0}; ///< Refill rate (0 = unlimited)
+  uint32_t burst_frames{0};      ///< Bucket depth (0 = one second of refill)
+};
+
+/**
+ * @brief Bus QoS configuration
+ */
+struct BusQosConfig {
+  std::array<BusClassBudget, static_cast<std::size_t>(BusClass::COUNT)> budgets{};
+  uint32_t bus_frames_per_second{0}; ///< Bus capacity for the budget check (0 = unchecked)
+};
+
+/**
+ * @brief Admission and traffic counters of one bus class
+ */
+struct BusClassStats {
+  uint32_t admitted_calls{0};     ///< Calls allowed on the bus
+  uint32_t deferred_calls{0};     ///< Calls refused with DriverError::Deferred
+  uint32_t frames{0};             ///< Frames sent
+  uint32_t over_budget_frames{0}; ///< Frames of guaranteed classes beyond their budget
+};
+
+/**
+ * @brief Per-class token buckets (frame budgets)
+ */
+class BusQos {
+public:
+  static constexpr std::size_t CLASS_COUNT = static_cast<std::size_t>(BusClass::COUNT);
+
+  /**
+   * @brief true for classes that are never deferred
+   */
+  [[nodiscard]] static constexpr bool IsGuaranteed(BusClass bus_class) noexcept {
+    return bus_class == BusClass::Control || bus_class == BusClass::Safety;
+  }
+
+  /**
+   * @brief Apply a configuration and fill all buckets
+   *
+   * @return false if the budgets exceed config.bus_frames_per_second
+   */
+  [[nodiscard]] bool Configure(const BusQosConfig& config, uint64_t now_us) noexcept {
+    uint64_t total = 0;
+    bool limited = false;
+    for (const auto& budget : config.budgets) {
+      total += budget.frames_per_second;
+      limited = limited || budget.frames_per_second != 0;
+    }
+    if (config.bus_frames_per_second != 0 && total > config.bus_frames_per_second) {
+      return false;
+    }
+    for (std::size_t i = 0; i < CLASS_COUNT; ++i) {
+      auto& bucket = buckets_[i];
+      bucket.budget = config.budgets[i];
+      if (bucket.budget.burst_frames == 0) {
+        bucket.budget.burst_frames = bucket.budget.frames_per_second;
+      }
+      bucket.milli_tokens = static_cast<int64_t>(bucket.budget.burst_frames) * 1000;
+    }
+    last_refill_us_ = now_us;
+    enabled_ = limited;
+    return true;
+  }
+
+  /**
+   * @brief true if any class has a budget
+   */
+  [[nodiscard]] bool Enabled() const noexcept {
+    return enabled_;
+  }
+
+  /**
+   * @brief Decide whether a call of the class may use the bus now
+   */
+  [[nodiscard]] bool Admit(BusClass bus_class, uint64_t now_us) noexcept {
+    refill(now_us);
+    auto& bucket = buckets_[static_cast<std::size_t>(bus_class)];
+    if (!IsGuaranteed(bus_class) && bucket.budget.frames_per_second != 0 &&
+        bucket.milli_tokens <= 0) {
+      ++bucket.stats.deferred_calls;
+      return false;
+    }
+    ++bucket.stats.admitted_calls;
+    return true;
+  }
+
+  /**
+   * @brief Charge frames sent by an admitted call
+   */
+  void Charge(BusClass bus_class, std::size_t frames) noexcept {
+    auto& bucket = buckets_[static_cast<std::size_t>(bus_class)];
+    bucket.stats.frames += static_cast<uint32_t>(frames);
+    if (bucket.budget.frames_per_second == 0) {
+      return;
+    }
+    bucket.milli_tokens -= static_cast<int64_t>(frames) * 1000;
+    if (IsGuaranteed(bus_class) && bucket.milli_tokens < 0) {
+      const int64_t over = (-bucket.milli_tokens + 999) / 1000;
+      bucket.stats.over_budget_frames += static_cast<uint32_t>(
+          over < static_cast<int64_t>(frames) ? over : static_cast<int64_t>(frames));
+    }
+  }
+
+  /**
+   * @brief Counters of a class
+   */
+  [[nodiscard]] const BusClassStats& Stats(BusClass bus_class) const noexcept {
+    return buckets_[static_cast<std::size_t>(bus_class)].stats;
+  }
+
+  /**
+   * @brief Clear all counters (budgets and tokens are kept)
+   */
+  void ResetStats() noexcept {
+    for (auto& bucket : buckets_) {
+      bucket.stats = BusClassStats{};
+    }
+  }
+
+private:
+  struct Bucket {
+    BusClassBudget budget{};  ///< Configured budget
+    int64_t milli_tokens{0};  ///< Available frames × 1000 (negative = debt)
+    BusClassStats stats{};    ///< Counters
+  };
+
+  void refill(uint64_t now_us) noexcept {
+    if (now_us <= last_refill_us_) {
+      return;
+    }
+    const uint64_t elapsed_us = now_us - last_refill_us_;
+    last_refill_us_ = now_us;
+    for (auto& bucket : buckets_) {
+      if (bucket.budget.frames_per_second == 0) {
+        continue;
+      }
+      // frames/s × µs / 1000 = milli-frames
+      const int64_t refill =
+          static_cast<int64_t>((elapsed_us * bucket.budget.frames_per_second) / 1000U);
+      const int64_t cap = static_cast<int64_t>(bucket.budget.burst_frames) * 1000;
+      bucket.milli_tokens = bucket.milli_tokens + refill > cap ? cap : bucket.milli_tokens + refill;
+    }
+  }
+
+  std::array<Bucket, CLASS_COUNT> buckets_{}; ///< One bucket per class
+  uint64_t last_refill_us_{0};                ///< Time of the last refill
+  bool enabled_{false};                       ///< Any class has a budget
+};
+
+/**
+ * @brief RAII selection of the bus class of a driver client
+ *
+ * @code
+ *   {
+ *     BusClassScope telemetry(driver, BusClass::Telemetry);
+ *     auto diag = driver.GetChannelDiagnostics(Channel::CH0); // may be Deferred
+ *   }
+ * @endcode
+ */
+template <typename DriverType>
+class BusClassScope {
+public:
+  BusClassScope(DriverType& driver, BusClass bus_class) noexcept
+      : driver_(driver), previous_(driver.SetBusClass(bus_class)) {}
+  ~BusClassScope() noexcept {
+    driver_.SetBusClass(previous_);
+  }
+  BusClassScope(const BusClassScope&) = delete;
+  BusClassScope& operator=(const BusClassScope&) = delete;
+
+private:
+  DriverType& driver_; ///< Driver whose class is selected
+  BusClass previous_;  ///< Class restored on exit
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_QOS_HPP
@@ -32,9 +32,11 @@
 #define TLE92466ED_REGISTERS_HPP
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace tle92466ed {
 
@@ -861,6 +863,248 @@ struct DitherConfig {
   }
 };
 
+//------------------------------------------------------------------------------
+// Joint dither solver
+//------------------------------------------------------------------------------
+
+constexpr uint32_t REF_CLK_HZ = 8'000'000U; ///< Default dither reference clock (Hz)
+constexpr uint8_t MAX_NUM_STEPS = 255;      ///< STEPS field limit
+constexpr uint8_t MAX_FLAT_STEPS = 255;     ///< FLAT field limit
+constexpr uint16_t MAX_STEP_SIZE = DITHER_CTRL::STEP_SIZE_MASK; ///< STEP_SIZE field limit
+constexpr uint32_t MAX_PERIOD_TICKS = (4U * MAX_NUM_STEPS) + (2U * MAX_FLAT_STEPS); ///< 1530
+
+/// Solve(): prefer more steps (smoother triangle) within this margin of the optimum
+constexpr uint32_t SOLVER_TIE_PPM = 1'000;
+/// Lookup(): STEPS <= amplitude >> 6 bounds the STEP_SIZE rounding error to 0.78 %
+constexpr uint8_t AMPLITUDE_RESOLUTION_SHIFT = 6;
+constexpr uint8_t PERIOD_BAND_SHIFT = 5; ///< Period band width: 32 reference clock ticks
+constexpr std::size_t PERIOD_BAND_COUNT = (MAX_PERIOD_TICKS >> PERIOD_BAND_SHIFT) + 1;
+
+/**
+ * @brief Dither solution with achieved vs. requested values
+ *
+ * @details
+ * Amplitudes are in register units (STEPS × STEP_SIZE on the 2A/4A per 32767
+ * scale), periods in reference clock ticks. Errors are relative, in ppm.
+ */
+struct DitherSolution {
+  DitherConfig config{};              ///< Register values
+  uint32_t requested_period_ticks{0}; ///< Requested period (ticks)
+  uint32_t achieved_period_ticks{0};  ///< 4×STEPS + 2×FLAT (ticks)
+  uint32_t requested_amplitude{0};    ///< Requested amplitude (register units)
+  uint32_t achieved_amplitude{0};     ///< STEPS × STEP_SIZE (register units)
+  uint32_t period_error_ppm{0};       ///< |achieved − requested| / requested period
+  uint32_t amplitude_error_ppm{0};    ///< |achieved − requested| / requested amplitude
+
+  /// Combined error minimized by the solver (ppm)
+  [[nodiscard]] constexpr uint32_t ErrorPpm() const noexcept {
+    return period_error_ppm + amplitude_error_ppm;
+  }
+
+  /// Achieved dither frequency (Hz)
+  [[nodiscard]] constexpr float
+  AchievedFrequencyHz(uint32_t ref_clk_hz = REF_CLK_HZ) const noexcept {
+    return achieved_period_ticks == 0
+               ? 0.0F
+               : static_cast<float>(ref_clk_hz) / static_cast<float>(achieved_period_ticks);
+  }
+
+  /// Achieved dither amplitude (mA)
+  [[nodiscard]] constexpr float AchievedAmplitudeMa(bool parallel_mode = false) const noexcept {
+    return config.CalculateAmplitudeMa(parallel_mode);
+  }
+};
+
+/**
+ * @brief Convert an amplitude to register units (STEPS × STEP_SIZE)
+ * @param amplitude_ua Dither amplitude in microamperes
+ * @param parallel_mode true if channel is in parallel mode (4A scale)
+ */
+[[nodiscard]] constexpr uint32_t AmplitudeUnits(uint32_t amplitude_ua,
+                                                bool parallel_mode = false) noexcept {
+  const uint64_t max_ua = parallel_mode ? 4'000'000U : 2'000'000U;
+  return static_cast<uint32_t>(((static_cast<uint64_t>(amplitude_ua) * 32767U) + (max_ua / 2)) /
+                               max_ua);
+}
+
+/**
+ * @brief Convert a dither frequency to reference clock ticks per period
+ * @param frequency_hz Dither frequency in Hz (0 is treated as the slowest period)
+ * @param ref_clk_hz Dither reference clock (f_sys / DITHER_CLK_DIV)
+ */
+[[nodiscard]] constexpr uint32_t PeriodTicks(uint32_t frequency_hz,
+                                             uint32_t ref_clk_hz = REF_CLK_HZ) noexcept {
+  return frequency_hz == 0 ? MAX_PERIOD_TICKS : (ref_clk_hz + (frequency_hz / 2)) / frequency_hz;
+}
+
+/**
+ * @brief Evaluate a fixed STEPS value: best FLAT and STEP_SIZE plus resulting errors
+ *
+ * @param period_ticks Requested period (ticks)
+ * @param amplitude Requested amplitude (register units)
+ * @param num_steps STEPS value (1-255)
+ */
+[[nodiscard]] constexpr DitherSolution Evaluate(uint32_t period_ticks, uint32_t amplitude,
+                                                uint8_t num_steps) noexcept {
+  auto relative_ppm = [](uint32_t achieved, uint32_t requested) -> uint32_t {
+    const uint32_t diff = achieved > requested ? achieved - requested : requested - achieved;
+    if (requested == 0) {
+      return diff == 0 ? 0U : 1'000'000U;
+    }
+    return static_cast<uint32_t>((static_cast<uint64_t>(diff) * 1'000'000U) / requested);
+  };
+
+  DitherSolution solution{};
+  const uint32_t steps = num_steps == 0 ? 1U : num_steps;
+  const uint32_t ramp_ticks = 4U * steps;
+  const uint32_t flat = period_ticks > ramp_ticks ? (period_ticks - ramp_ticks + 1U) / 2U : 0U;
+  const uint32_t step_size = (amplitude + (steps / 2U)) / steps;
+
+  solution.config.num_steps = static_cast<uint8_t>(steps);
+  solution.config.flat_steps = static_cast<uint8_t>(std::min<uint32_t>(flat, MAX_FLAT_STEPS));
+  solution.config.step_size = static_cast<uint16_t>(std::min<uint32_t>(step_size, MAX_STEP_SIZE));
+  solution.requested_period_ticks = period_ticks;
+  solution.achieved_period_ticks = ramp_ticks + (2U * solution.config.flat_steps);
+  solution.requested_amplitude = amplitude;
+  solution.achieved_amplitude = steps * solution.config.step_size;
+  solution.period_error_ppm = relative_ppm(solution.achieved_period_ticks, period_ticks);
+  solution.amplitude_error_ppm = relative_ppm(solution.achieved_amplitude, amplitude);
+  return solution;
+}
+
+/**
+ * @brief Exact joint solver over (STEPS, FLAT, STEP_SIZE)
+ *
+ * @details
+ * For every STEPS value the best FLAT and STEP_SIZE follow directly, so the
+ * search is a single pass over STEPS = 1..255 minimizing the combined
+ * period + amplitude error. Among solutions within SOLVER_TIE_PPM of the
+ * optimum the one with the most steps wins (finest triangle resolution).
+ *
+ * Integer-only and constexpr: with constant arguments the result is computed
+ * at compile time, e.g.
+ * @code
+ * constexpr auto dither =
+ *     DITHER::Solve(DITHER::PeriodTicks(50'000), DITHER::AmplitudeUnits(100'000));
+ * static_assert(dither.ErrorPpm() < 10'000);
+ * @endcode
+ *
+ * @param period_ticks Requested period (ticks)
+ * @param amplitude Requested amplitude (register units)
+ */
+[[nodiscard]] constexpr DitherSolution Solve(uint32_t period_ticks, uint32_t amplitude) noexcept {
+  uint32_t best_error = UINT32_MAX;
+  for (uint32_t steps = 1; steps <= MAX_NUM_STEPS; ++steps) {
+    const auto candidate = Evaluate(period_ticks, amplitude, static_cast<uint8_t>(steps));
+    best_error = std::min(best_error, candidate.ErrorPpm());
+  }
+  for (uint32_t steps = MAX_NUM_STEPS; steps > 1; --steps) {
+    const auto candidate = Evaluate(period_ticks, amplitude, static_cast<uint8_t>(steps));
+    if (candidate.ErrorPpm() <= best_error + SOLVER_TIE_PPM) {
+      return candidate;
+    }
+  }
+  return Evaluate(period_ticks, amplitude, 1);
+}
+
+/**
+ * @brief Build the per-band minimum STEPS table (evaluated at compile time)
+ *
+ * @details
+ * Entry b is the fewest steps that keep FLAT <= 255 for every period in band
+ * b, i.e. ceil((P_max(b) − 2 × 255) / 4). Short periods need one step.
+ */
+[[nodiscard]] consteval std::array<uint8_t, PERIOD_BAND_COUNT> BuildMinStepsTable() noexcept {
+  std::array<uint8_t, PERIOD_BAND_COUNT> table{};
+  for (std::size_t band = 0; band < PERIOD_BAND_COUNT; ++band) {
+    const uint32_t band_high = std::min<uint32_t>(
+        (static_cast<uint32_t>(band + 1) << PERIOD_BAND_SHIFT) - 1U, MAX_PERIOD_TICKS);
+    const uint32_t flat_ticks = 2U * MAX_FLAT_STEPS;
+    const uint32_t min_steps = band_high > flat_ticks ? (band_high - flat_ticks + 3U) / 4U : 1U;
+    table[band] = static_cast<uint8_t>(std::max<uint32_t>(min_steps, 1U));
+  }
+  return table;
+}
+
+/// Precomputed minimum STEPS indexed by period band (one byte per band)
+inline constexpr std::array<uint8_t, PERIOD_BAND_COUNT> MIN_STEPS_TABLE = BuildMinStepsTable();
+
+/// Lookup(): number of STEPS candidates compared below the preferred value
+constexpr uint8_t LOOKUP_CANDIDATES = 4;
+
+/**
+ * @brief O(1) table-driven solver for runtime arguments
+ *
+ * @details
+ * The period band selects the minimum STEPS from MIN_STEPS_TABLE; the period
+ * itself bounds STEPS from above (FLAT >= 0). The preferred STEPS is the
+ * largest value within these bounds that keeps the STEP_SIZE rounding error
+ * below 0.78 % (amplitude >> AMPLITUDE_RESOLUTION_SHIFT). A fixed number of
+ * candidates just below it is evaluated and the lowest combined error wins,
+ * so the cost is constant regardless of the arguments.
+ *
+ * If the amplitude cannot be reached at the requested period (STEP_SIZE
+ * limit), the candidate that keeps the period and the one that keeps the
+ * amplitude are compared instead.
+ *
+ * The result can miss the optimum of Solve() by a few percent of combined
+ * error; the configuration paths use Solve().
+ *
+ * @param period_ticks Requested period (ticks)
+ * @param amplitude Requested amplitude (register units)
+ */
+[[nodiscard]] constexpr DitherSolution Lookup(uint32_t period_ticks, uint32_t amplitude) noexcept {
+  const uint32_t clamped_period = std::min(period_ticks, MAX_PERIOD_TICKS);
+  const uint32_t min_for_step_size = (amplitude + MAX_STEP_SIZE - 1U) / MAX_STEP_SIZE;
+  const uint32_t lower = std::max<uint32_t>(MIN_STEPS_TABLE[clamped_period >> PERIOD_BAND_SHIFT],
+                                            std::max<uint32_t>(min_for_step_size, 1U));
+  const uint32_t upper = std::clamp<uint32_t>(clamped_period >> 2U, 1U, MAX_NUM_STEPS);
+
+  // On equal error the first (more steps) candidate wins
+  auto better = [](const DitherSolution& a, const DitherSolution& b) {
+    return a.ErrorPpm() <= b.ErrorPpm() ? a : b;
+  };
+
+  if (lower > upper) {
+    return better(Evaluate(period_ticks, amplitude,
+                           static_cast<uint8_t>(std::min<uint32_t>(lower, MAX_NUM_STEPS))),
+                  Evaluate(period_ticks, amplitude, static_cast<uint8_t>(upper)));
+  }
+
+  const uint32_t preferred =
+      std::clamp<uint32_t>(amplitude >> AMPLITUDE_RESOLUTION_SHIFT, lower, upper);
+  DitherSolution best = Evaluate(period_ticks, amplitude, static_cast<uint8_t>(preferred));
+  for (uint32_t i = 1; i < LOOKUP_CANDIDATES && preferred - i >= lower; ++i) {
+    best = better(best, Evaluate(period_ticks, amplitude, static_cast<uint8_t>(preferred - i)));
+  }
+  return best;
+}
+
+/**
+ * @brief Solve dither parameters from amplitude and frequency (exact joint solver)
+ *
+ * @details
+ * Runs Solve(), a single pass over the 255 STEPS values. This is a
+ * configuration path, so the exact optimum is worth more than the constant
+ * cost of Lookup().
+ *
+ * @param amplitude_ma Desired dither amplitude in milliamperes
+ * @param frequency_hz Desired dither frequency in Hz
+ * @param parallel_mode true if channel is in parallel mode
+ * @param t_ref_clk_us Reference clock period in microseconds (default: 0.125 µs)
+ * @return DitherSolution with register values and achieved vs. requested values
+ */
+[[nodiscard]] inline DitherSolution SolveFromAmplitudeFrequency(
+    float amplitude_ma, float frequency_hz, bool parallel_mode = false,
+    float t_ref_clk_us = DEFAULT_T_REF_CLK_US) noexcept {
+  constexpr float INPUT_LIMIT = static_cast<float>(UINT32_MAX / 2);
+  const float period_ticks = std::min(1'000'000.0F / (frequency_hz * t_ref_clk_us), INPUT_LIMIT);
+  const float amplitude_ua = std::min(amplitude_ma * 1000.0F, INPUT_LIMIT);
+  return Solve(static_cast<uint32_t>(std::lround(std::max(period_ticks, 0.0F))),
+               AmplitudeUnits(static_cast<uint32_t>(std::lround(std::max(amplitude_ua, 0.0F))),
+                              parallel_mode));
+}
+
 /**
  * @brief Calculate dither configuration from amplitude and frequency
  *
@@ -871,51 +1115,16 @@ struct DitherConfig {
  * @return DitherConfig structure
  *
  * @details
- * Automatically calculates step_size, num_steps, and flat_steps to achieve
- * the desired amplitude and frequency. Uses reasonable defaults for steps
- * and flat period if not specified.
+ * Register values of SolveFromAmplitudeFrequency(); use that function to also
+ * get the achieved amplitude and frequency.
  */
 [[nodiscard]] inline DitherConfig CalculateFromAmplitudeFrequency(
     float amplitude_ma,  // Current amplitude in milliamperes
     float frequency_hz,  // Dither frequency in hertz
     bool parallel_mode = false,
     float t_ref_clk_us = DEFAULT_T_REF_CLK_US) noexcept {
-
-  DitherConfig config{};
-
-  // Calculate desired period from frequency
-  float period_us = 1'000'000.0F / frequency_hz;
-
-  // Calculate dither period from formula: T_dither = [4×STEPS + 2×FLAT] × t_ref_clk
-  // Use reasonable defaults: num_steps = 16, flat_steps = 2
-  constexpr uint8_t default_steps = 16;
-  constexpr uint8_t default_flat = 2;
-
-  float calculated_period = (4.0F * default_steps + 2.0F * default_flat) * t_ref_clk_us;
-
-  // If calculated period doesn't match desired, adjust steps
-  if (calculated_period < period_us * 0.9F || calculated_period > period_us * 1.1F) {
-    // Adjust num_steps to get closer to desired period
-    float target_steps = (period_us / t_ref_clk_us - 2.0F * default_flat) / 4.0F;
-    // Clamp to valid range before casting to uint8_t
-    target_steps = std::max(1.0F, target_steps);
-    target_steps = std::min(255.0F, target_steps);
-    config.num_steps = static_cast<uint8_t>(std::lround(target_steps));
-  } else {
-    config.num_steps = default_steps;
-  }
-
-  config.flat_steps = default_flat;
-
-  // Calculate step_size from amplitude formula: I_dither = STEPS × STEP_SIZE × 2A / 32767
-  uint32_t max_current = parallel_mode ? 4000 : 2000;
-  float step_size_f = (amplitude_ma * 32767.0F) /
-                      (static_cast<float>(config.num_steps) * static_cast<float>(max_current));
-
-  config.step_size = static_cast<uint16_t>(std::lround(step_size_f));
-  config.step_size = std::min(config.step_size, static_cast<uint16_t>(DITHER_CTRL::STEP_SIZE_MASK));
-
-  return config;
+  return SolveFromAmplitudeFrequency(amplitude_ma, frequency_hz, parallel_mode, t_ref_clk_us)
+      .config;
 }
 } // namespace DITHER
 
@@ -1336,6 +1545,95 @@ enum class ParallelPair : uint8_t {
   return (received_crc == calculated_crc);
 }
 
+/**
+ * @brief Count the frames with a bad CRC in a batch of received frames
+ *
+ * @details
+ * The frame CRC is affine in the three covered bytes, so it splits into one
+ * 256-entry table per byte position: crc = T0[b0] ^ T1[b1] ^ T2[b2]. Unlike the
+ * bitwise CalculateCrc8J1850(), the per-frame work is three independent lookups
+ * without a loop-carried dependency, so consecutive frames overlap in the
+ * pipeline (and vectorize on targets with gather instructions). Costs 768 bytes
+ * of tables.
+ *
+ * @param words Received 32-bit frames (CRC in bits 31:24)
+ * @return Number of frames whose CRC does not match
+ */
+[[nodiscard]] inline std::size_t CountFrameCrcErrors(std::span<const uint32_t> words) noexcept {
+  // T[k][b]: CRC contribution of byte k = b; the constant crc(0, 0, 0) is folded into T[0]
+  static constexpr auto TABLES = [] {
+    std::array<std::array<uint8_t, 256>, 3> tables{};
+    const std::array<uint8_t, 3> zero{};
+    const uint8_t base = CalculateCrc8J1850(zero.data(), zero.size());
+    for (std::size_t k = 0; k < 3; ++k) {
+      for (std::size_t b = 0; b < 256; ++b) {
+        std::array<uint8_t, 3> bytes{};
+        bytes[k] = static_cast<uint8_t>(b);
+        tables[k][b] = static_cast<uint8_t>(CalculateCrc8J1850(bytes.data(), bytes.size()) ^
+                                            (k == 0 ? 0U : base));
+      }
+    }
+    return tables;
+  }();
+
+  std::size_t errors = 0;
+  for (const uint32_t word : words) {
+    const auto crc = static_cast<uint32_t>(TABLES[0][word & 0xFFU] ^
+                                           TABLES[1][(word >> 8) & 0xFFU] ^
+                                           TABLES[2][(word >> 16) & 0xFFU]);
+    errors += static_cast<std::size_t>(crc != (word >> 24));
+  }
+  return errors;
+}
+
+//==============================================================================
+// CRC-32 (STORED DATA: LOGS, CONFIGURATION BUNDLES)
+//==============================================================================
+
+/**
+ * @brief Continue a CRC-32 (IEEE 802.3, reflected, polynomial 0xEDB88320)
+ *
+ * @details
+ * Start with crc = 0 and feed the data in any number of pieces; the result of
+ * the last call is the CRC of the concatenated data.
+ *
+ * @param crc CRC of the preceding data (0 for the first piece)
+ * @param data Data bytes
+ * @param length Number of bytes
+ * @return CRC-32 of the data so far
+ */
+[[nodiscard]] constexpr uint32_t UpdateCrc32(uint32_t crc, const uint8_t* data,
+                                             std::size_t length) noexcept {
+  constexpr auto TABLE = [] {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t value = i;
+      for (int bit = 0; bit < 8; ++bit) {
+        value = (value & 1U) != 0 ? (value >> 1) ^ 0xEDB88320U : value >> 1;
+      }
+      table[i] = value;
+    }
+    return table;
+  }();
+
+  crc ^= 0xFFFFFFFFU;
+  for (std::size_t i = 0; i < length; ++i) {
+    crc = TABLE[(crc ^ data[i]) & 0xFFU] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFU;
+}
+
+/**
+ * @brief Calculate a CRC-32 (IEEE 802.3) in one piece
+ *
+ * @param data Data bytes
+ * @param length Number of bytes
+ * @return CRC-32 value
+ */
+[[nodiscard]] constexpr uint32_t CalculateCrc32(const uint8_t* data, std::size_t length) noexcept {
+  return UpdateCrc32(0, data, length);
+}
+
 } // namespace tle92466ed
 
 #endif // TLE92466ED_REGISTERS_HPP
@@ -22,12 +22,46 @@
 #ifndef TLE92466ED_COMMINTERFACE_HPP
 #define TLE92466ED_COMMINTERFACE_HPP
 
+#include <array>
 #include <concepts>
+#include <cstddef>
 #include <cstdarg>
 #include <cstdint>
 #include <expected>
 #include <span>
 
+//==============================================================================
+// CODE PLACEMENT HINTS
+//==============================================================================
+
+/**
+ * @brief Code placement attributes for hot and cold paths
+ *
+ * @details
+ * The driver is header-only, so every method is instantiated in the user's
+ * translation unit. On XIP-flash targets the instruction cache benefits from
+ * keeping the register access core small and separating rarely executed code:
+ * - TLE92466ED_FORCE_INLINE: thin wrappers that must vanish into their callers
+ * - TLE92466ED_NOINLINE: the full paths behind such wrappers, kept out of
+ *   every call site but optimized for speed
+ * - TLE92466ED_HOT: per-cycle paths (setpoint, feedback, register access)
+ * - TLE92466ED_COLD: initialization, configuration, diagnostics and logging;
+ *   kept out-of-line, optimized for size and placed in .text.unlikely
+ *
+ * Define TLE92466ED_DISABLE_CODE_PLACEMENT_HINTS to compile without them.
+ */
+#if defined(__GNUC__) && !defined(TLE92466ED_DISABLE_CODE_PLACEMENT_HINTS)
+#define TLE92466ED_FORCE_INLINE inline __attribute__((always_inline))
+#define TLE92466ED_NOINLINE __attribute__((noinline))
+#define TLE92466ED_HOT __attribute__((hot))
+#define TLE92466ED_COLD __attribute__((cold, noinline))
+#else
+#define TLE92466ED_FORCE_INLINE inline
+#define TLE92466ED_NOINLINE
+#define TLE92466ED_HOT
+#define TLE92466ED_COLD
+#endif
+
 namespace tle92466ed {
 
 /**
@@ -117,6 +151,61 @@ struct SPIConfig {
   uint32_t timeout_ms{100};      ///< Transaction timeout in milliseconds
 };
 
+/**
+ * @brief Timing requirements the driver declares to the CommInterface
+ *
+ * @details
+ * Instead of issuing raw blocking delays, the driver arms a deadline for one of
+ * these requirements and later awaits it. The CommInterface decides how the gap
+ * is spent: yielding to the scheduler, running unrelated bus work, and only
+ * busy-waiting the residual that is shorter than one scheduler tick.
+ */
+enum class TimingRequirement : uint8_t {
+  WriteReadback, ///< Minimum time between a register write and its verification readback
+  ResetPulse,    ///< Minimum RESN low time
+  ResetRecovery, ///< Minimum time after RESN release before the first SPI access
+  Settle,        ///< Generic settle time (diagnostics, configuration changes)
+  Transition     ///< Scheduled setpoint transition of a current profile (peak-and-hold)
+};
+
+/**
+ * @brief Minimum durations for each timing requirement (datasheet values)
+ */
+namespace Timing {
+inline constexpr uint32_t WRITE_READBACK_US = 1;      ///< Write to readback spacing
+inline constexpr uint32_t RESET_PULSE_US = 10'000;    ///< RESN low time used by the driver
+inline constexpr uint32_t RESET_RECOVERY_US = 10'000; ///< Stabilization after RESN release
+} // namespace Timing
+
+/**
+ * @brief Deadline armed against a timing requirement
+ *
+ * @details
+ * Created by SpiInterface::ArmDeadline() and consumed by SpiInterface::AwaitDeadline().
+ * When the CommInterface provides no time source, armed_at_us is 0 and the full
+ * minimum delay is waited.
+ */
+struct TimingDeadline {
+  TimingRequirement requirement{TimingRequirement::Settle}; ///< What the deadline protects
+  uint64_t armed_at_us{0};  ///< Timestamp when the deadline was armed (0 = no time source)
+  uint32_t min_delay_us{0}; ///< Minimum time that must elapse after armed_at_us
+
+  /**
+   * @brief Absolute expiry timestamp in microseconds
+   */
+  [[nodiscard]] constexpr uint64_t ExpiresAtUs() const noexcept {
+    return armed_at_us + min_delay_us;
+  }
+};
+
+/**
+ * @brief Register address/value pair for burst writes
+ */
+struct RegisterWrite {
+  uint16_t address{0}; ///< Register address
+  uint16_t value{0};   ///< Value to write
+};
+
 //==============================================================================
 // SPI FRAME STRUCTURES (32-BIT)
 //==============================================================================
@@ -374,6 +463,13 @@ enum class SPIStatus : uint8_t {
  * - Support full-duplex operation
  * - Calculate and verify CRC-8 (SAE J1850)
  *
+ * @par Optional Timing Hooks:
+ * Implementations may additionally provide these methods; they are detected at
+ * compile time and the driver falls back to Delay() when they are absent:
+ * - `uint64_t GetTimeUs() noexcept` - monotonic microsecond time source
+ * - `CommResult<void> DelayUntil(const TimingDeadline&) noexcept` - deadline wait
+ *   that yields whole scheduler ticks and busy-waits only the sub-tick residual
+ *
  * @par Example Implementation:
  * @code{.cpp}
  * class MyPlatformCommInterface : public tle92466ed::SpiInterface<MyPlatformCommInterface> {
@@ -507,6 +603,87 @@ public:
     return static_cast<Derived*>(this)->Delay(microseconds);
   }
 
+  /**
+   * @brief Get the current monotonic time in microseconds
+   *
+   * @details
+   * Forwards to the optional `uint64_t GetTimeUs()` hook of the derived class.
+   *
+   * @return Microsecond timestamp, or 0 if the CommInterface has no time source
+   */
+  [[nodiscard]] uint64_t NowUs() noexcept {
+    if constexpr (requires(Derived& d) {
+                    { d.GetTimeUs() } -> std::convertible_to<uint64_t>;
+                  }) {
+      return static_cast<Derived*>(this)->GetTimeUs();
+    } else {
+      return 0;
+    }
+  }
+
+  /**
+   * @brief Arm a deadline for a timing requirement
+   *
+   * @details
+   * Records the current time (if the derived class provides the optional
+   * `uint64_t GetTimeUs()` hook) together with the minimum delay. Any work done
+   * between ArmDeadline() and AwaitDeadline() counts towards the delay.
+   *
+   * @param requirement Timing requirement being declared
+   * @param min_delay_us Minimum time that must elapse before the next dependent access
+   * @return TimingDeadline Deadline to pass to AwaitDeadline()
+   */
+  [[nodiscard]] TimingDeadline ArmDeadline(TimingRequirement requirement,
+                                           uint32_t min_delay_us) noexcept {
+    return TimingDeadline{requirement, NowUs(), min_delay_us};
+  }
+
+  /**
+   * @brief Wait until an armed deadline has expired
+   *
+   * @details
+   * If the derived class provides the optional
+   * `CommResult<void> DelayUntil(const TimingDeadline&)` hook, the wait is
+   * delegated to it so the platform can yield or schedule unrelated bus work
+   * into the gap. Otherwise the remaining time is waited with Delay().
+   *
+   * @param deadline Deadline returned by ArmDeadline()
+   * @return CommResult<void> Success or error code
+   */
+  [[nodiscard]] CommResult<void> AwaitDeadline(const TimingDeadline& deadline) noexcept {
+    if constexpr (requires(Derived& d) {
+                    { d.DelayUntil(deadline) } -> std::same_as<CommResult<void>>;
+                  }) {
+      return static_cast<Derived*>(this)->DelayUntil(deadline);
+    } else {
+      uint32_t remaining = deadline.min_delay_us;
+      if (deadline.armed_at_us != 0) {
+        const uint64_t now = NowUs();
+        const uint64_t expires = deadline.ExpiresAtUs();
+        remaining = (now >= expires) ? 0U : static_cast<uint32_t>(expires - now);
+      }
+      if (remaining == 0) {
+        return {};
+      }
+      return static_cast<Derived*>(this)->Delay(remaining);
+    }
+  }
+
+  /**
+   * @brief Check, without waiting, whether an armed deadline is still running
+   *
+   * @details
+   * Used by resumable operations to yield instead of blocking. Without a time
+   * source the remaining time cannot be observed, so this returns false and the
+   * caller falls back to AwaitDeadline().
+   *
+   * @param deadline Deadline returned by ArmDeadline()
+   * @return true if the deadline has not expired yet
+   */
+  [[nodiscard]] bool IsDeadlinePending(const TimingDeadline& deadline) noexcept {
+    return deadline.armed_at_us != 0 && NowUs() < deadline.ExpiresAtUs();
+  }
+
   /**
    * @brief Configure SPI parameters
    *
@@ -637,6 +814,7 @@ public:
    *
    * @param address Register address (10-bit, 0x000-0x3FF)
    * @param verify_crc If true, verify CRC in response (default: true)
+   * @param raw_reply If not null, receives the raw reply frame (e.g. for a later CRC check)
    * @return CommResult<uint32_t> Register value (16-bit or 22-bit depending on reply mode) or error
    *
    * @details
@@ -657,7 +835,8 @@ public:
    *       External code should typically use the Driver API, but this method is
    *       available for advanced use cases.
    */
-  [[nodiscard]] CommResult<uint32_t> Read(uint16_t address, bool verify_crc = true) noexcept;
+  [[nodiscard]] TLE92466ED_HOT CommResult<uint32_t> Read(uint16_t address, bool verify_crc = true,
+                                                         uint32_t* raw_reply = nullptr) noexcept;
 
   /**
    * @brief Write a register to the TLE92466ED (High-Level API)
@@ -684,8 +863,81 @@ public:
    *       External code should typically use the Driver API, but this method is
    *       available for advanced use cases.
    */
-  [[nodiscard]] CommResult<void> Write(uint16_t address, uint16_t value,
-                                       bool verify_crc = true) noexcept;
+  [[nodiscard]] TLE92466ED_HOT CommResult<void> Write(uint16_t address, uint16_t value,
+                                                      bool verify_crc = true) noexcept;
+
+  /**
+   * @brief Clock out and check the reply of a write frame (High-Level API)
+   *
+   * @param verify_crc If true, verify the reply CRC
+   * @return CommResult<void> Success or error (CRC, status, critical fault)
+   *
+   * @details
+   * Second half of Write(): sends a NOP read and decodes the reply of the write
+   * frame sent last with Transfer32(). Lets callers send the write frames of
+   * several devices back to back and collect the replies afterwards.
+   */
+  [[nodiscard]] CommResult<void> CompleteWrite(bool verify_crc = true) noexcept;
+
+  /**
+   * @brief Maximum number of registers in one pipelined burst
+   */
+  static constexpr std::size_t MAX_BURST_REGISTERS = 32;
+
+  /**
+   * @brief Read several registers in one pipelined burst (High-Level API)
+   *
+   * @param addresses Register addresses to read (at most MAX_BURST_REGISTERS)
+   * @param values Output values, same size as addresses
+   * @param verify_crc If true, verify CRC of every reply
+   * @param raw_replies If not empty, receives the raw reply frames (same size as addresses)
+   * @return CommResult<void> Success or error
+   *
+   * @details
+   * The reply to a command frame arrives in the following frame, so the command
+   * of read k+1 also clocks out the reply of read k. N reads therefore cost N+1
+   * frames in a single TransferMulti() call instead of 2N Transfer32() calls.
+   *
+   * @retval CommError::InvalidParameter Size mismatch or burst too long
+   */
+  [[nodiscard]] CommResult<void> ReadMulti(std::span<const uint16_t> addresses,
+                                           std::span<uint32_t> values, bool verify_crc = true,
+                                           std::span<uint32_t> raw_replies = {}) noexcept;
+
+  /**
+   * @brief Write several registers in one pipelined burst (High-Level API)
+   *
+   * @param writes Address/value pairs in write order (at most MAX_BURST_REGISTERS)
+   * @param verify_crc If true, verify CRC of every reply
+   * @return CommResult<void> Success or error
+   *
+   * @details
+   * Same pipelining as ReadMulti(): N writes cost N+1 frames in a single
+   * TransferMulti() call. Every reply status is checked.
+   *
+   * @retval CommError::InvalidParameter Burst too long
+   */
+  [[nodiscard]] CommResult<void> WriteMulti(std::span<const RegisterWrite> writes,
+                                            bool verify_crc = true) noexcept;
+
+  /**
+   * @brief Send prebuilt write frames in one burst (High-Level API)
+   *
+   * @param frames Write frames with CRC, followed by one read frame that clocks
+   *               out the last reply (e.g. a configuration bundle variant)
+   * @param rx_scratch Receive buffer, at least frames.size() words
+   * @param verify_crc If true, verify CRC of every reply
+   * @return CommResult<void> Success or error
+   *
+   * @details
+   * The frames are passed to TransferMulti() as they are, so they can be read
+   * in place from flash. Every write reply status is checked.
+   *
+   * @retval CommError::InvalidParameter Fewer than two frames or scratch too small
+   */
+  [[nodiscard]] CommResult<void> WriteFrames(std::span<const uint32_t> frames,
+                                             std::span<uint32_t> rx_scratch,
+                                             bool verify_crc = true) noexcept;
 
   /**
    * @brief Prevent copying
@@ -713,6 +965,24 @@ protected:
    * @note Derived classes can have public destructors
    */
   ~SpiInterface() = default;
+
+  /**
+   * @brief Decode the reply frame of a read command
+   * @param word Received 32-bit frame
+   * @param verify_crc If true, verify the reply CRC
+   * @return CommResult<uint32_t> 16-bit or 22-bit data, or error
+   */
+  [[nodiscard]] static TLE92466ED_FORCE_INLINE CommResult<uint32_t>
+  parseReadReply(uint32_t word, bool verify_crc) noexcept;
+
+  /**
+   * @brief Decode the reply frame of a write command
+   * @param word Received 32-bit frame
+   * @param verify_crc If true, verify the reply CRC
+   * @return CommResult<void> Success or error (CRC, status, critical fault)
+   */
+  [[nodiscard]] static TLE92466ED_FORCE_INLINE CommResult<void>
+  parseWriteReply(uint32_t word, bool verify_crc) noexcept;
 };
 
 /**
@@ -748,7 +1018,8 @@ namespace tle92466ed {
 //==============================================================================
 
 template <typename Derived>
-inline CommResult<uint32_t> SpiInterface<Derived>::Read(uint16_t address, bool verify_crc) noexcept {
+inline CommResult<uint32_t> SpiInterface<Derived>::Read(uint16_t address, bool verify_crc,
+                                                        uint32_t* raw_reply) noexcept {
   // Create read frame
   SPIFrame tx_frame = SPIFrame::MakeRead(address);
 
@@ -771,9 +1042,53 @@ inline CommResult<uint32_t> SpiInterface<Derived>::Read(uint16_t address, bool v
     return std::unexpected(rx_result.error());
   }
 
+  if (raw_reply != nullptr) {
+    *raw_reply = *rx_result;
+  }
+
+  // Parse response frame from second transfer
+  return parseReadReply(*rx_result, verify_crc);
+}
+
+template <typename Derived>
+inline CommResult<void> SpiInterface<Derived>::Write(uint16_t address, uint16_t value,
+                                                      bool verify_crc) noexcept {
+  // Create write frame
+  SPIFrame tx_frame = SPIFrame::MakeWrite(address, value);
+
+  // Calculate and set CRC
+  tx_frame.tx_fields.crc = CalculateFrameCrc(tx_frame);
+
+  // First transfer: Send command (device processes command, returns dummy/previous data)
+  auto first_result = static_cast<Derived*>(this)->Transfer32(tx_frame.word);
+  if (!first_result) {
+    return std::unexpected(first_result.error());
+  }
+
+  // Second transfer: Send dummy command to receive response from first command
+  return CompleteWrite(verify_crc);
+}
+
+template <typename Derived>
+inline CommResult<void> SpiInterface<Derived>::CompleteWrite(bool verify_crc) noexcept {
+  // Use a NOP read command (read from address 0) as dummy
+  SPIFrame dummy_frame = SPIFrame::MakeRead(0);
+  dummy_frame.tx_fields.crc = CalculateFrameCrc(dummy_frame);
+
+  auto rx_result = static_cast<Derived*>(this)->Transfer32(dummy_frame.word);
+  if (!rx_result) {
+    return std::unexpected(rx_result.error());
+  }
+
   // Parse response frame from second transfer
+  return parseWriteReply(*rx_result, verify_crc);
+}
+
+template <typename Derived>
+inline CommResult<uint32_t> SpiInterface<Derived>::parseReadReply(uint32_t word,
+                                                                  bool verify_crc) noexcept {
   SPIFrame rx_frame{};
-  rx_frame.word = *rx_result;
+  rx_frame.word = word;
 
   // Verify CRC if requested
   if (verify_crc && !VerifyFrameCrc(rx_frame)) {
@@ -800,33 +1115,56 @@ inline CommResult<uint32_t> SpiInterface<Derived>::Read(uint16_t address, bool v
 }
 
 template <typename Derived>
-inline CommResult<void> SpiInterface<Derived>::Write(uint16_t address, uint16_t value,
-                                                      bool verify_crc) noexcept {
-  // Create write frame
-  SPIFrame tx_frame = SPIFrame::MakeWrite(address, value);
-
-  // Calculate and set CRC
-  tx_frame.tx_fields.crc = CalculateFrameCrc(tx_frame);
-
-  // First transfer: Send command (device processes command, returns dummy/previous data)
-  auto first_result = static_cast<Derived*>(this)->Transfer32(tx_frame.word);
-  if (!first_result) {
-    return std::unexpected(first_result.error());
+inline CommResult<void> SpiInterface<Derived>::ReadMulti(std::span<const uint16_t> addresses,
+                                                         std::span<uint32_t> values,
+                                                         bool verify_crc,
+                                                         std::span<uint32_t> raw_replies) noexcept {
+  const std::size_t count = addresses.size();
+  if (count != values.size() || count > MAX_BURST_REGISTERS ||
+      (!raw_replies.empty() && raw_replies.size() != count)) {
+    return std::unexpected(CommError::InvalidParameter);
+  }
+  if (count == 0) {
+    return {};
   }
 
-  // Second transfer: Send dummy command to receive response from first command
-  // Use a NOP read command (read from address 0) as dummy
+  // One command frame per register plus a trailing NOP read that clocks out the last reply
+  std::array<uint32_t, MAX_BURST_REGISTERS + 1> tx{};
+  std::array<uint32_t, MAX_BURST_REGISTERS + 1> rx{};
+  for (std::size_t i = 0; i < count; ++i) {
+    SPIFrame frame = SPIFrame::MakeRead(addresses[i]);
+    frame.tx_fields.crc = CalculateFrameCrc(frame);
+    tx[i] = frame.word;
+  }
   SPIFrame dummy_frame = SPIFrame::MakeRead(0);
   dummy_frame.tx_fields.crc = CalculateFrameCrc(dummy_frame);
+  tx[count] = dummy_frame.word;
 
-  auto rx_result = static_cast<Derived*>(this)->Transfer32(dummy_frame.word);
-  if (!rx_result) {
-    return std::unexpected(rx_result.error());
+  if (auto result = static_cast<Derived*>(this)->TransferMulti(
+          std::span<const uint32_t>(tx.data(), count + 1), std::span<uint32_t>(rx.data(), count + 1));
+      !result) {
+    return std::unexpected(result.error());
   }
 
-  // Parse response frame from second transfer
+  // Reply to command i arrives in frame i + 1
+  for (std::size_t i = 0; i < raw_replies.size(); ++i) {
+    raw_replies[i] = rx[i + 1];
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    auto value = parseReadReply(rx[i + 1], verify_crc);
+    if (!value) {
+      return std::unexpected(value.error());
+    }
+    values[i] = *value;
+  }
+  return {};
+}
+
+template <typename Derived>
+inline CommResult<void> SpiInterface<Derived>::parseWriteReply(uint32_t word,
+                                                               bool verify_crc) noexcept {
   SPIFrame rx_frame{};
-  rx_frame.word = *rx_result;
+  rx_frame.word = word;
 
   // Verify CRC if requested
   if (verify_crc && !VerifyFrameCrc(rx_frame)) {
@@ -848,6 +1186,66 @@ inline CommResult<void> SpiInterface<Derived>::Write(uint16_t address, uint16_t
   return {};
 }
 
+template <typename Derived>
+inline CommResult<void> SpiInterface<Derived>::WriteMulti(std::span<const RegisterWrite> writes,
+                                                          bool verify_crc) noexcept {
+  const std::size_t count = writes.size();
+  if (count > MAX_BURST_REGISTERS) {
+    return std::unexpected(CommError::InvalidParameter);
+  }
+  if (count == 0) {
+    return {};
+  }
+
+  std::array<uint32_t, MAX_BURST_REGISTERS + 1> tx{};
+  std::array<uint32_t, MAX_BURST_REGISTERS + 1> rx{};
+  for (std::size_t i = 0; i < count; ++i) {
+    SPIFrame frame = SPIFrame::MakeWrite(writes[i].address, writes[i].value);
+    frame.tx_fields.crc = CalculateFrameCrc(frame);
+    tx[i] = frame.word;
+  }
+  SPIFrame dummy_frame = SPIFrame::MakeRead(0);
+  dummy_frame.tx_fields.crc = CalculateFrameCrc(dummy_frame);
+  tx[count] = dummy_frame.word;
+
+  if (auto result = static_cast<Derived*>(this)->TransferMulti(
+          std::span<const uint32_t>(tx.data(), count + 1), std::span<uint32_t>(rx.data(), count + 1));
+      !result) {
+    return std::unexpected(result.error());
+  }
+
+  // Reply to command i arrives in frame i + 1
+  for (std::size_t i = 0; i < count; ++i) {
+    if (auto result = parseWriteReply(rx[i + 1], verify_crc); !result) {
+      return result;
+    }
+  }
+  return {};
+}
+
+template <typename Derived>
+inline CommResult<void> SpiInterface<Derived>::WriteFrames(std::span<const uint32_t> frames,
+                                                           std::span<uint32_t> rx_scratch,
+                                                           bool verify_crc) noexcept {
+  if (frames.size() < 2 || rx_scratch.size() < frames.size()) {
+    return std::unexpected(CommError::InvalidParameter);
+  }
+
+  if (auto result = static_cast<Derived*>(this)->TransferMulti(
+          frames, rx_scratch.first(frames.size()));
+      !result) {
+    return std::unexpected(result.error());
+  }
+
+  // Reply to write i arrives in frame i + 1; the last frame only clocks out a reply
+  for (std::size_t i = 0; i + 1 < frames.size(); ++i) {
+    if (auto result = parseWriteReply(rx_scratch[i + 1], verify_crc); !result) {
+      return result;
+    }
+  }
+  return {};
+}
+
 } // namespace tle92466ed
 
 #endif // TLE92466ED_COMMINTERFACE_HPP
@@ -0,0 +1,201 @@
+/**
+ * @file tle92466ed_telemetry.hpp
+ * @brief Telemetry snapshot and seqlock publication slot for TLE92466ED driver
+ *
+ * @details
+ * Driver::CaptureTelemetry() fills a TelemetrySample from one pipelined burst
+ * (feedback, fault words, supply voltages). A TelemetryBlock publishes the
+ * latest sample to any number of readers through a sequence lock:
+ * - Single writer (the bus owner), wait-free Publish()
+ * - Readers never block the writer and need no syscalls; a read that overlaps
+ *   a publication is detected and retried
+ * - The block is address-free (lock-free 32-bit atomics only), so it can live
+ *   in memory shared between processes or cores
+ *
+ * Payload words are accessed with relaxed atomics and ordered by fences, which
+ * keeps the protocol free of data races under the C++ memory model.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_TELEMETRY_HPP
+#define TLE92466ED_TELEMETRY_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace tle92466ed {
+
+/**
+ * @brief Telemetry of one output channel
+ */
+struct ChannelTelemetry {
+  uint16_t setpoint{0};        ///< Last written SETPOINT target (15-bit, from driver cache)
+  uint16_t average_current{0}; ///< FB_I_AVG raw value
+  uint16_t duty_cycle{0};      ///< FB_DC raw value
+  uint16_t diag_err{0};        ///< DIAG_ERR_CHGRx raw value
+  uint16_t diag_warn{0};       ///< DIAG_WARN_CHGRx raw value
+  uint16_t reserved{0};        ///< Padding (keeps the layout explicit)
+};
+
+/**
+ * @brief One telemetry snapshot of a device
+ *
+ * @details
+ * Plain, trivially copyable layout with fixed-width members so that processes
+ * built separately agree on it (checked through TelemetryBlock::version and
+ * sample_size).
+ */
+struct TelemetrySample {
+  uint64_t timestamp_us{0};  ///< CommInterface time of the capture (0 = no time source)
+  uint32_t capture_count{0}; ///< Captures made by the driver since construction
+  uint16_t global_diag0{0};  ///< GLOBAL_DIAG0 raw value
+  uint16_t global_diag1{0};  ///< GLOBAL_DIAG1 raw value
+  uint16_t global_diag2{0};  ///< GLOBAL_DIAG2 raw value
+  uint16_t fb_stat{0};       ///< FB_STAT raw value
+  uint16_t vbat_mv{0};       ///< VBAT from FB_VOLTAGE2 (mV)
+  uint16_t vio_mv{0};        ///< VIO from FB_VOLTAGE1 (mV)
+  uint16_t vdd_mv{0};        ///< VDD from FB_VOLTAGE1 (mV)
+  uint8_t enable_mask{0};    ///< Channel enable state (bits 0-5, from driver cache)
+  uint8_t mission_mode{0};   ///< 1 = Mission Mode, 0 = Config Mode
+  std::array<ChannelTelemetry, 6> channels{}; ///< Per-channel telemetry (CH0-CH5)
+};
+
+static_assert(std::is_trivially_copyable_v<TelemetrySample>);
+
+/**
+ * @brief Single-writer, multi-reader sequence lock holding one value
+ *
+ * @details
+ * The sequence counter is odd while a publication is in progress. Readers
+ * copy the payload between two reads of the counter and retry if it changed.
+ *
+ * @tparam T Trivially copyable payload
+ */
+template <typename T>
+class SeqlockSlot {
+  static_assert(std::is_trivially_copyable_v<T>, "Seqlock payload must be trivially copyable");
+  static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                "Seqlock requires lock-free 32-bit atomics");
+
+public:
+  static constexpr std::size_t WORDS = (sizeof(T) + 3) / 4; ///< Payload size in 32-bit words
+
+  /**
+   * @brief Publish a new value (single writer only)
+   */
+  void Store(const T& value) noexcept {
+    std::array<uint32_t, WORDS> words{};
+    std::memcpy(words.data(), &value, sizeof(T));
+
+    const uint32_t seq = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      words_[i].store(words[i], std::memory_order_relaxed);
+    }
+    sequence_.store(seq + 2, std::memory_order_release);
+  }
+
+  /**
+   * @brief Attempt one consistent read
+   *
+   * @param out Destination (only written on success)
+   * @return true if a consistent value was read, false if a publication overlapped
+   */
+  [[nodiscard]] bool TryLoad(T& out) const noexcept {
+    const uint32_t before = sequence_.load(std::memory_order_acquire);
+    if ((before & 1U) != 0) {
+      return false;
+    }
+    std::array<uint32_t, WORDS> words{};
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      words[i] = words_[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence_.load(std::memory_order_relaxed) != before) {
+      return false;
+    }
+    std::memcpy(static_cast<void*>(&out), words.data(), sizeof(T));
+    return true;
+  }
+
+  /**
+   * @brief Read the latest value, retrying while publications overlap
+   *
+   * @param out Destination (only written on success)
+   * @param max_attempts Upper bound on retries
+   * @return true on success, false if every attempt overlapped a publication
+   */
+  [[nodiscard]] bool Load(T& out, uint32_t max_attempts = 1000) const noexcept {
+    for (uint32_t attempt = 0; attempt < max_attempts; ++attempt) {
+      if (TryLoad(out)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Number of completed publications
+   *
+   * @details
+   * Readers poll this to detect new data without copying the payload.
+   */
+  [[nodiscard]] uint32_t Publications() const noexcept {
+    return sequence_.load(std::memory_order_acquire) / 2;
+  }
+
+private:
+  std::atomic<uint32_t> sequence_{0};                ///< Even = stable, odd = being written
+  std::array<std::atomic<uint32_t>, WORDS> words_{}; ///< Payload words
+};
+
+/**
+ * @brief Self-describing telemetry block for shared memory
+ *
+ * @details
+ * Readers validate magic, version and sample_size before trusting the slot,
+ * which catches stale segments and mismatched builds.
+ */
+struct TelemetryBlock {
+  static constexpr uint32_t MAGIC = 0x544C4554; ///< Block magic ("TELT" as big-endian)
+  static constexpr uint16_t VERSION = 1;        ///< Layout version of TelemetrySample
+  static constexpr auto SAMPLE_SIZE = static_cast<uint16_t>(sizeof(TelemetrySample));
+
+  uint32_t magic{MAGIC};                 ///< Block identification
+  uint16_t version{VERSION};             ///< Layout version
+  uint16_t sample_size{SAMPLE_SIZE};     ///< sizeof(TelemetrySample) of the publisher
+  SeqlockSlot<TelemetrySample> latest{}; ///< Latest published sample
+
+  /**
+   * @brief Check that the block was written by a compatible publisher
+   */
+  [[nodiscard]] bool IsCompatible() const noexcept {
+    return magic == MAGIC && version == VERSION && sample_size == SAMPLE_SIZE;
+  }
+
+  /**
+   * @brief Publish a sample (bus owner only)
+   */
+  void Publish(const TelemetrySample& sample) noexcept {
+    latest.Store(sample);
+  }
+
+  /**
+   * @brief Read the latest sample
+   * @return true on success
+   */
+  [[nodiscard]] bool Read(TelemetrySample& sample) const noexcept {
+    return latest.Load(sample);
+  }
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_TELEMETRY_HPP
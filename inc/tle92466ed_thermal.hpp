@@ -0,0 +1,266 @@
+/**
+ * @file tle92466ed_thermal.hpp
+ * @brief Per-channel energy and temperature-rise estimator for TLE92466ED driver
+ *
+ * @details
+ * Over-temperature diagnostics (OTE/OT warning) are reported once the device is
+ * already hot. This estimator predicts the temperature rise of each solenoid
+ * coil and of the corresponding low-side switch from average-current and VBAT
+ * feedback, so setpoints can be derated before a fault trips.
+ *
+ * Model (per channel, integer/fixed-point only):
+ * - Coil loss:  P_coil = I² · R_coil(T), with copper tempco 0.393 %/K
+ * - Duty cycle: D ≈ I · R_coil(T) / VBAT (steady-state ICC operation)
+ * - Die loss:   P_die = I² · R_DS(on) · D
+ * - First-order thermal response towards T∞ = P · R_th with time constant τ,
+ *   discretized as T += (T∞ − T) · dt / (τ + dt), which is stable for any dt
+ *
+ * Cost per sample is a handful of 64-bit multiplies/divides. The driver holds
+ * a ThermalEstimator only with TLE92466ED_ENABLE_THERMAL defined.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_THERMAL_HPP
+#define TLE92466ED_THERMAL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace tle92466ed {
+
+/**
+ * @brief Thermal model parameters for one channel
+ *
+ * @details
+ * Defaults describe a small 12 V solenoid; adapt them to the actual load.
+ */
+struct ThermalModelParams {
+  uint16_t coil_resistance_mohm{5000}; ///< Coil resistance at reference temperature (mΩ)
+  uint16_t coil_rth_dk_per_w{80};      ///< Coil thermal resistance (0.1 K/W units, 80 = 8 K/W)
+  uint32_t coil_tau_ms{120'000};       ///< Coil thermal time constant (ms)
+  uint16_t switch_rdson_mohm{200};     ///< Low-side switch on-resistance (mΩ)
+  uint16_t die_rth_dk_per_w{300};      ///< Die thermal resistance share (0.1 K/W units)
+  uint32_t die_tau_ms{2'000};          ///< Die thermal time constant (ms)
+  uint32_t max_coil_rise_mk{80'000};   ///< Coil rise limit used for derating (mK)
+  uint32_t max_die_rise_mk{60'000};    ///< Die rise limit used for derating (mK)
+  uint8_t derate_start_percent{80};    ///< Start capping above this share of a limit (%)
+};
+
+/**
+ * @brief Estimated thermal state of one channel
+ */
+struct ThermalEstimate {
+  int32_t coil_rise_mk{0};    ///< Predicted coil temperature rise above ambient (mK)
+  int32_t die_rise_mk{0};     ///< Predicted switch/die temperature rise (mK)
+  uint32_t coil_power_mw{0};  ///< Last computed coil loss (mW)
+  uint32_t die_power_mw{0};   ///< Last computed switch loss (mW)
+  uint64_t coil_energy_uj{0}; ///< Coil energy integrated since reset (µJ)
+};
+
+/**
+ * @brief Fixed-point first-order thermal estimator for all channels
+ */
+class ThermalEstimator {
+public:
+  static constexpr std::size_t CHANNEL_COUNT = 6; ///< Number of output channels
+
+  /**
+   * @brief Set model parameters for a channel
+   */
+  void SetParams(uint8_t channel_index, const ThermalModelParams& params) noexcept {
+    if (channel_index < CHANNEL_COUNT) {
+      params_[channel_index] = params;
+    }
+  }
+
+  /**
+   * @brief Get model parameters of a channel
+   */
+  [[nodiscard]] const ThermalModelParams& GetParams(uint8_t channel_index) const noexcept {
+    return params_[channel_index < CHANNEL_COUNT ? channel_index : 0];
+  }
+
+  /**
+   * @brief Get current estimate of a channel
+   */
+  [[nodiscard]] const ThermalEstimate& Get(uint8_t channel_index) const noexcept {
+    return state_[channel_index < CHANNEL_COUNT ? channel_index : 0];
+  }
+
+  /**
+   * @brief Integrate one feedback sample
+   *
+   * @param channel_index Channel index (0-5)
+   * @param current_ma Average load current over the interval (mA)
+   * @param vbat_mv Supply voltage (mV, FB_VOLTAGE2 VBAT); 0 = unknown, full duty assumed
+   * @param dt_us Interval covered by the sample (µs)
+   */
+  void Update(uint8_t channel_index, uint16_t current_ma, uint16_t vbat_mv,
+              uint32_t dt_us) noexcept {
+    if (channel_index >= CHANNEL_COUNT || dt_us == 0) {
+      return;
+    }
+    const auto& p = params_[channel_index];
+    auto& st = state_[channel_index];
+
+    const uint64_t i_ma = current_ma;
+    const uint64_t i_sq = i_ma * i_ma;
+    const uint64_t r_hot = HotResistanceMohm(p.coil_resistance_mohm, st.coil_rise_mk);
+
+    // P[mW] = I[mA]² · R[mΩ] / 1e6
+    const uint64_t p_coil = (i_sq * r_hot) / 1'000'000U;
+    const uint64_t p_die = DieLossMw(p.switch_rdson_mohm, r_hot, i_ma, vbat_mv);
+    if (vbat_mv != 0) {
+      vbat_mv_[channel_index] = vbat_mv; // Kept for CapCurrent() while the channel is off
+    }
+
+    st.coil_power_mw = static_cast<uint32_t>(p_coil);
+    st.die_power_mw = static_cast<uint32_t>(p_die);
+    st.coil_energy_uj += (p_coil * dt_us) / 1000U;
+
+    // T∞[mK] = P[mW] · Rth[0.1 K/W] / 10
+    const auto coil_target = static_cast<int64_t>(p_coil * p.coil_rth_dk_per_w / 10U);
+    const auto die_target = static_cast<int64_t>(p_die * p.die_rth_dk_per_w / 10U);
+    st.coil_rise_mk = step(st.coil_rise_mk, coil_target, dt_us, p.coil_tau_ms);
+    st.die_rise_mk = step(st.die_rise_mk, die_target, dt_us, p.die_tau_ms);
+  }
+
+  /**
+   * @brief Cap a requested current if the predicted rise is close to its limit
+   *
+   * @details
+   * Below derate_start_percent of both limits the request passes through. Above
+   * it, the current is limited to the lower of
+   * - the current whose steady-state coil rise equals the coil limit
+   *   (I_max = sqrt(ΔT_max / (R_th · R_coil))),
+   * - the highest current whose steady-state die rise stays within the die
+   *   limit at the last sampled VBAT (bisection, since D depends on I).
+   *
+   * @param channel_index Channel index (0-5)
+   * @param requested_ma Requested current (mA)
+   * @return Allowed current (mA)
+   */
+  [[nodiscard]] uint16_t CapCurrent(uint8_t channel_index, uint16_t requested_ma) const noexcept {
+    if (channel_index >= CHANNEL_COUNT) {
+      return requested_ma;
+    }
+    const auto& p = params_[channel_index];
+    const auto& st = state_[channel_index];
+
+    const int64_t coil_start =
+        static_cast<int64_t>(p.max_coil_rise_mk) * p.derate_start_percent / 100;
+    const int64_t die_start =
+        static_cast<int64_t>(p.max_die_rise_mk) * p.derate_start_percent / 100;
+    if (st.coil_rise_mk < coil_start && st.die_rise_mk < die_start) {
+      return requested_ma;
+    }
+
+    // I_max² [mA²] = ΔT[mK] · 10 / Rth[0.1 K/W] · 1e6 / R[mΩ]
+    const uint64_t r_hot = HotResistanceMohm(p.coil_resistance_mohm, st.coil_rise_mk);
+    uint64_t i_max = requested_ma;
+    if (p.coil_rth_dk_per_w != 0 && r_hot != 0) {
+      const uint64_t i_max_sq = (static_cast<uint64_t>(p.max_coil_rise_mk) * 10U * 1'000'000U) /
+                                p.coil_rth_dk_per_w / r_hot;
+      i_max = std::min(i_max, ISqrt(i_max_sq));
+    }
+
+    // P_die grows monotonically with I: largest I with P_die · Rth / 10 <= ΔT_max
+    uint64_t low = 0;
+    uint64_t high = i_max;
+    while (low < high) {
+      const uint64_t mid = (low + high + 1) / 2;
+      const uint64_t die_target =
+          DieLossMw(p.switch_rdson_mohm, r_hot, mid, vbat_mv_[channel_index]) *
+          p.die_rth_dk_per_w / 10U;
+      if (die_target <= p.max_die_rise_mk) {
+        low = mid;
+      } else {
+        high = mid - 1;
+      }
+    }
+    return static_cast<uint16_t>(low);
+  }
+
+  /**
+   * @brief Reset all estimates to ambient (keeps parameters)
+   */
+  void Reset() noexcept {
+    state_.fill(ThermalEstimate{});
+    vbat_mv_.fill(0);
+  }
+
+  /**
+   * @brief Switch loss P_die = I² · R_DS(on) · D with D ≈ I · R_coil / VBAT
+   *
+   * @param rdson_mohm Switch on-resistance (mΩ)
+   * @param r_coil_mohm Coil resistance (mΩ)
+   * @param current_ma Load current (mA)
+   * @param vbat_mv Supply voltage (mV); 0 = unknown, full duty assumed
+   * @return Loss (mW)
+   */
+  [[nodiscard]] static constexpr uint64_t DieLossMw(uint16_t rdson_mohm, uint64_t r_coil_mohm,
+                                                    uint64_t current_ma,
+                                                    uint16_t vbat_mv) noexcept {
+    // Duty cycle in Q16: D = V_coil / VBAT, V_coil[mV] = I[mA] · R[mΩ] / 1000
+    uint64_t duty_q16 = 1U << 16;
+    if (vbat_mv != 0) {
+      const uint64_t v_coil_mv = (current_ma * r_coil_mohm) / 1000U;
+      duty_q16 = std::min<uint64_t>((v_coil_mv << 16) / vbat_mv, 1U << 16);
+    }
+    return (((current_ma * current_ma * rdson_mohm) / 1'000'000U) * duty_q16) >> 16;
+  }
+
+  /**
+   * @brief Coil resistance corrected for temperature rise (copper, α = 0.00393/K)
+   */
+  [[nodiscard]] static constexpr uint64_t HotResistanceMohm(uint16_t r_ref_mohm,
+                                                            int32_t rise_mk) noexcept {
+    const int64_t r = static_cast<int64_t>(r_ref_mohm) +
+                      (static_cast<int64_t>(r_ref_mohm) * rise_mk * 393) / 100'000'000;
+    return r > 0 ? static_cast<uint64_t>(r) : 0U;
+  }
+
+  /**
+   * @brief Integer square root (floor)
+   */
+  [[nodiscard]] static constexpr uint64_t ISqrt(uint64_t value) noexcept {
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > value) {
+      bit >>= 2;
+    }
+    while (bit != 0) {
+      if (value >= result + bit) {
+        value -= result + bit;
+        result = (result >> 1) + bit;
+      } else {
+        result >>= 1;
+      }
+      bit >>= 2;
+    }
+    return result;
+  }
+
+private:
+  [[nodiscard]] static int32_t step(int32_t current, int64_t target, uint32_t dt_us,
+                                    uint32_t tau_ms) noexcept {
+    const uint64_t tau_us = static_cast<uint64_t>(tau_ms) * 1000U;
+    // alpha = dt / (tau + dt) in Q16
+    const int64_t alpha_q16 = static_cast<int64_t>((static_cast<uint64_t>(dt_us) << 16) /
+                                                   (tau_us + dt_us));
+    const int64_t next = current + (((target - current) * alpha_q16) >> 16);
+    return static_cast<int32_t>(next);
+  }
+
+  std::array<ThermalModelParams, CHANNEL_COUNT> params_{}; ///< Per-channel model parameters
+  std::array<ThermalEstimate, CHANNEL_COUNT> state_{};     ///< Per-channel estimates
+  std::array<uint16_t, CHANNEL_COUNT> vbat_mv_{};          ///< VBAT of the last sample (mV)
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_THERMAL_HPP
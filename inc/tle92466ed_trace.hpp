@@ -0,0 +1,245 @@
+/**
+ * @file tle92466ed_trace.hpp
+ * @brief Opt-in bounded binary trace of TLE92466ED driver calls and SPI frames
+ *
+ * @details
+ * With TLE92466ED_ENABLE_TRACE defined, the driver records into a TraceBuffer:
+ * - ApiBegin/ApiEnd around every public call, nested (an API calling
+ *   ReadRegister()/WriteRegister() yields spans inside its span)
+ * - one ReadFrame/WriteFrame instant per register command frame, with address
+ *   and value, timestamped when its transaction completes
+ * - one Delay per timing wait (requested deadline and measured duration)
+ *
+ * Timestamps come from the CommInterface NowUs() hook (0 without a time
+ * source; the host converter then spaces records 1 µs apart).
+ *
+ * The buffer is a ring of TLE92466ED_TRACE_RECORDS fixed-size records: the
+ * newest records are kept and Dropped() counts the overwritten ones.
+ * Serialize() writes the portable binary form read by tools/trace_convert,
+ * which converts it to Chrome trace-event JSON (loadable in Perfetto UI and
+ * chrome://tracing):
+ * @code
+ *   TraceFileHeader                       16 bytes
+ *   char names[name_count][NAME_SIZE]     NUL-padded API names
+ *   TraceRecord records[record_count]     oldest first, 16 bytes each
+ * @endcode
+ *
+ * Without the define the driver contains no trace code or data.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_TRACE_HPP
+#define TLE92466ED_TRACE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#ifndef TLE92466ED_TRACE_RECORDS
+#define TLE92466ED_TRACE_RECORDS 512 ///< Ring capacity (16 bytes per record)
+#endif
+
+namespace tle92466ed {
+
+/**
+ * @brief Kind of a trace record
+ */
+enum class TraceEventType : uint8_t {
+  ApiBegin = 0, ///< Public call entered (name = API)
+  ApiEnd,       ///< Public call left (name = API)
+  ReadFrame,    ///< Register read command frame (address, value read)
+  WriteFrame,   ///< Register write command frame (address, value written)
+  Delay         ///< Timing wait (address = TimingRequirement, value = µs waited)
+};
+
+/**
+ * @brief One trace record (binary format, little-endian)
+ */
+struct TraceRecord {
+  static constexpr uint8_t NO_NAME = 0xFF; ///< Record outside any named call
+
+  uint64_t timestamp_us{0}; ///< NowUs() when recorded
+  uint32_t value{0};        ///< Frame value, or µs waited for Delay
+  uint16_t address{0};      ///< Register address, call depth or TimingRequirement
+  uint8_t type{0};          ///< TraceEventType
+  uint8_t name{NO_NAME};    ///< Index into the name table (innermost call)
+};
+
+/**
+ * @brief Header of a serialized trace
+ */
+struct TraceFileHeader {
+  static constexpr uint32_t MAGIC = 0x43525454; ///< "TTRC" as little-endian bytes
+  static constexpr uint16_t VERSION = 1;        ///< Trace format version
+  static constexpr std::size_t NAME_SIZE = 32;  ///< Bytes per name table entry
+
+  uint32_t magic{MAGIC};     ///< Trace identification
+  uint16_t version{VERSION}; ///< Trace format version
+  uint16_t name_count{0};    ///< Entries in the name table
+  uint32_t record_count{0};  ///< Records following the name table
+  uint32_t dropped{0};       ///< Records overwritten before serialization
+};
+
+static_assert(sizeof(TraceRecord) == 16, "Trace record layout is part of the format");
+static_assert(sizeof(TraceFileHeader) == 16, "Trace header layout is part of the format");
+
+/**
+ * @brief Bounded ring of trace records
+ */
+class TraceBuffer {
+public:
+  static constexpr std::size_t CAPACITY = TLE92466ED_TRACE_RECORDS; ///< Records kept
+  static constexpr std::size_t MAX_NAMES = 64;                      ///< Distinct API names
+  static constexpr std::size_t MAX_DEPTH = 8;                       ///< Tracked call nesting
+
+  /**
+   * @brief Record entry into a public call
+   */
+  void Begin(const char* api, uint64_t now_us) noexcept {
+    const uint8_t name = nameIndex(api);
+    if (depth_ < MAX_DEPTH) {
+      stack_[depth_] = name;
+    }
+    push(now_us, TraceEventType::ApiBegin, name, depth_, 0);
+    ++depth_;
+  }
+
+  /**
+   * @brief Record exit from the call entered last
+   */
+  void End(uint64_t now_us) noexcept {
+    if (depth_ == 0) {
+      return;
+    }
+    --depth_;
+    push(now_us, TraceEventType::ApiEnd, nameAt(depth_), depth_, 0);
+  }
+
+  /**
+   * @brief Record a register command frame
+   */
+  void Frame(bool write, uint16_t address, uint32_t value, uint64_t now_us) noexcept {
+    push(now_us, write ? TraceEventType::WriteFrame : TraceEventType::ReadFrame,
+         innermostName(), address, value);
+  }
+
+  /**
+   * @brief Record a timing wait that started at start_us
+   */
+  void Wait(uint8_t requirement, uint64_t start_us, uint64_t end_us) noexcept {
+    push(start_us, TraceEventType::Delay, innermostName(), requirement,
+         static_cast<uint32_t>(end_us - start_us));
+  }
+
+  /**
+   * @brief Records currently held
+   */
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return count_;
+  }
+
+  /**
+   * @brief Records overwritten since the last Reset()
+   */
+  [[nodiscard]] uint32_t Dropped() const noexcept {
+    return dropped_;
+  }
+
+  /**
+   * @brief Bytes needed by Serialize()
+   */
+  [[nodiscard]] std::size_t SerializedSize() const noexcept {
+    return sizeof(TraceFileHeader) + (name_count_ * TraceFileHeader::NAME_SIZE) +
+           (count_ * sizeof(TraceRecord));
+  }
+
+  /**
+   * @brief Write the trace in its binary form (oldest record first)
+   * @return Bytes written, 0 if out is smaller than SerializedSize()
+   */
+  std::size_t Serialize(std::span<uint8_t> out) const noexcept {
+    if (out.size() < SerializedSize()) {
+      return 0;
+    }
+    TraceFileHeader header{};
+    header.name_count = static_cast<uint16_t>(name_count_);
+    header.record_count = static_cast<uint32_t>(count_);
+    header.dropped = dropped_;
+    uint8_t* pos = out.data();
+    std::memcpy(pos, &header, sizeof(header));
+    pos += sizeof(header);
+    for (std::size_t i = 0; i < name_count_; ++i) {
+      std::memset(pos, 0, TraceFileHeader::NAME_SIZE);
+      std::strncpy(reinterpret_cast<char*>(pos), names_[i], TraceFileHeader::NAME_SIZE - 1);
+      pos += TraceFileHeader::NAME_SIZE;
+    }
+    const std::size_t first = (head_ + CAPACITY - count_) % CAPACITY;
+    for (std::size_t i = 0; i < count_; ++i) {
+      std::memcpy(pos, &records_[(first + i) % CAPACITY], sizeof(TraceRecord));
+      pos += sizeof(TraceRecord);
+    }
+    return static_cast<std::size_t>(pos - out.data());
+  }
+
+  /**
+   * @brief Drop all records and names
+   */
+  void Reset() noexcept {
+    head_ = 0;
+    count_ = 0;
+    dropped_ = 0;
+    name_count_ = 0;
+    depth_ = 0;
+  }
+
+private:
+  void push(uint64_t now_us, TraceEventType type, uint8_t name, uint16_t address,
+            uint32_t value) noexcept {
+    records_[head_] = TraceRecord{now_us, value, address, static_cast<uint8_t>(type), name};
+    head_ = (head_ + 1) % CAPACITY;
+    if (count_ < CAPACITY) {
+      ++count_;
+    } else {
+      ++dropped_;
+    }
+  }
+
+  [[nodiscard]] uint8_t nameAt(std::size_t level) const noexcept {
+    return level < MAX_DEPTH ? stack_[level] : TraceRecord::NO_NAME;
+  }
+
+  [[nodiscard]] uint8_t innermostName() const noexcept {
+    return depth_ == 0 ? TraceRecord::NO_NAME : nameAt(depth_ - 1U);
+  }
+
+  uint8_t nameIndex(const char* api) noexcept {
+    // __func__ strings are unique objects, so the pointer identifies the API
+    for (std::size_t i = 0; i < name_count_; ++i) {
+      if (names_[i] == api) {
+        return static_cast<uint8_t>(i);
+      }
+    }
+    if (name_count_ == MAX_NAMES) {
+      return TraceRecord::NO_NAME;
+    }
+    names_[name_count_] = api;
+    return static_cast<uint8_t>(name_count_++);
+  }
+
+  std::array<TraceRecord, CAPACITY> records_{}; ///< Ring storage
+  std::array<const char*, MAX_NAMES> names_{};  ///< API name table
+  std::array<uint8_t, MAX_DEPTH> stack_{};      ///< Names of the open calls
+  std::size_t head_{0};                         ///< Next slot to write
+  std::size_t count_{0};                        ///< Records held
+  std::size_t name_count_{0};                   ///< Names in use
+  uint32_t dropped_{0};                         ///< Records overwritten
+  uint8_t depth_{0};                            ///< Open calls
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_TRACE_HPP
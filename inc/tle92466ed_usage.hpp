@@ -0,0 +1,279 @@
+/**
+ * @file tle92466ed_usage.hpp
+ * @brief Per-channel actuation usage accumulator for TLE92466ED driver
+ *
+ * @details
+ * Tracks, for every output channel, how long the load has been driven in each
+ * current band and how many off→on cycles it has performed. The data feeds
+ * lifetime/wear prediction without the application having to poll feedback.
+ *
+ * Properties:
+ * - O(1) update per setpoint or enable event (no per-sample storage)
+ * - Constant memory regardless of uptime
+ * - Persistable as a compact, CRC-32-protected blob (BLOB_SIZE bytes)
+ *
+ * The accumulator is fed by the driver from the setpoints and enable masks it
+ * already writes; feedback samples (FB_I_AVG) can be added optionally. The
+ * driver holds one only with TLE92466ED_ENABLE_USAGE defined.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_USAGE_HPP
+#define TLE92466ED_USAGE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "tle92466ed_spi_interface.hpp"
+
+namespace tle92466ed {
+
+/**
+ * @brief Per-channel actuation usage histogram with O(1) incremental update
+ *
+ * @details
+ * Setpoint bands are derived from the 15-bit SETPOINT target value
+ * (target >> BIN_SHIFT), so the band edges are 1/8 of the register scale
+ * (250 mA single / 500 mA parallel). Dwell time is only accumulated while the
+ * channel is enabled.
+ */
+class UsageAccumulator {
+public:
+  static constexpr std::size_t CHANNEL_COUNT = 6; ///< Number of output channels
+  static constexpr std::size_t BIN_COUNT = 8;     ///< Number of current bands
+  static constexpr uint8_t BIN_SHIFT = 12;        ///< 15-bit value >> 12 = band 0..7
+
+  static constexpr uint8_t BLOB_MAGIC0 = 'T'; ///< Blob magic byte 0
+  static constexpr uint8_t BLOB_MAGIC1 = 'U'; ///< Blob magic byte 1
+  static constexpr uint8_t BLOB_VERSION = 2;  ///< Blob format version (2: CRC-32 trailer)
+
+  /**
+   * @brief Lifetime usage counters for one channel
+   */
+  struct ChannelUsage {
+    std::array<uint32_t, BIN_COUNT> dwell_s{};          ///< Seconds enabled per setpoint band
+    std::array<uint32_t, BIN_COUNT> feedback_samples{}; ///< FB_I_AVG samples per measured band
+    uint32_t on_cycles{0};                              ///< Off→on transitions
+    uint32_t setpoint_changes{0};                       ///< Setpoint writes that changed the band
+  };
+
+  /// Serialized size: header (4) + per-channel counters + CRC-32 (4)
+  static constexpr std::size_t BLOB_SIZE =
+      4 + (CHANNEL_COUNT * ((2 * BIN_COUNT) + 2) * sizeof(uint32_t)) + sizeof(uint32_t);
+
+  /**
+   * @brief Map a 15-bit setpoint/feedback value to its band
+   */
+  [[nodiscard]] static constexpr uint8_t BinOf(uint16_t value) noexcept {
+    return static_cast<uint8_t>((value & 0x7FFFU) >> BIN_SHIFT);
+  }
+
+  /**
+   * @brief Record a setpoint written to a channel
+   *
+   * @param channel_index Channel index (0-5)
+   * @param target 15-bit SETPOINT target value
+   * @param now_us Current time in microseconds
+   */
+  void OnSetpoint(uint8_t channel_index, uint16_t target, uint64_t now_us) noexcept {
+    if (channel_index >= CHANNEL_COUNT) {
+      return;
+    }
+    accrue(channel_index, now_us);
+    auto& state = state_[channel_index];
+    const uint8_t bin = BinOf(target);
+    if (bin != state.bin) {
+      usage_[channel_index].setpoint_changes++;
+      state.bin = bin;
+    }
+  }
+
+  /**
+   * @brief Record a new channel enable mask (bits 0-5)
+   *
+   * @param mask Channel enable mask after the write
+   * @param now_us Current time in microseconds
+   */
+  void OnEnableMask(uint8_t mask, uint64_t now_us) noexcept {
+    const uint8_t changed = static_cast<uint8_t>((mask ^ enable_mask_) & 0x3FU);
+    if (changed == 0) {
+      return;
+    }
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ++ch) {
+      const uint8_t bit = static_cast<uint8_t>(1U << ch);
+      if ((changed & bit) == 0) {
+        continue;
+      }
+      accrue(ch, now_us);
+      if ((mask & bit) != 0) {
+        usage_[ch].on_cycles++;
+      }
+    }
+    enable_mask_ = static_cast<uint8_t>(mask & 0x3FU);
+  }
+
+  /**
+   * @brief Record an optional measured-current sample (FB_I_AVG raw value)
+   *
+   * @param channel_index Channel index (0-5)
+   * @param average_current_raw 15-bit average current feedback
+   */
+  void OnFeedbackSample(uint8_t channel_index, uint16_t average_current_raw) noexcept {
+    if (channel_index >= CHANNEL_COUNT) {
+      return;
+    }
+    usage_[channel_index].feedback_samples[BinOf(average_current_raw)]++;
+  }
+
+  /**
+   * @brief Close out dwell time of all channels up to now
+   *
+   * @details
+   * Called before counters are read or persisted so the current interval is
+   * included. Does not change the actuation state.
+   *
+   * @param now_us Current time in microseconds
+   */
+  void Advance(uint64_t now_us) noexcept {
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ++ch) {
+      accrue(ch, now_us);
+    }
+  }
+
+  /**
+   * @brief Reset the actuation state (all channels off, setpoint 0) keeping counters
+   *
+   * @details
+   * Used after a device reset: lifetime counters survive, the running intervals restart.
+   *
+   * @param now_us Current time in microseconds
+   */
+  void ResetActuation(uint64_t now_us) noexcept {
+    Advance(now_us);
+    enable_mask_ = 0;
+    for (auto& state : state_) {
+      state.bin = 0;
+    }
+  }
+
+  /**
+   * @brief Get usage counters for one channel
+   */
+  [[nodiscard]] const ChannelUsage& Get(uint8_t channel_index) const noexcept {
+    return usage_[channel_index < CHANNEL_COUNT ? channel_index : 0];
+  }
+
+  /**
+   * @brief Serialize all counters into a compact blob
+   *
+   * @details
+   * Layout (little-endian): magic[2], version, channel count, then per channel
+   * dwell_s[8], feedback_samples[8], on_cycles, setpoint_changes (uint32 each),
+   * followed by a CRC-32 (CalculateCrc32()) over everything before it.
+   *
+   * @param out Destination buffer (at least BLOB_SIZE bytes)
+   * @return Number of bytes written, or 0 if the buffer is too small
+   */
+  [[nodiscard]] std::size_t Serialize(std::span<uint8_t> out) const noexcept {
+    if (out.size() < BLOB_SIZE) {
+      return 0;
+    }
+    std::size_t pos = 0;
+    out[pos++] = BLOB_MAGIC0;
+    out[pos++] = BLOB_MAGIC1;
+    out[pos++] = BLOB_VERSION;
+    out[pos++] = static_cast<uint8_t>(CHANNEL_COUNT);
+    for (const auto& usage : usage_) {
+      for (uint32_t value : usage.dwell_s) {
+        pos = putU32(out, pos, value);
+      }
+      for (uint32_t value : usage.feedback_samples) {
+        pos = putU32(out, pos, value);
+      }
+      pos = putU32(out, pos, usage.on_cycles);
+      pos = putU32(out, pos, usage.setpoint_changes);
+    }
+    return putU32(out, pos, CalculateCrc32(out.data(), pos));
+  }
+
+  /**
+   * @brief Restore counters from a blob produced by Serialize()
+   *
+   * @param in Source buffer
+   * @return true if the blob was valid and counters were restored
+   */
+  [[nodiscard]] bool Deserialize(std::span<const uint8_t> in) noexcept {
+    if (in.size() < BLOB_SIZE || in[0] != BLOB_MAGIC0 || in[1] != BLOB_MAGIC1 ||
+        in[2] != BLOB_VERSION || in[3] != CHANNEL_COUNT) {
+      return false;
+    }
+    constexpr std::size_t CRC_POS = BLOB_SIZE - sizeof(uint32_t);
+    if (CalculateCrc32(in.data(), CRC_POS) != getU32(in, CRC_POS)) {
+      return false;
+    }
+    std::size_t pos = 4;
+    for (auto& usage : usage_) {
+      for (uint32_t& value : usage.dwell_s) {
+        value = getU32(in, pos);
+        pos += 4;
+      }
+      for (uint32_t& value : usage.feedback_samples) {
+        value = getU32(in, pos);
+        pos += 4;
+      }
+      usage.on_cycles = getU32(in, pos);
+      usage.setpoint_changes = getU32(in, pos + 4);
+      pos += 8;
+    }
+    return true;
+  }
+
+private:
+  /**
+   * @brief Running state of a channel (not persisted)
+   */
+  struct ChannelState {
+    uint64_t last_us{0};      ///< Timestamp of the last accrual
+    uint32_t residual_us{0};  ///< Sub-second remainder carried into the next accrual
+    uint8_t bin{0};           ///< Current setpoint band
+  };
+
+  void accrue(uint8_t ch, uint64_t now_us) noexcept {
+    auto& state = state_[ch];
+    if (now_us <= state.last_us) {
+      state.last_us = now_us;
+      return;
+    }
+    if ((enable_mask_ & (1U << ch)) != 0) {
+      const uint64_t elapsed = (now_us - state.last_us) + state.residual_us;
+      usage_[ch].dwell_s[state.bin] += static_cast<uint32_t>(elapsed / 1'000'000U);
+      state.residual_us = static_cast<uint32_t>(elapsed % 1'000'000U);
+    }
+    state.last_us = now_us;
+  }
+
+  static std::size_t putU32(std::span<uint8_t> out, std::size_t pos, uint32_t value) noexcept {
+    out[pos] = static_cast<uint8_t>(value);
+    out[pos + 1] = static_cast<uint8_t>(value >> 8);
+    out[pos + 2] = static_cast<uint8_t>(value >> 16);
+    out[pos + 3] = static_cast<uint8_t>(value >> 24);
+    return pos + 4;
+  }
+
+  [[nodiscard]] static uint32_t getU32(std::span<const uint8_t> in, std::size_t pos) noexcept {
+    return static_cast<uint32_t>(in[pos]) | (static_cast<uint32_t>(in[pos + 1]) << 8) |
+           (static_cast<uint32_t>(in[pos + 2]) << 16) | (static_cast<uint32_t>(in[pos + 3]) << 24);
+  }
+
+  std::array<ChannelUsage, CHANNEL_COUNT> usage_{}; ///< Persisted lifetime counters
+  std::array<ChannelState, CHANNEL_COUNT> state_{}; ///< Running intervals
+  uint8_t enable_mask_{0};                           ///< Last known enable mask
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_USAGE_HPP
@@ -0,0 +1,317 @@
+/**
+ * @file tle92466ed_views.hpp
+ * @brief Lazy channel range views with one batched register sweep
+ *
+ * @details
+ * Iterating channels with the per-channel getters costs one or more bus reads
+ * per channel and quantity. Driver::Channels() returns a ChannelView instead:
+ * a lazy range whose pipeline stages only describe what is wanted,
+ *
+ * @code
+ *   using namespace tle92466ed::views;
+ *   uint32_t total_ma = 0;
+ *   for (const ChannelSample& ch :
+ *        driver.Channels() | OnlyEnabled() | WithFeedback(ChannelField::AverageCurrent)) {
+ *     total_ma += ch.average_current_ma;
+ *   }
+ *   auto faulted = driver.Channels() | OnlyFaulted();  // nothing read yet
+ * @endcode
+ *
+ * When iteration begins, the view
+ * 1. narrows the channel set with the selection stages (OnlyEnabled(),
+ *    OnlyChannels()); the enable state comes from the driver cache,
+ * 2. reads the union of the registers required by all stages for those
+ *    channels in one pipelined sweep (Driver::FetchChannels()),
+ * 3. runs the sample filters (Where(), OnlyFaulted()) on the fetched data.
+ *
+ * Cost: one frame per fetched register plus one per burst; a sweep needs a
+ * second burst only above SpiInterface::MAX_BURST_REGISTERS registers (more
+ * than five fields of all six channels). Setpoints and the enable state come
+ * from the driver cache and cost nothing.
+ *
+ * The fetch happens once per view object; Refresh() sweeps again. A failed
+ * sweep yields an empty range, Status() reports the error. ChannelView models
+ * std::ranges::view, so standard adaptors can follow the driver stages; their
+ * filters run on the fetched data but do not contribute registers.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_VIEWS_HPP
+#define TLE92466ED_VIEWS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <ranges>
+#include <utility>
+
+#include "tle92466ed_spi_interface.hpp"
+#include "tle92466ed_registers.hpp"
+
+namespace tle92466ed {
+
+enum class DriverError : uint8_t;
+
+/**
+ * @brief Per-channel data a view fetches from the device (bit mask)
+ */
+enum class ChannelField : uint8_t {
+  None = 0,                 ///< Cached data only (setpoint, enable state)
+  AverageCurrent = 1U << 0, ///< FB_I_AVG, converted to mA
+  DutyCycle = 1U << 1,      ///< FB_DC (raw)
+  MinMaxCurrent = 1U << 2,  ///< FB_IMIN_IMAX (raw min/max)
+  VbatFeedback = 1U << 3,   ///< FB_VBAT (raw)
+  Errors = 1U << 4,         ///< DIAG_ERR_CHGRx
+  Warnings = 1U << 5,       ///< DIAG_WARN_CHGRx
+  All = 0x3F                ///< Every field
+};
+
+/// Union of two field sets
+[[nodiscard]] constexpr ChannelField operator|(ChannelField a, ChannelField b) noexcept {
+  return static_cast<ChannelField>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+}
+
+/**
+ * @brief Fetched data of one channel
+ *
+ * @details
+ * Fields that were not requested keep their zero value.
+ */
+struct ChannelSample {
+  Channel channel{Channel::CH0};  ///< Channel
+  bool enabled{false};            ///< Enable state (driver cache)
+  bool parallel{false};           ///< Part of a parallel pair (driver cache)
+  uint16_t setpoint_ma{0};        ///< Setpoint (driver cache, mA)
+  uint16_t average_current_ma{0}; ///< AverageCurrent (mA)
+  uint16_t duty_cycle{0};         ///< DutyCycle (raw)
+  uint8_t min_current{0};         ///< MinMaxCurrent: minimum (raw)
+  uint8_t max_current{0};         ///< MinMaxCurrent: maximum (raw)
+  uint16_t vbat_feedback{0};      ///< VbatFeedback (raw)
+  uint16_t diag_err{0};           ///< Errors (raw, OC/SG/OL/OTE/OLSG in bits 0-4)
+  uint16_t diag_warn{0};          ///< Warnings (raw)
+
+  /// Any error flag set (requires ChannelField::Errors)
+  [[nodiscard]] constexpr bool HasError() const noexcept {
+    return (diag_err & 0x001FU) != 0;
+  }
+};
+
+/**
+ * @brief Result of one sweep: the samples of the selected channels, in channel order
+ */
+struct ChannelSweep {
+  std::array<ChannelSample, 6> samples{}; ///< Samples, count valid
+  uint8_t count{0};                       ///< Valid samples
+
+  [[nodiscard]] const ChannelSample* begin() const noexcept {
+    return samples.data();
+  }
+  [[nodiscard]] const ChannelSample* end() const noexcept {
+    return samples.data() + count;
+  }
+};
+
+namespace views {
+
+/**
+ * @brief Selection stage: narrows the channels to fetch (no bus access)
+ */
+struct ChannelSelect {
+  uint8_t mask{0x3F};       ///< Channels to keep (bit n = CHn)
+  bool only_enabled{false}; ///< Keep only enabled channels
+};
+
+/**
+ * @brief Field stage: adds fields to the sweep
+ */
+struct FieldRequest {
+  ChannelField fields{ChannelField::None};
+};
+
+/**
+ * @brief Sample filter stage: fetches fields and keeps samples satisfying a predicate
+ */
+template <typename Predicate>
+struct SampleFilter {
+  ChannelField fields{ChannelField::None}; ///< Fields the predicate reads
+  Predicate predicate;                     ///< bool(const ChannelSample&)
+};
+
+/// Predicate of a view without sample filters
+struct AcceptAll {
+  [[nodiscard]] constexpr bool operator()(const ChannelSample& /*sample*/) const noexcept {
+    return true;
+  }
+};
+
+/// Conjunction of two predicates, evaluated left to right
+template <typename First, typename Second>
+struct BothOf {
+  First first;
+  Second second;
+
+  [[nodiscard]] constexpr bool operator()(const ChannelSample& sample) const noexcept {
+    return first(sample) && second(sample);
+  }
+};
+
+/// Predicate of OnlyFaulted()
+struct HasErrorPredicate {
+  [[nodiscard]] constexpr bool operator()(const ChannelSample& sample) const noexcept {
+    return sample.HasError();
+  }
+};
+
+/// Keep enabled channels (driver cache, evaluated when iteration begins)
+[[nodiscard]] constexpr ChannelSelect OnlyEnabled() noexcept {
+  return ChannelSelect{0x3F, true};
+}
+
+/// Keep the channels of a mask (bit n = CHn)
+[[nodiscard]] constexpr ChannelSelect OnlyChannels(uint8_t mask) noexcept {
+  return ChannelSelect{static_cast<uint8_t>(mask & 0x3FU), false};
+}
+
+/// Fetch fields for every channel in the view
+[[nodiscard]] constexpr FieldRequest WithFeedback(ChannelField fields) noexcept {
+  return FieldRequest{fields};
+}
+
+/**
+ * @brief Keep samples satisfying a predicate
+ *
+ * @param fields Fields the predicate reads (added to the sweep)
+ * @param predicate bool(const ChannelSample&), run on the fetched data
+ */
+template <typename Predicate>
+[[nodiscard]] constexpr SampleFilter<Predicate> Where(ChannelField fields,
+                                                      Predicate predicate) noexcept {
+  return SampleFilter<Predicate>{fields, std::move(predicate)};
+}
+
+/// Keep channels with an error flag set (fetches ChannelField::Errors)
+[[nodiscard]] constexpr SampleFilter<HasErrorPredicate> OnlyFaulted() noexcept {
+  return SampleFilter<HasErrorPredicate>{ChannelField::Errors, HasErrorPredicate{}};
+}
+
+} // namespace views
+
+/**
+ * @brief Lazy range of channel samples of a driver
+ *
+ * @details
+ * Created by Driver::Channels() and refined with the stages of namespace
+ * views. Copying a view copies its description (and the samples, once
+ * fetched). The driver must outlive the view.
+ *
+ * @tparam DriverT Driver<CommType>
+ * @tparam Predicate Combined sample filter
+ */
+template <typename DriverT, typename Predicate = views::AcceptAll>
+class ChannelView : public std::ranges::view_interface<ChannelView<DriverT, Predicate>> {
+public:
+  ChannelView() noexcept = default;
+
+  ChannelView(DriverT& driver, views::ChannelSelect select, ChannelField fields,
+              Predicate predicate) noexcept
+      : driver_(&driver), select_(select), fields_(fields), predicate_(std::move(predicate)) {}
+
+  /// Samples passing all stages; sweeps the device on first use
+  [[nodiscard]] const ChannelSample* begin() noexcept {
+    ensureFetched();
+    return sweep_.begin();
+  }
+
+  [[nodiscard]] const ChannelSample* end() noexcept {
+    ensureFetched();
+    return sweep_.end();
+  }
+
+  /**
+   * @brief Sweep the device again, replacing the samples
+   * @return DriverResult<void> Success or the sweep error (range is empty)
+   */
+  std::expected<void, DriverError> Refresh() noexcept {
+    sweep_.count = 0;
+    fetched_ = true;
+    status_ = {};
+    if (driver_ == nullptr) {
+      return status_;
+    }
+    const uint8_t mask = select_.only_enabled
+                             ? static_cast<uint8_t>(select_.mask & driver_->GetEnabledChannelMask())
+                             : select_.mask;
+    ChannelSweep fetched{};
+    status_ = driver_->FetchChannels(mask, fields_, fetched);
+    if (!status_) {
+      return status_;
+    }
+    for (uint8_t i = 0; i < fetched.count; ++i) {
+      if (predicate_(fetched.samples[i])) {
+        sweep_.samples[sweep_.count++] = fetched.samples[i];
+      }
+    }
+    return status_;
+  }
+
+  /// Result of the last sweep (success before the first one)
+  [[nodiscard]] std::expected<void, DriverError> Status() const noexcept {
+    return status_;
+  }
+
+  /// Fields the sweep reads
+  [[nodiscard]] ChannelField Fields() const noexcept {
+    return fields_;
+  }
+
+  /// Channels selected before the enable filter (bit n = CHn)
+  [[nodiscard]] views::ChannelSelect Selection() const noexcept {
+    return select_;
+  }
+
+  /// Narrow the channel set
+  friend ChannelView operator|(ChannelView view, views::ChannelSelect select) noexcept {
+    view.select_.mask &= select.mask;
+    view.select_.only_enabled = view.select_.only_enabled || select.only_enabled;
+    view.fetched_ = false;
+    return view;
+  }
+
+  /// Add fields to the sweep
+  friend ChannelView operator|(ChannelView view, views::FieldRequest request) noexcept {
+    view.fields_ = view.fields_ | request.fields;
+    view.fetched_ = false;
+    return view;
+  }
+
+  /// Add fields and a sample filter
+  template <typename Next>
+  friend ChannelView<DriverT, views::BothOf<Predicate, Next>>
+  operator|(ChannelView view, views::SampleFilter<Next> filter) noexcept {
+    return ChannelView<DriverT, views::BothOf<Predicate, Next>>(
+        *view.driver_, view.select_, view.fields_ | filter.fields,
+        views::BothOf<Predicate, Next>{std::move(view.predicate_), std::move(filter.predicate)});
+  }
+
+private:
+  void ensureFetched() noexcept {
+    if (!fetched_) {
+      (void)Refresh();
+    }
+  }
+
+  DriverT* driver_{nullptr};                  ///< Swept driver
+  views::ChannelSelect select_{};             ///< Channel selection
+  ChannelField fields_{ChannelField::None};   ///< Fields to fetch
+  Predicate predicate_{};                     ///< Sample filter
+  ChannelSweep sweep_{};                      ///< Samples passing the filter
+  std::expected<void, DriverError> status_{}; ///< Result of the last sweep
+  bool fetched_{false};                       ///< sweep_ is current
+};
+
+} // namespace tle92466ed
+
+#endif // TLE92466ED_VIEWS_HPP
@@ -31,160 +31,329 @@ namespace tle92466ed {
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::Init() noexcept {
-  // 1. Initialize CommInterface (GPIO and SPI bus only)
-  if (auto result = comm_.Init(); !result) {
-    return std::unexpected(DriverError::HardwareError);
+  TLE92466ED_API_ENTRY();
+  // Same state machine as BeginInit()/Step(), run to completion with blocking waits
+  OperationState op{};
+  if (auto result = beginOperation(op, Operation::Init); !result) {
+    return result;
   }
+  return runOperation(op);
+}
 
-  // 2. Perform device reset sequence
-  // RESN is active low: LOW = reset, HIGH = normal operation
-  // EN is active high: HIGH = enabled, LOW = disabled
-  // We keep EN disabled during initialization - user must explicitly enable
-  comm_.Log(LogLevel::Info, "TLE92466ED", "Performing device reset sequence...\n");
+template <typename CommType>
+DriverResult<bool> Driver<CommType>::runInitPhase(OperationState& op, bool blocking) noexcept {
+  switch (op.phase) {
+  case OpPhase::InitReset:
+    // 1. Initialize CommInterface (GPIO and SPI bus only)
+    if (auto result = comm_.Init(); !result) {
+      return std::unexpected(DriverError::HardwareError);
+    }
 
-  // Step 1: Ensure EN is LOW (disabled) during reset
-  if (auto result = SetEnable(false); !result) {
-    comm_.Log(LogLevel::Warn, "TLE92466ED",
-              "Failed to set EN pin LOW (error: %u) - continuing anyway\n",
-              static_cast<unsigned>(result.error()));
-  }
+    // 2. Perform device reset sequence
+    // RESN is active low: LOW = reset, HIGH = normal operation
+    // EN is active high: HIGH = enabled, LOW = disabled
+    // We keep EN disabled during initialization - user must explicitly enable
+    comm_.Log(LogLevel::Info, "TLE92466ED", "Performing device reset sequence...\n");
 
-  // Step 2: Hold device in reset (LOW)
-  if (auto result = SetReset(true); !result) {
-    comm_.Log(LogLevel::Error, "TLE92466ED", "Failed to hold device in reset (error: %u)\n",
-              static_cast<unsigned>(result.error()));
-    return std::unexpected(DriverError::HardwareError);
-  }
-  comm_.Log(LogLevel::Info, "TLE92466ED", "  RESN set LOW (device in reset)\n");
+    // Step 1: Ensure EN is LOW (disabled) during reset
+    if (auto result = SetEnable(false); !result) {
+      comm_.Log(LogLevel::Warn, "TLE92466ED",
+                "Failed to set EN pin LOW (error: %u) - continuing anyway\n",
+                static_cast<unsigned>(result.error()));
+    }
 
-  // Step 3: Wait for reset pulse duration (minimum 10ms per datasheet)
-  if (auto result = comm_.Delay(10000); !result) { // 10ms = 10000 microseconds
-    return std::unexpected(DriverError::HardwareError);
-  }
+    // Step 2: Hold device in reset (LOW)
+    if (auto result = SetReset(true); !result) {
+      comm_.Log(LogLevel::Error, "TLE92466ED", "Failed to hold device in reset (error: %u)\n",
+                static_cast<unsigned>(result.error()));
+      return std::unexpected(DriverError::HardwareError);
+    }
+    // Arm the reset pulse deadline right after RESN goes low so logging counts towards it
+    op.deadline = comm_.ArmDeadline(TimingRequirement::ResetPulse, Timing::RESET_PULSE_US);
+    comm_.Log(LogLevel::Info, "TLE92466ED", "  RESN set LOW (device in reset)\n");
+    op.phase = OpPhase::InitResetPulse;
+    return true;
+
+  case OpPhase::InitResetPulse:
+  case OpPhase::InitResetRecovery:
+    // Step 3: Wait for reset pulse duration (minimum 10ms per datasheet)
+    // Step 5: Wait for device to stabilize after reset release (minimum 10ms per datasheet)
+    if (!blocking && comm_.IsDeadlinePending(op.deadline)) {
+      return false;
+    }
+    if (auto result = awaitDeadline(op.deadline); !result) {
+      return std::unexpected(DriverError::HardwareError);
+    }
+    if (op.phase == OpPhase::InitResetPulse) {
+      op.phase = OpPhase::InitRelease;
+      return true;
+    }
+    comm_.Log(LogLevel::Info, "TLE92466ED",
+              "✅ Device reset sequence completed (EN remains disabled)\n");
+    op.phase = OpPhase::InitClock;
+    return true;
+
+  case OpPhase::InitRelease:
+    // Step 4: Release reset (HIGH)
+    if (auto result = SetReset(false); !result) {
+      comm_.Log(LogLevel::Error, "TLE92466ED", "Failed to release device from reset (error: %u)\n",
+                static_cast<unsigned>(result.error()));
+      return std::unexpected(DriverError::HardwareError);
+    }
+    op.deadline = comm_.ArmDeadline(TimingRequirement::ResetRecovery, Timing::RESET_RECOVERY_US);
+    comm_.Log(LogLevel::Info, "TLE92466ED", "  RESN set HIGH (device released from reset)\n");
+    op.phase = OpPhase::InitResetRecovery;
+    return true;
+
+  case OpPhase::InitClock:
+    // 3. Read and diagnose CLK_DIV register to check clock configuration
+    // This helps diagnose clock-related critical faults early
+    diagnoseClockConfiguration();
+    op.phase = OpPhase::InitVerify;
+    return true;
+
+  case OpPhase::InitVerify: {
+    // 4. Verify device communication by reading IC version
+    auto verify_result = VerifyDevice();
+    if (!verify_result) {
+      return std::unexpected(verify_result.error());
+    }
+    if (!*verify_result) {
+      return std::unexpected(DriverError::WrongDeviceID);
+    }
 
-  // Step 4: Release reset (HIGH)
-  if (auto result = SetReset(false); !result) {
-    comm_.Log(LogLevel::Error, "TLE92466ED", "Failed to release device from reset (error: %u)\n",
-              static_cast<unsigned>(result.error()));
-    return std::unexpected(DriverError::HardwareError);
+    // 5. Device starts in Config Mode after power-up
+    mission_mode_ = false;
+    op.phase = OpPhase::InitDefaults;
+    return true;
   }
-  comm_.Log(LogLevel::Info, "TLE92466ED", "  RESN set HIGH (device released from reset)\n");
 
-  // Step 5: Wait for device to stabilize after reset release (minimum 10ms per datasheet)
-  if (auto result = comm_.Delay(10000); !result) { // 10ms = 10000 microseconds
-    return std::unexpected(DriverError::HardwareError);
-  }
+  case OpPhase::InitDefaults:
+    // 6. Apply default configuration (global part only with lazy channel init)
+    if (auto result = applyDefaultConfigStep(op.index); !result) {
+      return std::unexpected(result.error());
+    }
+    if (++op.index == (lazy_channel_init_ ? GLOBAL_DEFAULT_STEPS : DEFAULT_CONFIG_STEPS)) {
+      op.index = 0;
+      op.phase = OpPhase::InitClearFaults;
+    }
+    return true;
 
-  comm_.Log(LogLevel::Info, "TLE92466ED",
-            "✅ Device reset sequence completed (EN remains disabled)\n");
+  case OpPhase::InitClearFaults:
+    // 7. Clear any power-on reset flags (skip initialization check during Init)
+    if (auto result = clearFaultRegister(op.index); !result) {
+      return std::unexpected(result.error());
+    }
+    if (++op.index == FAULT_CLEAR_COUNT) {
+      op.index = 0;
+      op.phase = OpPhase::InitFinish;
+    }
+    return true;
+
+  case OpPhase::InitFinish:
+    // 8. Initialize cached state
+    ch_ctrl_cache_ = 0; // CH_CTRL cache (reads return 0x0000, so we track state here)
+    channel_enable_cache_ = 0;
+    vio_5v_mode_ = false; // Default to 3.3V mode (VIO_SEL=0)
+    channel_setpoints_.fill(0);
+    staged_setpoint_mask_ = 0;
+    peak_hold_.Cancel(CH_CTRL::ALL_CH_MASK);
+    pending_defaults_ = lazy_channel_init_ ? ALL_CHANNEL_DEFAULTS : 0;
+    crc_enabled_ = false; // CRC starts disabled until user explicitly enables it
+#ifdef TLE92466ED_ENABLE_USAGE
+    usage_.ResetActuation(comm_.NowUs()); // Lifetime counters survive, running intervals restart
+#endif
 
-  // 3. Read and diagnose CLK_DIV register to check clock configuration
-  // This helps diagnose clock-related critical faults early
-  diagnoseClockConfiguration();
+    initialized_ = true;
+    op.phase = OpPhase::Done;
+    return true;
 
-  // 4. Verify device communication by reading IC version
-  auto verify_result = VerifyDevice();
-  if (!verify_result) {
-    return std::unexpected(verify_result.error());
-  }
-  if (!*verify_result) {
-    return std::unexpected(DriverError::WrongDeviceID);
+  default:
+    return std::unexpected(DriverError::ConfigurationError);
   }
+}
 
-  // 5. Device starts in Config Mode after power-up
-  mission_mode_ = false;
+template <typename CommType>
+DriverResult<void> Driver<CommType>::applyDefaultConfigStep(uint8_t step) noexcept {
+  if (step == 0) {
+    // Configure GLOBAL_CONFIG: Enable CRC and clock watchdog
+    // Note: SPI watchdog is DISABLED by default because it requires periodic reloading
+    //       If enabled without periodic reload, the device will timeout and enter Config Mode
+    //       User should enable SPI watchdog only if they can guarantee periodic reloading
+    // Note: VIO_SEL is NOT set (defaults to 0 = 3.3V mode) to match typical use case
+    // If user needs 5V mode, they should call ConfigureGlobal() with vio_5v=true
+    uint16_t global_cfg =
+        GLOBAL_CONFIG::CRC_EN |
+        // GLOBAL_CONFIG::SPI_WD_EN |  // Disabled by default - requires periodic reload
+        GLOBAL_CONFIG::CLK_WD_EN;
+    // VIO_SEL = 0 (3.3V mode) - bit 14 is NOT set, ensuring 3.3V mode
+    // This prevents false VIO undervoltage faults when using 3.3V supply
+    // Note: VIO thresholds are FIXED hardware values (not programmable)
+    //       We can only select 3.3V or 5V mode via VIO_SEL bit
+    //       - 3.3V mode: UV=2.6-3.0V, OV=3.6-4.1V (typical: 2.8V, 3.85V)
+    //       - 5V mode: UV=3.7-4.5V, OV=5.5-6.4V (typical: 4.1V, 5.95V)
+
+    if (auto result = WriteRegister(CentralReg::GLOBAL_CONFIG, global_cfg, false); !result) {
+      return std::unexpected(result.error());
+    }
 
-  // 6. Apply default configuration
-  if (auto result = applyDefaultConfig(); !result) {
-    return std::unexpected(result.error());
+    // Update internal CRC enable state (CRC_EN is enabled in default config)
+    crc_enabled_ = true;
+    return {};
   }
 
-  // 7. Clear any power-on reset flags (skip initialization check during Init)
-  if (auto result = clearFaultsInternal(); !result) {
-    return std::unexpected(result.error());
+  if (step == 1) {
+    // Set default VBAT thresholds (UV=7V, OV=40V)
+    // Use internal version that doesn't check initialization (called during Init);
+    // the VBAT fault latches are cleared by the next step
+    return setVbatThresholdsInternal(7.0f, 40.0f, false);
   }
 
-  // 8. Initialize cached state
-  ch_ctrl_cache_ = 0; // CH_CTRL cache (reads return 0x0000, so we track state here)
-  channel_enable_cache_ = 0;
-  vio_5v_mode_ = false; // Default to 3.3V mode (VIO_SEL=0)
-  channel_setpoints_.fill(0);
-  crc_enabled_ = false; // CRC starts disabled until user explicitly enables it
+  if (step == 2) {
+    clearVbatFaultLatch();
+    return {};
+  }
 
-  initialized_ = true;
-  return {};
+  // Configure all channels with default settings (ICC mode, 2.5V/us slew, setpoint 0),
+  // three register writes per channel
+  const uint8_t channel_step = step - GLOBAL_DEFAULT_STEPS;
+  const RegisterWrite write = channelDefaultWrite(
+      static_cast<Channel>(channel_step / CHANNEL_DEFAULT_WRITES),
+      static_cast<uint8_t>(channel_step % CHANNEL_DEFAULT_WRITES));
+  return WriteRegister(write.address, write.value, false);
 }
 
 template <typename CommType>
-DriverResult<void> Driver<CommType>::applyDefaultConfig() noexcept {
-  // Configure GLOBAL_CONFIG: Enable CRC and clock watchdog
-  // Note: SPI watchdog is DISABLED by default because it requires periodic reloading
-  //       If enabled without periodic reload, the device will timeout and enter Config Mode
-  //       User should enable SPI watchdog only if they can guarantee periodic reloading
-  // Note: VIO_SEL is NOT set (defaults to 0 = 3.3V mode) to match typical use case
-  // If user needs 5V mode, they should call ConfigureGlobal() with vio_5v=true
-  uint16_t global_cfg =
-      GLOBAL_CONFIG::CRC_EN |
-      // GLOBAL_CONFIG::SPI_WD_EN |  // Disabled by default - requires periodic reload
-      GLOBAL_CONFIG::CLK_WD_EN;
-  // VIO_SEL = 0 (3.3V mode) - bit 14 is NOT set, ensuring 3.3V mode
-  // This prevents false VIO undervoltage faults when using 3.3V supply
-  // Note: VIO thresholds are FIXED hardware values (not programmable)
-  //       We can only select 3.3V or 5V mode via VIO_SEL bit
-  //       - 3.3V mode: UV=2.6-3.0V, OV=3.6-4.1V (typical: 2.8V, 3.85V)
-  //       - 5V mode: UV=3.7-4.5V, OV=5.5-6.4V (typical: 4.1V, 5.95V)
-
-  if (auto result = WriteRegister(CentralReg::GLOBAL_CONFIG, global_cfg, false); !result) {
-    return std::unexpected(result.error());
-  }
-
-  // Update internal CRC enable state (CRC_EN is enabled in default config)
-  crc_enabled_ = true;
-
-  // Set default VBAT thresholds (UV=7V, OV=40V)
-  // Use internal version that doesn't check initialization (called during Init)
-  if (auto result = setVbatThresholdsInternal(7.0f, 40.0f); !result) {
-    return std::unexpected(result.error());
+std::size_t Driver<CommType>::collectChannelDefaults(uint8_t channels,
+                                                     std::span<const RegisterWrite> written,
+                                                     std::span<RegisterWrite> out) const noexcept {
+  std::size_t count = 0;
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((channels & (1U << ch)) == 0) {
+      continue;
+    }
+    // Write index 0 is MODE, which only accepts writes in Config Mode
+    for (uint8_t i = mission_mode_ ? 1 : 0; i < CHANNEL_DEFAULT_WRITES && count < out.size();
+         ++i) {
+      if ((pending_defaults_ & (1U << ((8U * i) + ch))) == 0) {
+        continue;
+      }
+      const RegisterWrite write = channelDefaultWrite(static_cast<Channel>(ch), i);
+      bool overridden = false;
+      for (const auto& user : written) {
+        overridden = overridden || user.address == write.address;
+      }
+      if (!overridden) {
+        out[count++] = write;
+      }
+    }
   }
+  return count;
+}
 
-  // Configure all channels with default settings (ICC mode, 1V/us slew, disabled)
-  for (uint8_t ch = 0; ch < static_cast<uint8_t>(Channel::COUNT); ++ch) {
-    auto channel = static_cast<Channel>(ch);
-    uint16_t ch_base = GetChannelBase(channel);
-
-    // Set mode to ICC (0x0001)
-    if (auto result = WriteRegister(ch_base + ChannelReg::MODE,
-                                    static_cast<uint16_t>(ChannelMode::ICC), false);
-        !result) {
-      return std::unexpected(result.error());
+template <typename CommType>
+void Driver<CommType>::clearPendingDefaults(std::span<const RegisterWrite> written) noexcept {
+  // A MODE write in Mission Mode is ignored by the device, so its default stays pending
+  const uint8_t first = mission_mode_ ? 1 : 0;
+  for (const auto& write : written) {
+    for (uint8_t ch = 0; ch < 6; ++ch) {
+      for (uint8_t i = first; i < CHANNEL_DEFAULT_WRITES; ++i) {
+        if (channelDefaultWrite(static_cast<Channel>(ch), i).address == write.address) {
+          pending_defaults_ &= ~(1U << ((8U * i) + ch));
+        }
+      }
     }
+  }
+}
 
-    // Set default CH_CONFIG (slew rate 2.5V/us, OL disabled)
-    if (auto result =
-            WriteRegister(ch_base + ChannelReg::CH_CONFIG, CH_CONFIG::SLEWR_2V5_US, false);
-        !result) {
-      return std::unexpected(result.error());
+template <typename CommType>
+bool Driver<CommType>::pendingDefaultValue(uint16_t address, uint16_t& value) const noexcept {
+  // Only defaults the next write to the channel would send stand in for the register
+  if (pending_defaults_ == 0) [[likely]] {
+    return false;
+  }
+  const uint8_t channel = pendingDefaultsOf(address);
+  std::array<RegisterWrite, CHANNEL_DEFAULT_WRITES> defaults{};
+  const std::size_t count = collectChannelDefaults(channel, {}, defaults);
+  for (std::size_t i = 0; i < count; ++i) {
+    if (defaults[i].address == address) {
+      value = defaults[i].value;
+      return true;
     }
+  }
+  return false;
+}
 
-    // Set current setpoint to 0
-    if (auto result = WriteRegister(ch_base + ChannelReg::SETPOINT, 0, false); !result) {
-      return std::unexpected(result.error());
+template <typename CommType>
+DriverResult<void> Driver<CommType>::writeBurst(std::span<const RegisterWrite> writes,
+                                                bool verify_crc) noexcept {
+  // Pending defaults of the touched channels lead the burst (MODE only in Config Mode)
+  uint8_t channels = 0;
+  if (pending_defaults_ != 0) [[unlikely]] {
+    for (const auto& write : writes) {
+      channels |= pendingDefaultsOf(write.address);
     }
   }
 
-  // Note: SPI watchdog is disabled by default, so no need to reload here
-  // If user enables SPI watchdog via ConfigureGlobal(), they must call ReloadSpiWatchdog()
-  // periodically
+  std::array<RegisterWrite, CommType::MAX_BURST_REGISTERS> burst{};
+  std::size_t count = collectChannelDefaults(channels, writes, burst);
+  if (count + writes.size() > burst.size()) {
+    return std::unexpected(DriverError::InvalidParameter);
+  }
+  for (const auto& write : writes) {
+    burst[count++] = write;
+  }
 
+  if (!comm_.IsReady()) {
+    return std::unexpected(DriverError::HardwareError);
+  }
+  if (auto admitted = admitAccess(count + 1); !admitted) {
+    return std::unexpected(admitted.error());
+  }
+  if (auto result = comm_.WriteMulti(std::span<const RegisterWrite>(burst.data(), count),
+                                     verify_crc);
+      !result) {
+    return std::unexpected(replyError(result.error()));
+  }
+  noteReplies(count, verify_crc);
+  for (std::size_t i = 0; i < count; ++i) {
+    recordWrite(burst[i].address, burst[i].value);
+    cancelPeakHoldOn(burst[i].address);
+  }
+  if (channels != 0) [[unlikely]] {
+    clearPendingDefaults(std::span<const RegisterWrite>(burst.data(), count));
+  }
   return {};
 }
 
+template <typename CommType>
+DriverResult<void> Driver<CommType>::applyPendingDefaults(uint8_t enable_mask) noexcept {
+  const auto channels = static_cast<uint8_t>(enable_mask & pendingChannels());
+  if (channels == 0) [[likely]] {
+    return {};
+  }
+  // Write index 0 (bits 0-5) is MODE
+  const auto mode_pending = static_cast<uint8_t>(channels & pending_defaults_);
+  if (mode_pending != 0 && mission_mode_) {
+    comm_.Log(LogLevel::Error, "TLE92466ED",
+              "Cannot enable channel mask 0x%02X: MODE of channels 0x%02X was never written "
+              "(lazy channel init) and is only writable in Config Mode. Configure them "
+              "before EnterMissionMode().\n",
+              static_cast<unsigned>(enable_mask), static_cast<unsigned>(mode_pending));
+    return std::unexpected(DriverError::WrongMode);
+  }
+  std::array<RegisterWrite, 6 * CHANNEL_DEFAULT_WRITES> defaults{};
+  const std::size_t count = collectChannelDefaults(channels, {}, defaults);
+  return writeBurst(std::span<const RegisterWrite>(defaults.data(), count), crc_enabled_);
+}
+
 //==========================================================================
 // MODE CONTROL
 //==========================================================================
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::EnterMissionMode() noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -199,12 +368,14 @@ DriverResult<void> Driver<CommType>::EnterMissionMode() noexcept {
   }
 
   mission_mode_ = true;
+  noteActuation();
   comm_.Log(LogLevel::Info, "TLE92466ED", "✅ Mission Mode entered\n");
   return {};
 }
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::EnterConfigMode() noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -219,6 +390,8 @@ DriverResult<void> Driver<CommType>::EnterConfigMode() noexcept {
   }
 
   mission_mode_ = false;
+  peak_hold_.Cancel(CH_CTRL::ALL_CH_MASK); // Outputs are off in Config Mode
+  noteActuation();
   comm_.Log(LogLevel::Info, "TLE92466ED", "✅ Config Mode entered\n");
   return {};
 }
@@ -229,6 +402,7 @@ DriverResult<void> Driver<CommType>::EnterConfigMode() noexcept {
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::ConfigureGlobal(const GlobalConfig& config) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -307,6 +481,7 @@ DriverResult<void> Driver<CommType>::ConfigureGlobal(const GlobalConfig& config)
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::SetCrcEnabled(bool enabled) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -328,6 +503,7 @@ DriverResult<void> Driver<CommType>::SetCrcEnabled(bool enabled) noexcept {
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::SetVbatThresholds(float uv_voltage, float ov_voltage) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -339,7 +515,8 @@ DriverResult<void> Driver<CommType>::SetVbatThresholds(float uv_voltage, float o
 }
 
 template <typename CommType>
-DriverResult<void> Driver<CommType>::setVbatThresholdsInternal(float uv_voltage, float ov_voltage) noexcept {
+DriverResult<void> Driver<CommType>::setVbatThresholdsInternal(float uv_voltage, float ov_voltage,
+                                                                bool clear_latch) noexcept {
   // Validate voltage range
   if (uv_voltage < 0.0F || uv_voltage > 41.4F || ov_voltage < 0.0F || ov_voltage > 41.4F) {
     return std::unexpected(DriverError::InvalidParameter);
@@ -362,6 +539,14 @@ DriverResult<void> Driver<CommType>::setVbatThresholdsInternal(float uv_voltage,
     return result; // Don't verify CRC during init
   }
 
+  if (clear_latch) {
+    clearVbatFaultLatch();
+  }
+  return {};
+}
+
+template <typename CommType>
+void Driver<CommType>::clearVbatFaultLatch() noexcept {
   // Clear VBAT fault flags when thresholds change (old fault state is no longer valid)
   // Write 1 to clear VBAT_UV and VBAT_OV bits in GLOBAL_DIAG0
   if (auto result = WriteRegister(CentralReg::GLOBAL_DIAG0,
@@ -371,13 +556,12 @@ DriverResult<void> Driver<CommType>::setVbatThresholdsInternal(float uv_voltage,
               "Failed to clear VBAT fault flags after threshold change\n");
     // Don't fail the operation, just log warning
   }
-
-  return {};
 }
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::SetVbatThresholdsRaw(uint8_t uv_threshold,
                                                 uint8_t ov_threshold) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -398,6 +582,7 @@ DriverResult<void> Driver<CommType>::SetVbatThresholdsRaw(uint8_t uv_threshold,
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::EnableChannel(Channel channel, bool enabled) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -418,11 +603,17 @@ DriverResult<void> Driver<CommType>::EnableChannel(Channel channel, bool enabled
             ToString(channel), enabled ? "true" : "false");
 
   uint16_t mask = CH_CTRL::ChannelMask(ToIndex(channel));
+  if (enabled) {
+    if (auto result = applyPendingDefaults(static_cast<uint8_t>(mask)); !result) {
+      return result;
+    }
+  }
 
   if (enabled) {
     channel_enable_cache_ |= mask;
   } else {
     channel_enable_cache_ &= ~mask;
+    peak_hold_.Cancel(static_cast<uint8_t>(mask));
   }
 
   // Build full CH_CTRL value: preserve OP_MODE and parallel bits, update channel enable bits
@@ -432,11 +623,16 @@ DriverResult<void> Driver<CommType>::EnableChannel(Channel channel, bool enabled
   // CH_CTRL write verification is disabled because reads return 0x0000 (known device behavior)
   // We track state in ch_ctrl_cache_ and channel_enable_cache_ instead
   ch_ctrl_cache_ = ch_ctrl_value;
-  return WriteRegister(CentralReg::CH_CTRL, ch_ctrl_value, false, false);
+  if (auto result = WriteRegister(CentralReg::CH_CTRL, ch_ctrl_value, false, false); !result) {
+    return result;
+  }
+  noteActuation();
+  return {};
 }
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::EnableChannels(uint8_t channel_mask) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -447,7 +643,11 @@ DriverResult<void> Driver<CommType>::EnableChannels(uint8_t channel_mask) noexce
 
   // Mask to valid channels only (bits 0-5)
   channel_mask &= CH_CTRL::ALL_CH_MASK;
+  if (auto result = applyPendingDefaults(channel_mask); !result) {
+    return result;
+  }
   channel_enable_cache_ = channel_mask;
+  peak_hold_.Cancel(static_cast<uint8_t>(~channel_mask & CH_CTRL::ALL_CH_MASK));
 
   comm_.Log(LogLevel::Info, "TLE92466ED", "Enabling channels: Mask=0x%02X (", channel_mask);
   bool first = true;
@@ -469,23 +669,219 @@ DriverResult<void> Driver<CommType>::EnableChannels(uint8_t channel_mask) noexce
   // CH_CTRL write verification is disabled because reads return 0x0000 (known device behavior)
   // We track state in ch_ctrl_cache_ and channel_enable_cache_ instead
   ch_ctrl_cache_ = ch_ctrl_value;
-  return WriteRegister(CentralReg::CH_CTRL, ch_ctrl_value, false, false);
+  if (auto result = WriteRegister(CentralReg::CH_CTRL, ch_ctrl_value, false, false); !result) {
+    return result;
+  }
+  noteActuation();
+  return {};
 }
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::EnableAllChannels() noexcept {
+  TLE92466ED_API_ENTRY();
   comm_.Log(LogLevel::Info, "TLE92466ED", "Enabling all channels\n");
   return EnableChannels(CH_CTRL::ALL_CH_MASK);
 }
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::DisableAllChannels() noexcept {
+  TLE92466ED_API_ENTRY();
   comm_.Log(LogLevel::Info, "TLE92466ED", "Disabling all channels\n");
   return EnableChannels(0);
 }
 
+template <typename CommType>
+DriverResult<SyncReport>
+Driver<CommType>::ActivateSynchronized(std::span<Driver* const> devices,
+                                       std::span<const SyncActivation> activations,
+                                       SyncRelease release) noexcept {
+  if (devices.empty() || devices.size() != activations.size() ||
+      devices.size() > MAX_SYNC_DEVICES) {
+    return std::unexpected(DriverError::InvalidParameter);
+  }
+  Driver& lead = *devices.front();
+  for (Driver* device : devices) {
+    if (auto result = device->checkInitialized(); !result) {
+      return std::unexpected(result.error());
+    }
+    if (auto result = device->checkMissionMode(); !result) {
+      return std::unexpected(result.error());
+    }
+    // Dropping the shared EN line would switch off every running output on it
+    if (release == SyncRelease::SharedEnable && device->channel_enable_cache_ != 0) {
+      lead.comm_.Log(LogLevel::Error, "TLE92466ED",
+                     "Synchronized activation: channels 0x%02X are on, EN cannot be gated "
+                     "(use SyncRelease::FrameBurst)\n",
+                     static_cast<unsigned>(device->channel_enable_cache_));
+      return std::unexpected(DriverError::Busy);
+    }
+  }
+  for (std::size_t i = 0; i < devices.size(); ++i) {
+    if (auto result = devices[i]->applyPendingDefaults(
+            static_cast<uint8_t>(activations[i].channel_mask & CH_CTRL::ALL_CH_MASK));
+        !result) {
+      return std::unexpected(result.error());
+    }
+  }
+  TLE92466ED_API_ENTRY_OF(lead);
+
+  SyncReport report{};
+  report.release = release;
+  report.devices = static_cast<uint8_t>(devices.size());
+
+  // Outputs stay off until release: either EN is gated or CH_CTRL is not yet written
+  if (release == SyncRelease::SharedEnable) {
+    if (auto result = lead.SetEnable(false); !result) {
+      return std::unexpected(result.error());
+    }
+  }
+
+  // Staging stops at the first failure; with SharedEnable the devices staged
+  // before it still switch when EN is restored
+  std::array<uint16_t, MAX_SYNC_DEVICES> ch_ctrl{};
+  uint8_t staged = 0;
+  DriverError error = DriverError::None;
+  for (std::size_t i = 0; i < devices.size(); ++i) {
+    if (auto result = devices[i]->stageActivation(activations[i], release, ch_ctrl[i]);
+        !result) {
+      error = result.error();
+      break;
+    }
+    staged |= static_cast<uint8_t>(1U << i);
+  }
+  report.staged_us = lead.comm_.NowUs();
+
+  if (release == SyncRelease::SharedEnable) {
+    // EN goes high again on every path
+    report.switched_mask = staged;
+    if (auto result = lead.SetEnable(true); !result && error == DriverError::None) {
+      error = result.error();
+    }
+    report.released_us = lead.comm_.NowUs();
+  } else if (error == DriverError::None) {
+    std::array<uint32_t, MAX_SYNC_DEVICES> frames{};
+    for (std::size_t i = 0; i < devices.size(); ++i) {
+      if (auto admitted = devices[i]->admitAccess(2); !admitted) {
+        return std::unexpected(admitted.error());
+      }
+      SPIFrame frame = SPIFrame::MakeWrite(CentralReg::CH_CTRL, ch_ctrl[i]);
+      frame.tx_fields.crc = CalculateFrameCrc(frame);
+      frames[i] = frame.word;
+    }
+
+    error = releaseFrameBurst(devices, std::span<const uint32_t>(frames.data(), devices.size()),
+                              std::span<const uint16_t>(ch_ctrl.data(), devices.size()), report);
+  }
+
+  for (std::size_t i = 0; i < devices.size(); ++i) {
+    if ((report.switched_mask & (1U << i)) == 0) {
+      continue;
+    }
+    Driver& device = *devices[i];
+    device.ch_ctrl_cache_ = ch_ctrl[i];
+    device.channel_enable_cache_ = ch_ctrl[i] & CH_CTRL::ALL_CH_MASK;
+    device.peak_hold_.Cancel(static_cast<uint8_t>(~ch_ctrl[i] & CH_CTRL::ALL_CH_MASK));
+    device.noteActuation();
+  }
+  report.error = error;
+  lead.reportSyncActivation(report);
+
+  if (error != DriverError::None && report.switched_mask == 0) {
+    return std::unexpected(error);
+  }
+  return report;
+}
+
+template <typename CommType>
+DriverError Driver<CommType>::releaseFrameBurst(std::span<Driver* const> devices,
+                                                std::span<const uint32_t> frames,
+                                                std::span<const uint16_t> ch_ctrl,
+                                                SyncReport& report) noexcept {
+  Driver& lead = *devices.front();
+  DriverError error = DriverError::None;
+
+  // Release loop: one frame per device, nothing else between the frames (time
+  // stamps are taken around it). A failed transfer does not hold back the
+  // remaining devices.
+  std::array<bool, MAX_SYNC_DEVICES> sent{};
+  const uint64_t first_us = lead.comm_.NowUs();
+  for (std::size_t i = 0; i < devices.size(); ++i) {
+    sent[i] = devices[i]->comm_.Transfer32(frames[i]).has_value();
+  }
+  report.released_us = lead.comm_.NowUs();
+  report.skew_us = static_cast<uint32_t>(report.released_us - first_us);
+
+  // A sent frame has switched its device; every pending reply is still collected
+  for (std::size_t i = 0; i < devices.size(); ++i) {
+    Driver& device = *devices[i];
+    if (!sent[i]) {
+      error = error == DriverError::None ? DriverError::HardwareError : error;
+      continue;
+    }
+    report.switched_mask |= static_cast<uint8_t>(1U << i);
+    if (auto result = device.comm_.CompleteWrite(device.crc_enabled_); !result) {
+      const DriverError reply_error = device.replyError(result.error());
+      error = error == DriverError::None ? reply_error : error;
+      continue;
+    }
+    device.noteReplies(1, device.crc_enabled_);
+    device.recordWrite(CentralReg::CH_CTRL, ch_ctrl[i]);
+  }
+  return error;
+}
+
+template <typename CommType>
+void Driver<CommType>::reportSyncActivation(const SyncReport& report) noexcept {
+  if (report.error != DriverError::None) {
+    comm_.Log(LogLevel::Error, "TLE92466ED",
+              "Synchronized activation failed (error %u): devices 0x%02X of %u switched\n",
+              static_cast<unsigned>(report.error), static_cast<unsigned>(report.switched_mask),
+              static_cast<unsigned>(report.devices));
+    return;
+  }
+  comm_.Log(LogLevel::Info, "TLE92466ED",
+            "Synchronized activation: %u devices via %s, skew %u us\n",
+            static_cast<unsigned>(report.devices),
+            report.release == SyncRelease::SharedEnable ? "shared EN" : "frame burst",
+            static_cast<unsigned>(report.skew_us));
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::stageActivation(const SyncActivation& activation,
+                                                     SyncRelease release,
+                                                     uint16_t& ch_ctrl) noexcept {
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((activation.setpoint_mask & (1U << ch)) == 0) {
+      continue;
+    }
+    const auto channel = static_cast<Channel>(ch);
+    if (auto result = SetCurrentSetpoint(channel, activation.current_ma[ch],
+                                         isChannelParallelCached(channel));
+        !result) {
+      return result;
+    }
+  }
+  if (coalesce_setpoints_) {
+    if (auto result = Flush(false); !result) {
+      return result;
+    }
+  }
+
+  ch_ctrl = static_cast<uint16_t>((ch_ctrl_cache_ & ~CH_CTRL::ALL_CH_MASK) |
+                                  (activation.channel_mask & CH_CTRL::ALL_CH_MASK));
+  if (release == SyncRelease::SharedEnable) {
+    // EN is low, so the CH_CTRL write does not switch anything yet
+    return WriteRegister(CentralReg::CH_CTRL, ch_ctrl, false, false);
+  }
+  if (!comm_.IsReady()) {
+    return std::unexpected(DriverError::HardwareError);
+  }
+  return {};
+}
+
 template <typename CommType>
 DriverResult<void> Driver<CommType>::SetChannelMode(Channel channel, ChannelMode mode) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -509,6 +905,7 @@ DriverResult<void> Driver<CommType>::SetChannelMode(Channel channel, ChannelMode
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::SetParallelOperation(ParallelPair pair, bool enabled) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -543,6 +940,20 @@ DriverResult<void> Driver<CommType>::SetParallelOperation(ParallelPair pair, boo
   }
   // If disabled, parallel bit is already cleared
 
+  // Peak-and-hold targets and hold frames carry the setpoint scale of their configuration time
+  const auto changed =
+      static_cast<uint16_t>((ch_ctrl_cache_ ^ ch_ctrl_value) & CH_CTRL::ALL_PAR_MASK);
+  const auto rescaled = static_cast<uint8_t>(
+      ((changed & CH_CTRL::CH_PAR_0_3) != 0 ? 0x09U : 0U) |
+      ((changed & CH_CTRL::CH_PAR_1_2) != 0 ? 0x06U : 0U) |
+      ((changed & CH_CTRL::CH_PAR_4_5) != 0 ? 0x30U : 0U));
+  if ((rescaled & peak_hold_.ConfiguredMask()) != 0) {
+    comm_.Log(LogLevel::Warn, "TLE92466ED",
+              "Parallel change cleared peak-and-hold profiles 0x%02X; configure them again\n",
+              static_cast<unsigned>(rescaled & peak_hold_.ConfiguredMask()));
+    peak_hold_.Clear(rescaled);
+  }
+
   // CH_CTRL write verification is disabled because reads return 0x0000 (known device behavior)
   // We track state in ch_ctrl_cache_ instead
   ch_ctrl_cache_ = ch_ctrl_value;
@@ -556,13 +967,20 @@ DriverResult<void> Driver<CommType>::SetParallelOperation(ParallelPair pair, boo
 template <typename CommType>
 DriverResult<void> Driver<CommType>::SetCurrentSetpoint(Channel channel, uint16_t current_ma,
                                               bool parallel_mode) noexcept {
-
-  if (auto result = checkInitialized(); !result) {
-    return result;
+  auto handle = GetChannelHandle(channel);
+  if (!handle) {
+    return std::unexpected(handle.error());
   }
+  return SetCurrentSetpoint(*handle, current_ma, parallel_mode);
+}
 
-  if (!isValidChannelInternal(channel)) {
-    return std::unexpected(DriverError::InvalidChannel);
+template <typename CommType>
+DriverResult<void> Driver<CommType>::SetCurrentSetpoint(ChannelHandle channel, uint16_t current_ma,
+                                                        bool parallel_mode) noexcept {
+  TLE92466ED_API_ENTRY();
+
+  if (auto result = checkInitialized(); !result) [[unlikely]] {
+    return result;
   }
 
   // Validate current range (using absolute register scale)
@@ -573,35 +991,64 @@ DriverResult<void> Driver<CommType>::SetCurrentSetpoint(Channel channel, uint16_
     return std::unexpected(DriverError::InvalidParameter);
   }
 
+#ifdef TLE92466ED_ENABLE_THERMAL
+  // Pre-emptive thermal derating (predicted rise close to the configured limit)
+  if (thermal_derating_) {
+    const uint16_t allowed_ma = thermal_.CapCurrent(channel.Index(), current_ma);
+    if (allowed_ma < current_ma) [[unlikely]] {
+      reportThermalCap(channel.GetChannel(), current_ma, allowed_ma);
+      current_ma = allowed_ma;
+    }
+  }
+#endif
+
   // Calculate setpoint register value
   uint16_t target = SETPOINT::CalculateTarget(current_ma, parallel_mode);
 
-  // Cache the setpoint
-  channel_setpoints_[ToIndex(channel)] = target;
+  // Cache the setpoint; it supersedes a pending peak-to-hold transition
+  channel_setpoints_[channel.Index()] = target;
+  peak_hold_.Cancel(static_cast<uint8_t>(1U << channel.Index()));
+
+  // Coalescing: stage only, the last value before Flush() wins
+  if (coalesce_setpoints_) {
+    staged_setpoint_mask_ |= static_cast<uint8_t>(1U << channel.Index());
+    return {};
+  }
 
   // Write to SETPOINT register
-  uint16_t ch_addr = GetChannelRegister(channel, ChannelReg::SETPOINT);
+  uint16_t ch_addr = channel.Register(ChannelReg::SETPOINT);
 
   comm_.Log(LogLevel::Info, "TLE92466ED",
             "Setting current setpoint: Channel=%s, Current=%u mA, Target=0x%04X, Parallel=%s\n",
-            ToString(channel), current_ma, target, parallel_mode ? "true" : "false");
+            ToString(channel.GetChannel()), current_ma, target, parallel_mode ? "true" : "false");
 
-  return WriteRegister(ch_addr, target);
+  if (auto result = WriteRegister(ch_addr, target); !result) {
+    return result;
+  }
+  noteSetpoints(static_cast<uint8_t>(1U << channel.Index()));
+  return {};
 }
 
 template <typename CommType>
 DriverResult<uint16_t> Driver<CommType>::GetCurrentSetpoint(Channel channel, bool parallel_mode) noexcept {
-
-  if (auto result = checkInitialized(); !result) {
-    return std::unexpected(result.error());
+  auto handle = GetChannelHandle(channel);
+  if (!handle) {
+    return std::unexpected(handle.error());
   }
+  return GetCurrentSetpoint(*handle, parallel_mode);
+}
 
-  if (!isValidChannelInternal(channel)) {
-    return std::unexpected(DriverError::InvalidChannel);
+template <typename CommType>
+DriverResult<uint16_t> Driver<CommType>::GetCurrentSetpoint(ChannelHandle channel,
+                                                            bool parallel_mode) noexcept {
+  TLE92466ED_API_ENTRY();
+
+  if (auto result = checkInitialized(); !result) [[unlikely]] {
+    return std::unexpected(result.error());
   }
 
   // Read SETPOINT register
-  uint16_t ch_addr = GetChannelRegister(channel, ChannelReg::SETPOINT);
+  uint16_t ch_addr = channel.Register(ChannelReg::SETPOINT);
   auto result = ReadRegister(ch_addr);
   if (!result) {
     return std::unexpected(result.error());
@@ -615,14 +1062,83 @@ DriverResult<uint16_t> Driver<CommType>::GetCurrentSetpoint(Channel channel, boo
 }
 
 template <typename CommType>
-DriverResult<void> Driver<CommType>::ConfigurePwmPeriod(Channel channel, float period_us) noexcept {
+DriverResult<void> Driver<CommType>::SetSetpointCoalescing(bool enabled) noexcept {
+  if (!enabled && coalesce_setpoints_) {
+    if (auto result = Flush(); !result) {
+      return result;
+    }
+  }
+  coalesce_setpoints_ = enabled;
+  return {};
+}
 
+template <typename CommType>
+DriverResult<void> Driver<CommType>::Flush(bool verify) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (staged_setpoint_mask_ == 0) {
+    return {};
+  }
   if (auto result = checkInitialized(); !result) {
     return result;
   }
 
-  if (!isValidChannelInternal(channel)) {
-    return std::unexpected(DriverError::InvalidChannel);
+  std::array<RegisterWrite, 6> writes{};
+  std::array<uint16_t, 6> addresses{};
+  std::size_t count = 0;
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((staged_setpoint_mask_ & (1U << ch)) != 0) {
+      addresses[count] = GetChannelRegister(static_cast<Channel>(ch), ChannelReg::SETPOINT);
+      writes[count] = RegisterWrite{addresses[count], channel_setpoints_[ch]};
+      ++count;
+    }
+  }
+
+  if (auto result = writeBurst(std::span<const RegisterWrite>(writes.data(), count),
+                              crc_enabled_);
+      !result) {
+    return result; // Staged values are kept for a retry
+  }
+
+  const uint8_t flushed = staged_setpoint_mask_;
+  staged_setpoint_mask_ = 0;
+  noteSetpoints(flushed);
+
+  if (verify) {
+    std::array<uint32_t, 6> readback{};
+    if (auto result = ReadRegisters(std::span<const uint16_t>(addresses.data(), count),
+                                    std::span<uint32_t>(readback.data(), count));
+        !result) {
+      return result;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      if (static_cast<uint16_t>(readback[i]) != writes[i].value) {
+        comm_.Log(LogLevel::Warn, "TLE92466ED",
+                  "Setpoint flush verification failed: Address=0x%04X, Written=0x%04X, "
+                  "Read=0x%04X\n",
+                  writes[i].address, writes[i].value, static_cast<uint16_t>(readback[i]));
+        return std::unexpected(DriverError::RegisterError);
+      }
+    }
+  }
+  return {};
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::ConfigurePwmPeriod(Channel channel, float period_us) noexcept {
+  auto handle = GetChannelHandle(channel);
+  if (!handle) {
+    return std::unexpected(handle.error());
+  }
+  return ConfigurePwmPeriod(*handle, period_us);
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::ConfigurePwmPeriod(ChannelHandle channel,
+                                                        float period_us) noexcept {
+  TLE92466ED_API_ENTRY();
+
+  if (auto result = checkInitialized(); !result) [[unlikely]] {
+    return result;
   }
 
   // Validate period range
@@ -644,9 +1160,9 @@ DriverResult<void> Driver<CommType>::ConfigurePwmPeriod(Channel channel, float p
   comm_.Log(LogLevel::Info, "TLE92466ED",
             "Configuring PWM period: Channel=%s, Period=%.3f us, Mantissa=%u, Exponent=%u, "
             "Register=0x%04X\n",
-            ToString(channel), period_us, config.mantissa, config.exponent, value);
+            ToString(channel.GetChannel()), period_us, config.mantissa, config.exponent, value);
 
-  uint16_t ch_addr = GetChannelRegister(channel, ChannelReg::PERIOD);
+  uint16_t ch_addr = channel.Register(ChannelReg::PERIOD);
   return WriteRegister(ch_addr, value);
 }
 
@@ -654,6 +1170,7 @@ template <typename CommType>
 DriverResult<void> Driver<CommType>::ConfigurePwmPeriodRaw(Channel channel, uint8_t period_mantissa,
                                                  uint8_t period_exponent,
                                                  bool low_freq_range) noexcept {
+  TLE92466ED_API_ENTRY();
 
   if (auto result = checkInitialized(); !result) {
     return result;
@@ -681,6 +1198,7 @@ DriverResult<void> Driver<CommType>::ConfigurePwmPeriodRaw(Channel channel, uint
 template <typename CommType>
 DriverResult<void> Driver<CommType>::ConfigureDither(Channel channel, float amplitude_ma, float frequency_hz,
                                            bool parallel_mode) noexcept {
+  TLE92466ED_API_ENTRY();
 
   if (auto result = checkInitialized(); !result) {
     return result;
@@ -703,14 +1221,25 @@ DriverResult<void> Driver<CommType>::ConfigureDither(Channel channel, float ampl
     }
   }
 
-  // Calculate dither configuration from amplitude and frequency
-  auto config = DITHER::CalculateFromAmplitudeFrequency(amplitude_ma, frequency_hz, parallel_mode);
+  // Solve dither configuration jointly from amplitude and frequency
+  const auto solution =
+      DITHER::SolveFromAmplitudeFrequency(amplitude_ma, frequency_hz, parallel_mode);
+  const auto& config = solution.config;
 
   comm_.Log(LogLevel::Info, "TLE92466ED",
-            "Configuring dither: Channel=%s, Amplitude=%.2f mA, Frequency=%.2f Hz, "
-            "StepSize=%u, NumSteps=%u, FlatSteps=%u, Parallel=%s\n",
-            ToString(channel), amplitude_ma, frequency_hz, config.step_size, config.num_steps,
+            "Configuring dither: Channel=%s, Amplitude=%.2f mA (achieved %.2f mA), "
+            "Frequency=%.2f Hz (achieved %.2f Hz), StepSize=%u, NumSteps=%u, FlatSteps=%u, "
+            "Parallel=%s\n",
+            ToString(channel), amplitude_ma, solution.AchievedAmplitudeMa(parallel_mode),
+            frequency_hz, solution.AchievedFrequencyHz(), config.step_size, config.num_steps,
             config.flat_steps, parallel_mode ? "true" : "false");
+  if (solution.ErrorPpm() > DITHER_WARN_ERROR_PPM) {
+    comm_.Log(LogLevel::Warn, "TLE92466ED",
+              "Dither request outside representable range: amplitude error %.1f %%, "
+              "period error %.1f %%\n",
+              static_cast<float>(solution.amplitude_error_ppm) / 10'000.0F,
+              static_cast<float>(solution.period_error_ppm) / 10'000.0F);
+  }
 
   // Configure dither registers
   return ConfigureDitherRaw(channel, config.step_size, config.num_steps, config.flat_steps);
@@ -719,6 +1248,7 @@ DriverResult<void> Driver<CommType>::ConfigureDither(Channel channel, float ampl
 template <typename CommType>
 DriverResult<void> Driver<CommType>::ConfigureDitherRaw(Channel channel, uint16_t step_size,
                                               uint8_t num_steps, uint8_t flat_steps) noexcept {
+  TLE92466ED_API_ENTRY();
 
   if (auto result = checkInitialized(); !result) {
     return result;
@@ -751,104 +1281,550 @@ DriverResult<void> Driver<CommType>::ConfigureDitherRaw(Channel channel, uint16_
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::ConfigureChannel(Channel channel, const ChannelConfig& config) noexcept {
+  TLE92466ED_API_ENTRY();
+  // Same state machine as BeginConfigureChannel()/Step(), run to completion
+  OperationState op{};
+  if (auto result = beginOperation(op, Operation::ConfigureChannel, channel, config); !result) {
+    return result;
+  }
+  return runOperation(op);
+}
 
+template <typename CommType>
+DriverResult<void> Driver<CommType>::ApplyConfigBundle(const ConfigBundleView& bundle,
+                                                       uint32_t variant_id) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
-
-  // Most configuration requires Config Mode
   if (auto result = checkConfigMode(); !result) {
     return result;
   }
 
-  if (!isValidChannelInternal(channel)) {
-    return std::unexpected(DriverError::InvalidChannel);
+  const ConfigBundleVariant* variant = bundle.FindVariant(variant_id);
+  if (variant == nullptr) {
+    comm_.Log(LogLevel::Error, "TLE92466ED", "Config bundle: variant 0x%08X not found\n",
+              static_cast<unsigned>(variant_id));
+    return std::unexpected(DriverError::InvalidParameter);
   }
+  const std::span<const uint32_t> frames = bundle.Frames(*variant);
 
-  comm_.Log(LogLevel::Info, "TLE92466ED",
-            "Configuring channel: %s, Mode=%s, Current=%u mA, "
-            "SlewRate=%s, DiagCurrent=%s, OL_Threshold=%u\n",
-            ToString(channel), ToString(config.mode), config.current_setpoint_ma,
-            ToString(config.slew_rate), ToString(config.diag_current), config.open_load_threshold);
+  // Reply CRCs can only be checked if the burst leaves CRC_EN as it is
+  bool verify_crc = crc_enabled_;
+  for (std::size_t i = 0; i + 1 < frames.size(); ++i) {
+    SPIFrame frame{};
+    frame.word = frames[i];
+    if (frame.tx_fields.address == CentralReg::GLOBAL_CONFIG &&
+        ((frame.tx_fields.data & GLOBAL_CONFIG::CRC_EN) != 0) != crc_enabled_) {
+      verify_crc = false;
+    }
+  }
 
-  uint16_t ch_base = GetChannelBase(channel);
+  if (!comm_.IsReady()) {
+    return std::unexpected(DriverError::HardwareError);
+  }
 
-  // 1. Set channel mode
-  if (auto result = WriteRegister(ch_base + ChannelReg::MODE, static_cast<uint16_t>(config.mode));
-      !result) {
-    return std::unexpected(result.error());
+  // Lazy defaults of the channels the bundle touches go first, in their own
+  // burst, so the bundle's own writes override them
+  uint8_t channels = 0;
+  for (std::size_t i = 0; pending_defaults_ != 0 && i + 1 < frames.size(); ++i) {
+    SPIFrame frame{};
+    frame.word = frames[i];
+    channels |= pendingDefaultsOf(static_cast<uint16_t>(frame.tx_fields.address));
   }
+  std::array<RegisterWrite, 6 * CHANNEL_DEFAULT_WRITES> defaults{};
+  const std::size_t default_count = collectChannelDefaults(channels, {}, defaults);
+  const std::size_t default_frames = default_count == 0 ? 0 : default_count + 1;
 
-  // 2. Set current setpoint with parallel mode detection
-  auto parallel_result = isChannelParallel(channel);
-  bool is_parallel = parallel_result.value_or(false); // Default to false if can't determine
-  uint16_t target = SETPOINT::CalculateTarget(config.current_setpoint_ma, is_parallel);
-  if (config.auto_limit_disabled) {
-    target |= SETPOINT::AUTO_LIMIT_DIS;
+  if (auto admitted = admitAccess(default_frames + frames.size()); !admitted) {
+    return std::unexpected(admitted.error());
   }
-  if (auto result = WriteRegister(ch_base + ChannelReg::SETPOINT, target); !result) {
-    return std::unexpected(result.error());
+  if (default_count != 0) [[unlikely]] {
+    const std::span<const RegisterWrite> default_writes(defaults.data(), default_count);
+    if (auto result = comm_.WriteMulti(default_writes, crc_enabled_); !result) {
+      return std::unexpected(replyError(result.error()));
+    }
+    noteReplies(default_count, crc_enabled_);
+    for (const auto& write : default_writes) {
+      recordWrite(write.address, write.value);
+    }
+    clearPendingDefaults(default_writes);
   }
 
-  // 3. Configure CH_CONFIG register
-  uint16_t ch_cfg = static_cast<uint16_t>(config.slew_rate) |
-                    (static_cast<uint16_t>(config.diag_current) << 2) |
-                    (static_cast<uint16_t>(config.open_load_threshold & CH_CONFIG::OL_TH_VALUE_MASK)
-                     << CH_CONFIG::OL_TH_SHIFT);
+  // The variant's frames are clocked out of the bundle memory as they are
+  std::array<uint32_t, ConfigBundleView::MAX_FRAMES> rx{};
+  if (auto result = comm_.WriteFrames(frames, rx, verify_crc); !result) {
+    return std::unexpected(replyError(result.error()));
+  }
+  noteReplies(frames.size() - 1, verify_crc);
 
-  if (auto result = WriteRegister(ch_base + ChannelReg::CH_CONFIG, ch_cfg); !result) {
-    return std::unexpected(result.error());
+  // Writable registers are below 0x80, so the 7-bit frame address is the full address
+  for (std::size_t i = 0; i + 1 < frames.size(); ++i) {
+    SPIFrame frame{};
+    frame.word = frames[i];
+    const auto address = static_cast<uint16_t>(frame.tx_fields.address);
+    const auto value = static_cast<uint16_t>(frame.tx_fields.data);
+    noteRegisterWritten(address, value);
+    recordWrite(address, value);
   }
 
-  // 3a. Configure OLSG warning enable if requested (bit 14 of CTRL register)
-  if (config.olsg_warning_enabled) {
-    if (auto result = ModifyRegister(ch_base + ChannelReg::CTRL, CH_CTRL_REG::OLSG_WARN_EN,
-                                     CH_CTRL_REG::OLSG_WARN_EN);
-        !result) {
-      return std::unexpected(result.error());
-    }
+  comm_.Log(LogLevel::Info, "TLE92466ED",
+            "Config bundle applied: variant 0x%08X (%.16s), revision %u, %u writes\n",
+            static_cast<unsigned>(variant_id), variant->name,
+            static_cast<unsigned>(bundle.Revision()), static_cast<unsigned>(frames.size() - 1));
+  return {};
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::ReconfigureChannel(Channel channel,
+                                                        const ChannelConfig& config,
+                                                        bool verify) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (auto result = checkInitialized(); !result) {
+    return result;
+  }
+  if (!isValidChannelInternal(channel)) {
+    return std::unexpected(DriverError::InvalidChannel);
+  }
+  const bool parallel = isChannelParallelCached(channel);
+  if (config.current_setpoint_ma > (parallel ? 4000 : 2000)) {
+    return std::unexpected(DriverError::InvalidParameter);
   }
 
-  // 4. Configure PWM if specified
-  // Note: ChannelConfig still uses low-level parameters for backward compatibility
-  // New code should use ConfigurePwmPeriod(period_us) directly
+  // Current register set, in one burst
+  enum : uint8_t {
+    MODE,
+    SETPOINT_REG,
+    CTRL,
+    PERIOD_REG,
+    DITHER_CTRL_REG,
+    DITHER_STEP_REG,
+    CH_CONFIG_REG,
+    REG_COUNT
+  };
+  const uint16_t ch_base = GetChannelBase(channel);
+  const std::array<uint16_t, REG_COUNT> addresses{
+      static_cast<uint16_t>(ch_base + ChannelReg::MODE),
+      static_cast<uint16_t>(ch_base + ChannelReg::SETPOINT),
+      static_cast<uint16_t>(ch_base + ChannelReg::CTRL),
+      static_cast<uint16_t>(ch_base + ChannelReg::PERIOD),
+      static_cast<uint16_t>(ch_base + ChannelReg::DITHER_CTRL),
+      static_cast<uint16_t>(ch_base + ChannelReg::DITHER_STEP),
+      static_cast<uint16_t>(ch_base + ChannelReg::CH_CONFIG)};
+  std::array<uint32_t, REG_COUNT> current{};
+  if (auto result = ReadRegisters(addresses, current); !result) {
+    return result;
+  }
+  if (static_cast<uint16_t>(current[MODE]) != static_cast<uint16_t>(config.mode)) {
+    comm_.Log(LogLevel::Error, "TLE92466ED",
+              "Reconfigure %s: mode change needs Config Mode and ConfigureChannel()\n",
+              ToString(channel));
+    return std::unexpected(DriverError::WrongMode);
+  }
+
+  // New register set (same encoding as ConfigureChannel())
+  std::array<uint16_t, REG_COUNT> target{};
+  for (std::size_t i = 0; i < REG_COUNT; ++i) {
+    target[i] = static_cast<uint16_t>(current[i]);
+  }
+  target[SETPOINT_REG] = SETPOINT::CalculateTarget(config.current_setpoint_ma, parallel) |
+                         (config.auto_limit_disabled ? SETPOINT::AUTO_LIMIT_DIS : 0U);
+  target[CTRL] = static_cast<uint16_t>(
+      (target[CTRL] & ~CH_CTRL_REG::OLSG_WARN_EN) |
+      (config.olsg_warning_enabled ? CH_CTRL_REG::OLSG_WARN_EN : 0U));
+  target[CH_CONFIG_REG] = static_cast<uint16_t>(
+      static_cast<uint16_t>(config.slew_rate) |
+      (static_cast<uint16_t>(config.diag_current) << 2) |
+      (static_cast<uint16_t>(config.open_load_threshold & CH_CONFIG::OL_TH_VALUE_MASK)
+       << CH_CONFIG::OL_TH_SHIFT));
   if (config.pwm_period_mantissa > 0) {
-    if (auto result = ConfigurePwmPeriodRaw(channel, config.pwm_period_mantissa,
-                                            config.pwm_period_exponent, false);
+    target[PERIOD_REG] = static_cast<uint16_t>(
+        config.pwm_period_mantissa |
+        ((config.pwm_period_exponent & PERIOD::EXP_VALUE_MASK) << PERIOD::EXP_SHIFT));
+  }
+  if (config.dither_step_size > 0) {
+    target[DITHER_CTRL_REG] = static_cast<uint16_t>(
+        (target[DITHER_CTRL_REG] & DITHER_CTRL::FAST_MEAS_MASK) |
+        (config.dither_step_size & DITHER_CTRL::STEP_SIZE_MASK) |
+        (config.deep_dither_enabled ? DITHER_CTRL::DEEP_DITHER : 0U));
+    target[DITHER_STEP_REG] = static_cast<uint16_t>(
+        config.dither_flat |
+        (static_cast<uint16_t>(config.dither_steps) << DITHER_STEP::STEPS_SHIFT));
+  }
+
+  // Write order: benign registers, shrinking dither, setpoint, growing dither
+  const auto step_size = [](uint32_t value) { return value & DITHER_CTRL::STEP_SIZE_MASK; };
+  const auto steps = [](uint32_t value) {
+    return (value & DITHER_STEP::STEPS_MASK) >> DITHER_STEP::STEPS_SHIFT;
+  };
+  const uint32_t old_step_size = step_size(current[DITHER_CTRL_REG]);
+  const uint32_t new_step_size = step_size(target[DITHER_CTRL_REG]);
+  const bool step_size_first = new_step_size < old_step_size;
+  const bool dither_first = new_step_size * steps(target[DITHER_STEP_REG]) <
+                            old_step_size * steps(current[DITHER_STEP_REG]);
+
+  std::array<uint8_t, REG_COUNT> order{};
+  std::size_t order_count = 0;
+  const auto addDither = [&] {
+    order[order_count++] = step_size_first ? DITHER_CTRL_REG : DITHER_STEP_REG;
+    order[order_count++] = step_size_first ? DITHER_STEP_REG : DITHER_CTRL_REG;
+  };
+  order[order_count++] = PERIOD_REG;
+  order[order_count++] = CH_CONFIG_REG;
+  order[order_count++] = CTRL;
+  if (dither_first) {
+    addDither();
+  }
+  order[order_count++] = SETPOINT_REG;
+  if (!dither_first) {
+    addDither();
+  }
+
+  std::array<RegisterWrite, REG_COUNT> writes{};
+  std::array<uint16_t, REG_COUNT> written{};
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < order_count; ++i) {
+    const uint8_t reg = order[i];
+    if (target[reg] != static_cast<uint16_t>(current[reg])) {
+      writes[count] = RegisterWrite{addresses[reg], target[reg]};
+      written[count] = addresses[reg];
+      ++count;
+    }
+  }
+
+  if (count > 0) {
+    if (auto result = writeBurst(std::span<const RegisterWrite>(writes.data(), count),
+                                 crc_enabled_);
         !result) {
-      return std::unexpected(result.error());
+      return result;
     }
   }
 
-  // 5. Configure dither if specified
-  // Note: ChannelConfig still uses low-level parameters for backward compatibility
-  // New code should use ConfigureDither(amplitude_ma, frequency_hz) directly
-  if (config.dither_step_size > 0) {
-    if (auto result = ConfigureDitherRaw(channel, config.dither_step_size, config.dither_steps,
-                                         config.dither_flat);
+  const auto index = ToIndex(channel);
+  channel_setpoints_[index] = target[SETPOINT_REG] & SETPOINT::TARGET_MASK;
+  staged_setpoint_mask_ &= static_cast<uint8_t>(~(1U << index)); // Written directly
+  noteSetpoints(static_cast<uint8_t>(1U << index));
+
+  comm_.Log(LogLevel::Info, "TLE92466ED", "Reconfigured %s: %u of %u registers written\n",
+            ToString(channel), static_cast<unsigned>(count), 6U);
+
+  if (verify && count > 0) {
+    std::array<uint32_t, REG_COUNT> readback{};
+    if (auto result = ReadRegisters(std::span<const uint16_t>(written.data(), count),
+                                    std::span<uint32_t>(readback.data(), count));
         !result) {
+      return result;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      if (static_cast<uint16_t>(readback[i]) != writes[i].value) {
+        reportWriteMismatch(writes[i].address, writes[i].value,
+                            static_cast<uint16_t>(readback[i]));
+        return std::unexpected(DriverError::RegisterError);
+      }
+    }
+  }
+  return {};
+}
+
+template <typename CommType>
+void Driver<CommType>::noteRegisterWritten(uint16_t address, uint16_t value) noexcept {
+  if (address == CentralReg::GLOBAL_CONFIG) {
+    crc_enabled_ = (value & GLOBAL_CONFIG::CRC_EN) != 0;
+    vio_5v_mode_ = (value & GLOBAL_CONFIG::VIO_SEL) != 0;
+    return;
+  }
+  if (address == CentralReg::CH_CTRL) {
+    ch_ctrl_cache_ = value;
+    channel_enable_cache_ = value & CH_CTRL::ALL_CH_MASK;
+    return;
+  }
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if (address == GetChannelRegister(static_cast<Channel>(ch), ChannelReg::SETPOINT)) {
+      channel_setpoints_[ch] = value & SETPOINT::TARGET_MASK;
+      peak_hold_.Cancel(static_cast<uint8_t>(1U << ch));
+      return;
+    }
+  }
+}
+
+template <typename CommType>
+DriverResult<bool> Driver<CommType>::runChannelPhase(OperationState& op) noexcept {
+  // Most configuration requires Config Mode (re-checked as other calls may run between steps)
+  if (auto result = checkConfigMode(); !result) {
+    return std::unexpected(result.error());
+  }
+
+  const Channel channel = op.channel;
+  const ChannelConfig& config = op.config;
+  uint16_t ch_base = GetChannelBase(channel);
+
+  switch (op.phase) {
+  case OpPhase::ConfigParallel:
+    // 1. Parallel mode detection (scales the setpoint)
+    op.parallel = isChannelParallel(channel).value_or(false); // Default to false if can't determine
+    op.phase = OpPhase::ConfigMode;
+    return true;
+
+  case OpPhase::ConfigMode: {
+    // 2. MODE, SETPOINT and CH_CONFIG in one burst; they also cover every lazy channel
+    //    default, so none of those is sent only to be overwritten
+    uint16_t target = SETPOINT::CalculateTarget(config.current_setpoint_ma, op.parallel);
+    if (config.auto_limit_disabled) {
+      target |= SETPOINT::AUTO_LIMIT_DIS;
+    }
+    const auto ch_cfg = static_cast<uint16_t>(
+        static_cast<uint16_t>(config.slew_rate) |
+        (static_cast<uint16_t>(config.diag_current) << 2) |
+        (static_cast<uint16_t>(config.open_load_threshold & CH_CONFIG::OL_TH_VALUE_MASK)
+         << CH_CONFIG::OL_TH_SHIFT));
+    const std::array<RegisterWrite, 3> writes{
+        RegisterWrite{static_cast<uint16_t>(ch_base + ChannelReg::MODE),
+                      static_cast<uint16_t>(config.mode)},
+        RegisterWrite{static_cast<uint16_t>(ch_base + ChannelReg::SETPOINT), target},
+        RegisterWrite{static_cast<uint16_t>(ch_base + ChannelReg::CH_CONFIG), ch_cfg}};
+    if (auto result = writeBurst(writes, crc_enabled_); !result) {
       return std::unexpected(result.error());
     }
+    channel_setpoints_[ToIndex(channel)] = target & SETPOINT::TARGET_MASK;
+    staged_setpoint_mask_ &= static_cast<uint8_t>(~(1U << ToIndex(channel))); // Written directly
+    noteSetpoints(static_cast<uint8_t>(1U << ToIndex(channel)));
+
+    // Read back all three in one burst (mismatches are logged, as by WriteRegister())
+    (void)awaitDeadline(
+        comm_.ArmDeadline(TimingRequirement::WriteReadback, Timing::WRITE_READBACK_US));
+    const std::array<uint16_t, 3> addresses{writes[0].address, writes[1].address,
+                                            writes[2].address};
+    std::array<uint32_t, 3> readback{};
+    if (ReadRegisters(addresses, readback)) {
+      for (std::size_t i = 0; i < writes.size(); ++i) {
+        if (static_cast<uint16_t>(readback[i]) != writes[i].value) {
+          reportWriteMismatch(writes[i].address, writes[i].value,
+                              static_cast<uint16_t>(readback[i]));
+        }
+      }
+    }
+    op.phase = OpPhase::ConfigOlsgWarning;
+    return true;
+  }
+
+  case OpPhase::ConfigOlsgWarning:
+    // 3a. Configure OLSG warning enable if requested (bit 14 of CTRL register)
+    if (config.olsg_warning_enabled) {
+      if (auto result = ModifyRegister(ch_base + ChannelReg::CTRL, CH_CTRL_REG::OLSG_WARN_EN,
+                                       CH_CTRL_REG::OLSG_WARN_EN);
+          !result) {
+        return std::unexpected(result.error());
+      }
+    }
+    op.phase = OpPhase::ConfigPwm;
+    return true;
+
+  case OpPhase::ConfigPwm:
+    // 4. Configure PWM if specified
+    // Note: ChannelConfig still uses low-level parameters for backward compatibility
+    // New code should use ConfigurePwmPeriod(period_us) directly
+    if (config.pwm_period_mantissa > 0) {
+      if (auto result = ConfigurePwmPeriodRaw(channel, config.pwm_period_mantissa,
+                                              config.pwm_period_exponent, false);
+          !result) {
+        return std::unexpected(result.error());
+      }
+    }
+    op.phase = OpPhase::ConfigDither;
+    return true;
+
+  case OpPhase::ConfigDither:
+    // 5. Configure dither if specified
+    // Note: ChannelConfig still uses low-level parameters for backward compatibility
+    // New code should use ConfigureDither(amplitude_ma, frequency_hz) directly
+    if (config.dither_step_size > 0) {
+      if (auto result = ConfigureDitherRaw(channel, config.dither_step_size, config.dither_steps,
+                                           config.dither_flat);
+          !result) {
+        return std::unexpected(result.error());
+      }
+    }
+    op.phase = OpPhase::ConfigDeepDither;
+    return true;
 
+  case OpPhase::ConfigDeepDither:
     // 5a. Enable deep dither if requested (bit 13 of DITHER_CTRL)
-    if (config.deep_dither_enabled) {
+    if (config.dither_step_size > 0 && config.deep_dither_enabled) {
       if (auto result = ModifyRegister(ch_base + ChannelReg::DITHER_CTRL, DITHER_CTRL::DEEP_DITHER,
                                        DITHER_CTRL::DEEP_DITHER);
           !result) {
         return std::unexpected(result.error());
       }
     }
+    op.phase = OpPhase::Done;
+    return true;
+
+  default:
+    return std::unexpected(DriverError::ConfigurationError);
+  }
+}
+
+//==========================================================================
+// PEAK AND HOLD
+//==========================================================================
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::ConfigurePeakHold(Channel channel,
+                                                       const PeakHoldProfile& profile) noexcept {
+  if (!isValidChannelInternal(channel)) {
+    return std::unexpected(DriverError::InvalidChannel);
+  }
+  const bool parallel = isChannelParallelCached(channel);
+  if (profile.peak_us == 0 || profile.hold_ma > profile.peak_ma ||
+      profile.peak_ma > (parallel ? 4000 : 2000)) {
+    return std::unexpected(DriverError::InvalidParameter);
+  }
+
+  const uint16_t peak_target = SETPOINT::CalculateTarget(profile.peak_ma, parallel);
+  const uint16_t hold_target = SETPOINT::CalculateTarget(profile.hold_ma, parallel);
+  SPIFrame frame =
+      SPIFrame::MakeWrite(GetChannelRegister(channel, ChannelReg::SETPOINT), hold_target);
+  frame.tx_fields.crc = CalculateFrameCrc(frame);
+  peak_hold_.Configure(ToIndex(channel), peak_target, hold_target, profile.peak_us, frame.word);
+
+  comm_.Log(LogLevel::Info, "TLE92466ED",
+            "Peak-and-hold: Channel=%s, Peak=%u mA for %u us, Hold=%u mA\n", ToString(channel),
+            profile.peak_ma, static_cast<unsigned>(profile.peak_us), profile.hold_ma);
+  return {};
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::StartPeakHold(uint8_t channel_mask, bool enable) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (auto result = checkInitialized(); !result) {
+    return result;
+  }
+  channel_mask &= CH_CTRL::ALL_CH_MASK;
+  if (channel_mask == 0 || (channel_mask & ~peak_hold_.ConfiguredMask()) != 0) {
+    return std::unexpected(DriverError::InvalidParameter);
+  }
+  if (enable) {
+    if (auto result = checkMissionMode(); !result) {
+      return result;
+    }
+    if (auto result = applyPendingDefaults(channel_mask); !result) {
+      return result;
+    }
+  }
+  if (comm_.NowUs() == 0) {
+    comm_.Log(LogLevel::Error, "TLE92466ED",
+              "Peak-and-hold needs the GetTimeUs() hook of the CommInterface\n");
+    return std::unexpected(DriverError::ConfigurationError);
+  }
+
+  // Peak setpoints first, so enabled channels start at peak current
+  std::array<RegisterWrite, 7> writes{};
+  std::size_t count = 0;
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((channel_mask & (1U << ch)) != 0) {
+      writes[count++] = RegisterWrite{
+          GetChannelRegister(static_cast<Channel>(ch), ChannelReg::SETPOINT),
+          peak_hold_.PeakTarget(ch)};
+    }
+  }
+  const auto ch_ctrl_value = static_cast<uint16_t>(ch_ctrl_cache_ | channel_mask);
+  if (enable) {
+    writes[count++] = RegisterWrite{CentralReg::CH_CTRL, ch_ctrl_value};
+  }
+  if (auto result = writeBurst(std::span<const RegisterWrite>(writes.data(), count),
+                               crc_enabled_);
+      !result) {
+    return result;
   }
 
+  const uint64_t now = comm_.NowUs();
+  staged_setpoint_mask_ &= static_cast<uint8_t>(~channel_mask);
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((channel_mask & (1U << ch)) != 0) {
+      channel_setpoints_[ch] = peak_hold_.PeakTarget(ch);
+    }
+  }
+  noteSetpoints(channel_mask);
+  if (enable) {
+    ch_ctrl_cache_ = ch_ctrl_value;
+    channel_enable_cache_ = ch_ctrl_value & CH_CTRL::ALL_CH_MASK;
+    noteActuation();
+  }
+  peak_hold_.Start(channel_mask, now);
   return {};
 }
 
+template <typename CommType>
+DriverResult<uint8_t> Driver<CommType>::ServicePeakHold(uint32_t lead_us) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (auto result = checkInitialized(); !result) {
+    return std::unexpected(result.error());
+  }
+
+  uint64_t due_us = 0;
+  if (!peak_hold_.NextDue(due_us)) {
+    return 0;
+  }
+  const uint64_t now = comm_.NowUs();
+  if (due_us > now + lead_us) {
+    return 0;
+  }
+
+  // Wait for the earliest transition, then send its frame and every frame due
+  // within the merge window back to back
+  if (due_us > now) {
+    const TimingDeadline deadline{TimingRequirement::Transition, now,
+                                  static_cast<uint32_t>(due_us - now)};
+    if (auto result = awaitDeadline(deadline); !result) {
+      return std::unexpected(DriverError::HardwareError);
+    }
+  }
+
+  const uint64_t release_us = std::max(comm_.NowUs(), due_us);
+  std::array<uint32_t, 6> hold_frames{};
+  std::size_t count = 0;
+  const uint8_t mask = peak_hold_.Collect(release_us, hold_frames, count);
+
+  std::array<uint32_t, 7> burst{};
+  std::copy_n(hold_frames.begin(), count, burst.begin());
+  SPIFrame dummy_frame = SPIFrame::MakeRead(0);
+  dummy_frame.tx_fields.crc = CalculateFrameCrc(dummy_frame);
+  burst[count] = dummy_frame.word;
+
+  if (!comm_.IsReady()) {
+    return std::unexpected(DriverError::HardwareError);
+  }
+  if (auto admitted = admitAccess(count + 1); !admitted) {
+    return std::unexpected(admitted.error());
+  }
+  const uint64_t sent_us = comm_.NowUs();
+  std::array<uint32_t, 7> rx{};
+  if (auto result = comm_.WriteFrames(std::span<const uint32_t>(burst.data(), count + 1), rx,
+                                      crc_enabled_);
+      !result) {
+    return std::unexpected(replyError(result.error())); // Transitions stay pending
+  }
+  noteReplies(count, crc_enabled_);
+  peak_hold_.Complete(mask, sent_us);
+
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((mask & (1U << ch)) != 0) {
+      channel_setpoints_[ch] = peak_hold_.HoldTarget(ch);
+      recordWrite(GetChannelRegister(static_cast<Channel>(ch), ChannelReg::SETPOINT),
+                  channel_setpoints_[ch]);
+    }
+  }
+  noteSetpoints(mask);
+  return mask;
+}
+
 //==========================================================================
 // STATUS AND DIAGNOSTICS
 //==========================================================================
 
 template <typename CommType>
 DriverResult<DeviceStatus> Driver<CommType>::GetDeviceStatus() noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return std::unexpected(result.error());
   }
@@ -911,6 +1887,7 @@ DriverResult<DeviceStatus> Driver<CommType>::GetDeviceStatus() noexcept {
 
 template <typename CommType>
 DriverResult<ChannelDiagnostics> Driver<CommType>::GetChannelDiagnostics(Channel channel) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return std::unexpected(result.error());
   }
@@ -923,6 +1900,9 @@ DriverResult<ChannelDiagnostics> Driver<CommType>::GetChannelDiagnostics(Channel
 
   // Read DIAG_ERR register for this channel group
   auto diag_err_result = ReadRegister(CentralReg::DIAG_ERR_CHGR0 + ToIndex(channel));
+  if (!diag_err_result && diag_err_result.error() == DriverError::Deferred) {
+    return std::unexpected(DriverError::Deferred); // Bus QoS: nothing was read
+  }
   if (diag_err_result) {
     uint16_t diag_err = *diag_err_result;
     // Parse error flags (bit positions from datasheet Table in page 67)
@@ -975,20 +1955,29 @@ DriverResult<ChannelDiagnostics> Driver<CommType>::GetChannelDiagnostics(Channel
 
 template <typename CommType>
 DriverResult<uint16_t> Driver<CommType>::GetAverageCurrent(Channel channel, bool parallel_mode) noexcept {
-  if (auto result = checkInitialized(); !result) {
-    return std::unexpected(result.error());
+  auto handle = GetChannelHandle(channel);
+  if (!handle) {
+    return std::unexpected(handle.error());
   }
+  return GetAverageCurrent(*handle, parallel_mode);
+}
 
-  if (!isValidChannelInternal(channel)) {
-    return std::unexpected(DriverError::InvalidChannel);
+template <typename CommType>
+DriverResult<uint16_t> Driver<CommType>::GetAverageCurrent(ChannelHandle channel,
+                                                           bool parallel_mode) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (auto result = checkInitialized(); !result) [[unlikely]] {
+    return std::unexpected(result.error());
   }
 
-  uint16_t ch_addr = GetChannelRegister(channel, ChannelReg::FB_I_AVG);
+  uint16_t ch_addr = channel.Register(ChannelReg::FB_I_AVG);
   auto result = ReadRegister(ch_addr);
   if (!result) {
     return std::unexpected(result.error());
   }
 
+  noteFeedbackSample(channel.Index(), static_cast<uint16_t>(*result));
+
   // Convert raw value to mA
   // Based on datasheet: similar calculation to setpoint
   uint16_t current_ma = SETPOINT::CalculateCurrent(*result, parallel_mode);
@@ -997,20 +1986,27 @@ DriverResult<uint16_t> Driver<CommType>::GetAverageCurrent(Channel channel, bool
 
 template <typename CommType>
 DriverResult<uint16_t> Driver<CommType>::GetDutyCycle(Channel channel) noexcept {
-  if (auto result = checkInitialized(); !result) {
-    return std::unexpected(result.error());
+  auto handle = GetChannelHandle(channel);
+  if (!handle) {
+    return std::unexpected(handle.error());
   }
+  return GetDutyCycle(*handle);
+}
 
-  if (!isValidChannelInternal(channel)) {
-    return std::unexpected(DriverError::InvalidChannel);
+template <typename CommType>
+DriverResult<uint16_t> Driver<CommType>::GetDutyCycle(ChannelHandle channel) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (auto result = checkInitialized(); !result) [[unlikely]] {
+    return std::unexpected(result.error());
   }
 
-  uint16_t ch_addr = GetChannelRegister(channel, ChannelReg::FB_DC);
+  uint16_t ch_addr = channel.Register(ChannelReg::FB_DC);
   return ReadRegister(ch_addr);
 }
 
 template <typename CommType>
 DriverResult<uint16_t> Driver<CommType>::GetVbatVoltage() noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return std::unexpected(result.error());
   }
@@ -1028,6 +2024,7 @@ DriverResult<uint16_t> Driver<CommType>::GetVbatVoltage() noexcept {
 
 template <typename CommType>
 DriverResult<uint16_t> Driver<CommType>::GetVioVoltage() noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return std::unexpected(result.error());
   }
@@ -1045,6 +2042,7 @@ DriverResult<uint16_t> Driver<CommType>::GetVioVoltage() noexcept {
 
 template <typename CommType>
 DriverResult<uint16_t> Driver<CommType>::GetVddVoltage() noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return std::unexpected(result.error());
   }
@@ -1063,6 +2061,7 @@ DriverResult<uint16_t> Driver<CommType>::GetVddVoltage() noexcept {
 template <typename CommType>
 DriverResult<void> Driver<CommType>::GetVbatThresholds(uint16_t& uv_threshold,
                                              uint16_t& ov_threshold) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return std::unexpected(result.error());
   }
@@ -1089,6 +2088,7 @@ DriverResult<void> Driver<CommType>::GetVbatThresholds(uint16_t& uv_threshold,
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::ClearFaults() noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return result;
   }
@@ -1099,30 +2099,33 @@ DriverResult<void> Driver<CommType>::ClearFaults() noexcept {
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::clearFaultsInternal() noexcept {
-  // Write 1s to clear fault bits in GLOBAL_DIAG0 (rwh type - clear on write 1)
+  for (uint8_t index = 0; index < FAULT_CLEAR_COUNT; ++index) {
+    if (auto result = clearFaultRegister(index); !result) {
+      return result;
+    }
+  }
+  return {};
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::clearFaultRegister(uint8_t index) noexcept {
+  // Write 1s to clear fault bits in GLOBAL_DIAG0..2 (rwh type - clear on write 1)
   // Note: Fault flags are latched. Writing 1 clears the latch, but if the underlying
   // condition still exists (or existed recently), the fault may be re-asserted immediately.
   // For voltage faults, the voltage must be within valid range for the fault to clear.
   // Some faults may have hysteresis (trigger at one voltage, clear at different voltage).
-  if (auto result = WriteRegister(CentralReg::GLOBAL_DIAG0, GLOBAL_DIAG0::CLEAR_ALL); !result) {
-    return std::unexpected(result.error());
-  }
-
-  // Clear GLOBAL_DIAG1
-  if (auto result = WriteRegister(CentralReg::GLOBAL_DIAG1, GLOBAL_DIAG1::CLEAR_ALL); !result) {
-    return std::unexpected(result.error());
-  }
-
-  // Clear GLOBAL_DIAG2
-  if (auto result = WriteRegister(CentralReg::GLOBAL_DIAG2, GLOBAL_DIAG2::CLEAR_ALL); !result) {
-    return std::unexpected(result.error());
-  }
-
-  return {};
+  static constexpr std::array<RegisterWrite, FAULT_CLEAR_COUNT> CLEARS{{
+      {CentralReg::GLOBAL_DIAG0, GLOBAL_DIAG0::CLEAR_ALL},
+      {CentralReg::GLOBAL_DIAG1, GLOBAL_DIAG1::CLEAR_ALL},
+      {CentralReg::GLOBAL_DIAG2, GLOBAL_DIAG2::CLEAR_ALL},
+  }};
+  const auto& clear = CLEARS[index < FAULT_CLEAR_COUNT ? index : 0];
+  return WriteRegister(clear.address, clear.value);
 }
 
 template <typename CommType>
 DriverResult<bool> Driver<CommType>::HasAnyFault() noexcept {
+  TLE92466ED_API_ENTRY();
   auto status_result = GetDeviceStatus();
   if (!status_result) {
     return std::unexpected(status_result.error());
@@ -1133,43 +2136,48 @@ DriverResult<bool> Driver<CommType>::HasAnyFault() noexcept {
 
 template <typename CommType>
 DriverResult<FaultReport> Driver<CommType>::GetAllFaults() noexcept {
-  if (auto result = checkInitialized(); !result) {
+  TLE92466ED_API_ENTRY();
+  // Same state machine as BeginGetAllFaults()/Step(), run to completion
+  OperationState op{};
+  if (auto result = beginOperation(op, Operation::GetAllFaults); !result) {
     return std::unexpected(result.error());
   }
-
-  FaultReport report{};
-
-  // Read GLOBAL_DIAG0
-  auto diag0_result = ReadRegister(CentralReg::GLOBAL_DIAG0);
-  if (!diag0_result) {
-    return std::unexpected(diag0_result.error());
+  if (auto result = runOperation(op); !result) {
+    return std::unexpected(result.error());
   }
-  uint16_t diag0 = *diag0_result;
+  return op.report;
+}
 
-  // External supply faults
-  report.vbat_uv = (diag0 & GLOBAL_DIAG0::VBAT_UV) != 0;
-  report.vbat_ov = (diag0 & GLOBAL_DIAG0::VBAT_OV) != 0;
-  report.vio_uv = (diag0 & GLOBAL_DIAG0::VIO_UV) != 0;
-  report.vio_ov = (diag0 & GLOBAL_DIAG0::VIO_OV) != 0;
-  report.vdd_uv = (diag0 & GLOBAL_DIAG0::VDD_UV) != 0;
-  report.vdd_ov = (diag0 & GLOBAL_DIAG0::VDD_OV) != 0;
-
-  // System faults
-  report.clock_fault = (diag0 & GLOBAL_DIAG0::CLK_NOK) != 0;
-  report.spi_wd_error = (diag0 & GLOBAL_DIAG0::SPI_WD_ERR) != 0;
-
-  // Temperature faults
-  report.ot_error = (diag0 & GLOBAL_DIAG0::COTERR) != 0;
-  report.ot_warning = (diag0 & GLOBAL_DIAG0::COTWARN) != 0;
-
-  // Reset events
-  report.reset_event = (diag0 & GLOBAL_DIAG0::RES_EVENT) != 0;
-  report.por_event = (diag0 & GLOBAL_DIAG0::POR_EVENT) != 0;
-
-  // Read GLOBAL_DIAG1
-  auto diag1_result = ReadRegister(CentralReg::GLOBAL_DIAG1);
-  if (diag1_result) {
-    uint16_t diag1 = *diag1_result;
+template <typename CommType>
+void Driver<CommType>::decodeFaultRegister(FaultReport& report, uint8_t index,
+                                           uint16_t value) noexcept {
+  switch (index) {
+  case 0: {
+    const uint16_t diag0 = value;
+
+    // External supply faults
+    report.vbat_uv = (diag0 & GLOBAL_DIAG0::VBAT_UV) != 0;
+    report.vbat_ov = (diag0 & GLOBAL_DIAG0::VBAT_OV) != 0;
+    report.vio_uv = (diag0 & GLOBAL_DIAG0::VIO_UV) != 0;
+    report.vio_ov = (diag0 & GLOBAL_DIAG0::VIO_OV) != 0;
+    report.vdd_uv = (diag0 & GLOBAL_DIAG0::VDD_UV) != 0;
+    report.vdd_ov = (diag0 & GLOBAL_DIAG0::VDD_OV) != 0;
+
+    // System faults
+    report.clock_fault = (diag0 & GLOBAL_DIAG0::CLK_NOK) != 0;
+    report.spi_wd_error = (diag0 & GLOBAL_DIAG0::SPI_WD_ERR) != 0;
+
+    // Temperature faults
+    report.ot_error = (diag0 & GLOBAL_DIAG0::COTERR) != 0;
+    report.ot_warning = (diag0 & GLOBAL_DIAG0::COTWARN) != 0;
+
+    // Reset events
+    report.reset_event = (diag0 & GLOBAL_DIAG0::RES_EVENT) != 0;
+    report.por_event = (diag0 & GLOBAL_DIAG0::POR_EVENT) != 0;
+    break;
+  }
+  case 1: {
+    const uint16_t diag1 = value;
     report.vr_iref_uv = (diag1 & GLOBAL_DIAG1::VR_IREF_UV) != 0;
     report.vr_iref_ov = (diag1 & GLOBAL_DIAG1::VR_IREF_OV) != 0;
     report.vdd2v5_uv = (diag1 & GLOBAL_DIAG1::VDD2V5_UV) != 0;
@@ -1178,55 +2186,53 @@ DriverResult<FaultReport> Driver<CommType>::GetAllFaults() noexcept {
     report.ref_ov = (diag1 & GLOBAL_DIAG1::REF_OV) != 0;
     report.vpre_ov = (diag1 & GLOBAL_DIAG1::VPRE_OV) != 0;
     report.hvadc_err = (diag1 & GLOBAL_DIAG1::HVADC_ERR) != 0;
+    break;
   }
-
-  // Read GLOBAL_DIAG2
-  auto diag2_result = ReadRegister(CentralReg::GLOBAL_DIAG2);
-  if (diag2_result) {
-    uint16_t diag2 = *diag2_result;
+  case 2: {
+    const uint16_t diag2 = value;
     report.reg_ecc_err = (diag2 & GLOBAL_DIAG2::REG_ECC_ERR) != 0;
     report.otp_ecc_err = (diag2 & GLOBAL_DIAG2::OTP_ECC_ERR) != 0;
     report.otp_virgin = (diag2 & GLOBAL_DIAG2::OTP_VIRGIN) != 0;
+    break;
   }
-
-  // Read FB_STAT for summary flags
-  auto fb_stat_result = ReadRegister(CentralReg::FB_STAT);
-  if (fb_stat_result) {
-    uint16_t fb_stat = *fb_stat_result;
+  case 3: {
+    // FB_STAT summary flags
+    const uint16_t fb_stat = value;
     report.supply_nok_internal = (fb_stat & FB_STAT::SUP_NOK_INT) != 0;
     report.supply_nok_external = (fb_stat & FB_STAT::SUP_NOK_EXT) != 0;
+    break;
+  }
+  default: {
+    auto& channel = report.channels[(index - 4) / 2];
+    if ((index - 4) % 2 == 0) {
+      // DIAG_ERR register
+      const uint16_t diag_err = value;
+      channel.overcurrent = (diag_err & (1 << 0)) != 0;
+      channel.short_to_ground = (diag_err & (1 << 1)) != 0;
+      channel.open_load = (diag_err & (1 << 2)) != 0;
+      channel.over_temperature = (diag_err & (1 << 3)) != 0;
+      channel.open_load_short_ground = (diag_err & (1 << 4)) != 0;
+    } else {
+      // DIAG_WARN register
+      const uint16_t diag_warn = value;
+      channel.ot_warning = (diag_warn & (1 << 0)) != 0;
+      channel.current_regulation_warning = (diag_warn & (1 << 1)) != 0;
+      channel.pwm_regulation_warning = (diag_warn & (1 << 2)) != 0;
+      channel.olsg_warning = (diag_warn & (1 << 3)) != 0;
+    }
+    break;
   }
+  }
+}
 
-  // Read channel-specific faults
-  for (uint8_t ch = 0; ch < 6; ++ch) {
-    // Read DIAG_ERR register
-    auto diag_err_result = ReadRegister(CentralReg::DIAG_ERR_CHGR0 + ch);
-    if (diag_err_result) {
-      uint16_t diag_err = *diag_err_result;
-      report.channels[ch].overcurrent = (diag_err & (1 << 0)) != 0;
-      report.channels[ch].short_to_ground = (diag_err & (1 << 1)) != 0;
-      report.channels[ch].open_load = (diag_err & (1 << 2)) != 0;
-      report.channels[ch].over_temperature = (diag_err & (1 << 3)) != 0;
-      report.channels[ch].open_load_short_ground = (diag_err & (1 << 4)) != 0;
-    }
-
-    // Read DIAG_WARN register
-    auto diag_warn_result = ReadRegister(CentralReg::DIAG_WARN_CHGR0 + ch);
-    if (diag_warn_result) {
-      uint16_t diag_warn = *diag_warn_result;
-      report.channels[ch].ot_warning = (diag_warn & (1 << 0)) != 0;
-      report.channels[ch].current_regulation_warning = (diag_warn & (1 << 1)) != 0;
-      report.channels[ch].pwm_regulation_warning = (diag_warn & (1 << 2)) != 0;
-      report.channels[ch].olsg_warning = (diag_warn & (1 << 3)) != 0;
-    }
-
-    // Check if channel has any fault
-    report.channels[ch].has_fault =
-        report.channels[ch].overcurrent || report.channels[ch].short_to_ground ||
-        report.channels[ch].open_load || report.channels[ch].over_temperature ||
-        report.channels[ch].open_load_short_ground || report.channels[ch].ot_warning ||
-        report.channels[ch].current_regulation_warning ||
-        report.channels[ch].pwm_regulation_warning || report.channels[ch].olsg_warning;
+template <typename CommType>
+void Driver<CommType>::summarizeFaults(FaultReport& report) noexcept {
+  // Check if each channel has any fault
+  for (auto& channel : report.channels) {
+    channel.has_fault = channel.overcurrent || channel.short_to_ground || channel.open_load ||
+                        channel.over_temperature || channel.open_load_short_ground ||
+                        channel.ot_warning || channel.current_regulation_warning ||
+                        channel.pwm_regulation_warning || channel.olsg_warning;
   }
 
   // Determine if any fault exists
@@ -1239,8 +2245,6 @@ DriverResult<FaultReport> Driver<CommType>::GetAllFaults() noexcept {
       report.supply_nok_external || report.channels[0].has_fault || report.channels[1].has_fault ||
       report.channels[2].has_fault || report.channels[3].has_fault ||
       report.channels[4].has_fault || report.channels[5].has_fault;
-
-  return report;
 }
 
 /**
@@ -1261,7 +2265,7 @@ DriverResult<FaultReport> Driver<CommType>::GetAllFaults() noexcept {
  *
  * The datasheet provides min-max ranges, not typical values. We use mid-range estimates.
  */
-static void getVioThresholds(uint16_t& uv_threshold, uint16_t& ov_threshold, bool vio_5v) noexcept {
+inline void getVioThresholds(uint16_t& uv_threshold, uint16_t& ov_threshold, bool vio_5v) noexcept {
   if (vio_5v) {
     // 5V mode: VIO_UV,5V,TH = 3.7-4.5V, VIO_OV,5V,TH = 5.5-6.4V
     uv_threshold = 4100; // Mid-range estimate (3.7-4.5V range)
@@ -1290,7 +2294,7 @@ static void getVioThresholds(uint16_t& uv_threshold, uint16_t& ov_threshold, boo
  *
  * The datasheet provides min-max ranges, not typical values. We use mid-range estimates.
  */
-static void getVddThresholds(uint16_t& uv_threshold, uint16_t& ov_threshold) noexcept {
+inline void getVddThresholds(uint16_t& uv_threshold, uint16_t& ov_threshold) noexcept {
   // VDD thresholds (fixed hardware): VDD_UV,TH = 3.7-4.5V, VDD_OV,TH = 5.5-6.4V
   uv_threshold = 4100; // Mid-range estimate (3.7-4.5V range)
   ov_threshold = 5950; // Mid-range estimate (5.5-6.4V range)
@@ -1298,76 +2302,27 @@ static void getVddThresholds(uint16_t& uv_threshold, uint16_t& ov_threshold) noe
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::PrintAllFaults() noexcept {
-  auto fault_result = GetAllFaults();
-  if (!fault_result) {
-    return std::unexpected(fault_result.error());
-  }
-
-  const FaultReport& report = *fault_result;
-
-  if (!report.any_fault) {
-    comm_.Log(LogLevel::Info, "TLE92466ED", "✅ No faults detected - All systems normal\n");
-    return {};
-  }
-
-  // Read voltage measurements and thresholds for voltage-related faults
-  uint16_t vbat_mv = 0;
-  uint16_t vio_mv = 0;
-  uint16_t vdd_mv = 0;
-  uint16_t vbat_uv_th_mv = 0;
-  uint16_t vbat_ov_th_mv = 0;
-  uint16_t vio_uv_th_mv = 0;
-  uint16_t vio_ov_th_mv = 0;
-  uint16_t vdd_uv_th_mv = 0;
-  uint16_t vdd_ov_th_mv = 0;
-  bool vio_5v = false;
-
-  // Read current voltages
-  if (auto vbat_result = GetVbatVoltage(); vbat_result) {
-    vbat_mv = *vbat_result;
-  }
-  if (auto vio_result = GetVioVoltage(); vio_result) {
-    vio_mv = *vio_result;
-  }
-  if (auto vdd_result = GetVddVoltage(); vdd_result) {
-    vdd_mv = *vdd_result;
-  }
-
-  // Read VBAT thresholds
-  if (auto result = GetVbatThresholds(vbat_uv_th_mv, vbat_ov_th_mv); !result) {
-    // If reading fails, thresholds remain 0
-  }
-
-  // Determine VIO thresholds based on VIO_SEL setting
-  // Note: GLOBAL_CONFIG may be write-only, so we can't reliably read it back
-  // We default to 3.3V mode (VIO_SEL=0) which is set in applyDefaultConfig()
-  // If user needs 5V mode, they should call ConfigureGlobal() with vio_5v=true
-  // For now, we'll try to read it, but default to 3.3V if read fails or returns unexpected value
-  // vio_5v is already declared above, just update it
-  if (auto global_config_result = ReadRegister(CentralReg::GLOBAL_CONFIG); global_config_result) {
-    // Try to read VIO_SEL bit, but don't trust it if it's write-only
-    vio_5v = (*global_config_result & GLOBAL_CONFIG::VIO_SEL) != 0;
-    // If read returns 0x4005 (default), it might be the power-on default, not what we wrote
-    // So we'll use it as a hint, but the actual setting is what we wrote in applyDefaultConfig()
-    if (*global_config_result == 0x4005) {
-      // This is the datasheet default (5V mode), but we wrote 3.3V mode in applyDefaultConfig()
-      // So trust our write, not the read
-      vio_5v = false;
-      comm_.Log(LogLevel::Info, "TLE92466ED",
-                "GLOBAL_CONFIG read returned default 0x4005, using 3.3V mode (as written in "
-                "applyDefaultConfig)\n");
-    } else {
-      comm_.Log(LogLevel::Info, "TLE92466ED", "Read GLOBAL_CONFIG: 0x%04X, VIO_SEL=%s\n",
-                *global_config_result, vio_5v ? "5V" : "3.3V");
-    }
-  } else {
-    comm_.Log(LogLevel::Info, "TLE92466ED",
-              "GLOBAL_CONFIG read failed, assuming 3.3V mode (as written in applyDefaultConfig)\n");
+  TLE92466ED_API_ENTRY();
+  // Same state machine as BeginPrintAllFaults()/Step(), run to completion
+  OperationState op{};
+  if (auto result = beginOperation(op, Operation::PrintAllFaults); !result) {
+    return result;
   }
-  getVioThresholds(vio_uv_th_mv, vio_ov_th_mv, vio_5v);
+  return runOperation(op);
+}
 
-  // Get VDD thresholds (fixed values)
-  getVddThresholds(vdd_uv_th_mv, vdd_ov_th_mv);
+template <typename CommType>
+void Driver<CommType>::printFaultReport(const FaultReport& report,
+                                        const SupplySnapshot& supply) noexcept {
+  const uint16_t vbat_mv = supply.vbat_mv;
+  const uint16_t vio_mv = supply.vio_mv;
+  const uint16_t vdd_mv = supply.vdd_mv;
+  const uint16_t vbat_uv_th_mv = supply.vbat_uv_th_mv;
+  const uint16_t vbat_ov_th_mv = supply.vbat_ov_th_mv;
+  const uint16_t vio_uv_th_mv = supply.vio_uv_th_mv;
+  const uint16_t vio_ov_th_mv = supply.vio_ov_th_mv;
+  const uint16_t vdd_uv_th_mv = supply.vdd_uv_th_mv;
+  const uint16_t vdd_ov_th_mv = supply.vdd_ov_th_mv;
 
   // Print header
   comm_.Log(LogLevel::Warn, "TLE92466ED",
@@ -1576,12 +2531,11 @@ DriverResult<void> Driver<CommType>::PrintAllFaults() noexcept {
 
   comm_.Log(LogLevel::Warn, "TLE92466ED",
             "╚══════════════════════════════════════════════════════════════════════════════╝\n");
-
-  return {};
 }
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::SoftwareReset() noexcept {
+  TLE92466ED_API_ENTRY();
   comm_.Log(LogLevel::Info, "TLE92466ED",
             "Performing software reset (entering config mode and clearing channel enable cache)\n");
   // Software reset would require toggling RESN pin or power cycle
@@ -1598,6 +2552,7 @@ DriverResult<void> Driver<CommType>::SoftwareReset() noexcept {
   channel_enable_cache_ = 0;
   // Also clear channel enable bits in ch_ctrl_cache_ (but keep OP_MODE and parallel bits)
   ch_ctrl_cache_ &= ~CH_CTRL::ALL_CH_MASK;
+  noteActuation();
 
   comm_.Log(LogLevel::Info, "TLE92466ED",
             "✅ Software reset completed (Config Mode entered, channel cache cleared)\n");
@@ -1605,25 +2560,461 @@ DriverResult<void> Driver<CommType>::SoftwareReset() noexcept {
 }
 
 //==========================================================================
-// WATCHDOG MANAGEMENT
+// HARNESS SCAN
 //==========================================================================
 
 template <typename CommType>
-DriverResult<void> Driver<CommType>::ReloadSpiWatchdog(uint16_t reload_value) noexcept {
+DriverResult<HarnessScanResult>
+Driver<CommType>::ScanHarness(const HarnessScanConfig& config) noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
-    return result;
+    return std::unexpected(result.error());
+  }
+  // Off-state diagnosis needs the outputs off and CH_CONFIG writable
+  if (auto result = checkConfigMode(); !result) {
+    return std::unexpected(result.error());
+  }
+  const uint8_t mask = config.channel_mask;
+  if (mask == 0 || (mask & ~CH_CTRL::ALL_CH_MASK) != 0) {
+    return std::unexpected(DriverError::InvalidParameter);
   }
 
-  // Mask to 11-bit field (bits 10:0) per datasheet
-  uint16_t masked_value = WD_RELOAD::MaskValue(reload_value);
-
-  comm_.Log(LogLevel::Info, "TLE92466ED",
-            "Reloading SPI watchdog: ReloadValue=%u (masked to 0x%03X)\n", reload_value,
-            masked_value);
+  std::array<uint8_t, 6> channels{};
+  std::array<uint16_t, 6> config_addresses{};
+  std::size_t count = 0;
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((mask & (1U << ch)) != 0) {
+      channels[count] = ch;
+      config_addresses[count] =
+          GetChannelRegister(static_cast<Channel>(ch), ChannelReg::CH_CONFIG);
+      ++count;
+    }
+  }
 
-  // Note: Writing any non-zero value clears SPI_WD_ERR if it was set
-  return WriteRegister(CentralReg::WD_RELOAD, masked_value);
-}
+  // 1. Current CH_CONFIG of all scanned channels
+  std::array<uint32_t, 6> previous{};
+  if (auto result = ReadRegisters(std::span<const uint16_t>(config_addresses.data(), count),
+                                  std::span<uint32_t>(previous.data(), count));
+      !result) {
+    return std::unexpected(result.error());
+  }
+
+  // 2. Full off-state diagnosis with the requested current, everything else kept, and
+  //    the latched DIAG_ERR/DIAG_WARN flags cleared (write 1 to clear) so only what the
+  //    scan detects is reported
+  constexpr uint16_t DIAG_CLEAR_ALL = 0xFFFF;
+  std::array<RegisterWrite, 18> writes{};
+  for (std::size_t i = 0; i < count; ++i) {
+    uint16_t lazy_default = 0;
+    if (pendingDefaultValue(config_addresses[i], lazy_default)) {
+      previous[i] = lazy_default; // Restored value is the default, not the reset value
+    }
+    const auto value = static_cast<uint16_t>(
+        (previous[i] & ~(CH_CONFIG::OFF_DIAG_MASK | CH_CONFIG::I_DIAG_MASK)) |
+        CH_CONFIG::OFF_DIAG_ENABLED | (static_cast<uint16_t>(config.diag_current) << 2));
+    writes[i] = RegisterWrite{config_addresses[i], value};
+    writes[count + (2 * i)] = RegisterWrite{
+        static_cast<uint16_t>(CentralReg::DIAG_ERR_CHGR0 + channels[i]), DIAG_CLEAR_ALL};
+    writes[count + (2 * i) + 1] = RegisterWrite{
+        static_cast<uint16_t>(CentralReg::DIAG_WARN_CHGR0 + channels[i]), DIAG_CLEAR_ALL};
+  }
+  if (auto result = writeBurst(std::span<const RegisterWrite>(writes.data(), 3 * count),
+                               crc_enabled_);
+      !result) {
+    return std::unexpected(result.error());
+  }
+
+  // 3. One settle time for all channels
+  DriverResult<void> diag_result{};
+  if (auto result =
+          awaitDeadline(comm_.ArmDeadline(TimingRequirement::Settle, config.settle_us));
+      !result) {
+    diag_result = std::unexpected(mapCommError(result.error()));
+  }
+
+  // 4. DIAG_ERR and DIAG_WARN of all scanned channels in one burst
+  std::array<uint16_t, 12> diag_addresses{};
+  for (std::size_t i = 0; i < count; ++i) {
+    diag_addresses[2 * i] = CentralReg::DIAG_ERR_CHGR0 + channels[i];
+    diag_addresses[(2 * i) + 1] = CentralReg::DIAG_WARN_CHGR0 + channels[i];
+  }
+  std::array<uint32_t, 12> diag{};
+  if (diag_result) {
+    diag_result = ReadRegisters(std::span<const uint16_t>(diag_addresses.data(), 2 * count),
+                                std::span<uint32_t>(diag.data(), 2 * count));
+  }
+
+  // 5. Restore the previous configuration even if the settle wait or diagnosis read failed
+  if (config.restore_config) {
+    for (std::size_t i = 0; i < count; ++i) {
+      writes[i].value = static_cast<uint16_t>(previous[i]);
+    }
+    if (auto result = writeBurst(std::span<const RegisterWrite>(writes.data(), count),
+                                 crc_enabled_);
+        !result) {
+      return std::unexpected(result.error());
+    }
+  }
+  if (!diag_result) {
+    return std::unexpected(diag_result.error());
+  }
+
+  HarnessScanResult scan{};
+  scan.scanned_mask = mask;
+  for (std::size_t i = 0; i < count; ++i) {
+    const uint8_t ch = channels[i];
+    const auto diag_err = static_cast<uint16_t>(diag[2 * i]);
+    scan.diag_err[ch] = diag_err;
+    scan.diag_warn[ch] = static_cast<uint16_t>(diag[(2 * i) + 1]);
+    // Bit positions as in GetChannelDiagnostics(): OC 0, SG 1, OL 2, OLSG 4
+    WiringVerdict verdict = WiringVerdict::Ok;
+    if ((diag_err & (1U << 1)) != 0) {
+      verdict = WiringVerdict::ShortToGround;
+    } else if ((diag_err & (1U << 0)) != 0) {
+      verdict = WiringVerdict::Overcurrent;
+    } else if ((diag_err & (1U << 2)) != 0) {
+      verdict = WiringVerdict::OpenLoad;
+    } else if ((diag_err & (1U << 4)) != 0) {
+      verdict = WiringVerdict::OpenLoadOrShort;
+    }
+    scan.verdicts[ch] = verdict;
+    if (verdict != WiringVerdict::Ok) {
+      scan.fault_mask |= static_cast<uint8_t>(1U << ch);
+    }
+  }
+
+  comm_.Log(LogLevel::Info, "TLE92466ED", "Harness scan: channels 0x%02X, faults 0x%02X\n",
+            static_cast<unsigned>(scan.scanned_mask), static_cast<unsigned>(scan.fault_mask));
+  return scan;
+}
+
+#ifdef TLE92466ED_ENABLE_RESUMABLE_OPS
+//==========================================================================
+// RESUMABLE OPERATIONS (TLE92466ED_ENABLE_RESUMABLE_OPS)
+//==========================================================================
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::BeginInit() noexcept {
+  TLE92466ED_API_ENTRY();
+  if (op_.kind != Operation::None) {
+    return std::unexpected(DriverError::Busy);
+  }
+  return beginOperation(op_, Operation::Init);
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::BeginGetAllFaults() noexcept {
+  TLE92466ED_API_ENTRY();
+  if (op_.kind != Operation::None) {
+    return std::unexpected(DriverError::Busy);
+  }
+  return beginOperation(op_, Operation::GetAllFaults);
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::BeginPrintAllFaults() noexcept {
+  TLE92466ED_API_ENTRY();
+  if (op_.kind != Operation::None) {
+    return std::unexpected(DriverError::Busy);
+  }
+  return beginOperation(op_, Operation::PrintAllFaults);
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::BeginConfigureChannel(Channel channel,
+                                                           const ChannelConfig& config) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (op_.kind != Operation::None) {
+    return std::unexpected(DriverError::Busy);
+  }
+  return beginOperation(op_, Operation::ConfigureChannel, channel, config);
+}
+
+template <typename CommType>
+DriverResult<StepStatus> Driver<CommType>::Step(uint16_t max_frames) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (op_.kind == Operation::None) {
+    return StepStatus::Done;
+  }
+  return advanceOperation(op_, max_frames, false);
+}
+#endif // TLE92466ED_ENABLE_RESUMABLE_OPS
+
+//==========================================================================
+// RESUMABLE OPERATION ENGINE (shared with the blocking functions)
+//==========================================================================
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::beginOperation(OperationState& op, Operation kind,
+                                                    Channel channel,
+                                                    const ChannelConfig& config) noexcept {
+  switch (kind) {
+  case Operation::Init:
+    op = OperationState{};
+    op.phase = OpPhase::InitReset;
+    break;
+
+  case Operation::GetAllFaults:
+  case Operation::PrintAllFaults:
+    if (auto result = checkInitialized(); !result) {
+      return result;
+    }
+    op = OperationState{};
+    op.phase = OpPhase::FaultRead;
+    break;
+
+  case Operation::ConfigureChannel:
+    if (auto result = checkInitialized(); !result) {
+      return result;
+    }
+
+    // Most configuration requires Config Mode
+    if (auto result = checkConfigMode(); !result) {
+      return result;
+    }
+
+    if (!isValidChannelInternal(channel)) {
+      return std::unexpected(DriverError::InvalidChannel);
+    }
+
+    comm_.Log(LogLevel::Info, "TLE92466ED",
+              "Configuring channel: %s, Mode=%s, Current=%u mA, "
+              "SlewRate=%s, DiagCurrent=%s, OL_Threshold=%u\n",
+              ToString(channel), ToString(config.mode), config.current_setpoint_ma,
+              ToString(config.slew_rate), ToString(config.diag_current),
+              config.open_load_threshold);
+
+    op = OperationState{};
+    op.phase = OpPhase::ConfigParallel;
+    op.channel = channel;
+    op.config = config;
+    break;
+
+  default:
+    return std::unexpected(DriverError::InvalidParameter);
+  }
+
+  op.kind = kind;
+  return {};
+}
+
+template <typename CommType>
+DriverResult<StepStatus> Driver<CommType>::advanceOperation(OperationState& op,
+                                                            uint16_t max_frames,
+                                                            bool blocking) noexcept {
+  uint32_t frames = 0;
+  while (op.phase != OpPhase::Done) {
+    // Always make progress: the first phase of a step runs even if it alone exceeds the budget
+    const uint8_t cost = phaseFrames(op);
+    if (frames != 0 && frames + cost > max_frames) {
+      return StepStatus::InProgress;
+    }
+
+    DriverResult<bool> progressed{};
+    switch (op.kind) {
+    case Operation::Init:
+      progressed = runInitPhase(op, blocking);
+      break;
+    case Operation::GetAllFaults:
+    case Operation::PrintAllFaults:
+      progressed = runFaultPhase(op);
+      break;
+    case Operation::ConfigureChannel:
+      progressed = runChannelPhase(op);
+      break;
+    default:
+      op.phase = OpPhase::Done;
+      continue;
+    }
+
+    if (!progressed) {
+      op.kind = Operation::None;
+      return std::unexpected(progressed.error());
+    }
+    if (!*progressed) {
+      return StepStatus::InProgress; // Deadline still running, yield the bus
+    }
+    frames += cost;
+  }
+
+  op.kind = Operation::None;
+  return StepStatus::Done;
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::runOperation(OperationState& op) noexcept {
+  if (auto result = advanceOperation(op, UINT16_MAX, true); !result) {
+    return std::unexpected(result.error());
+  }
+  return {};
+}
+
+template <typename CommType>
+uint8_t Driver<CommType>::phaseFrames(const OperationState& op) noexcept {
+  const ChannelConfig& config = op.config;
+  switch (op.phase) {
+  case OpPhase::InitClock:
+  case OpPhase::InitVerify:
+  case OpPhase::FaultRead:
+  case OpPhase::PrintVoltages:
+  case OpPhase::PrintVbatThresholds:
+  case OpPhase::PrintVioMode:
+  case OpPhase::ConfigParallel:
+    return FRAMES_READ;
+  case OpPhase::InitDefaults:
+  case OpPhase::InitClearFaults:
+    return FRAMES_VERIFIED_WRITE;
+  case OpPhase::ConfigMode:
+    return FRAMES_CHANNEL_CORE;
+  case OpPhase::ConfigOlsgWarning:
+    return config.olsg_warning_enabled ? FRAMES_MODIFY : 0;
+  case OpPhase::ConfigPwm:
+    return config.pwm_period_mantissa > 0 ? FRAMES_VERIFIED_WRITE : 0;
+  case OpPhase::ConfigDither:
+    return config.dither_step_size > 0 ? 2 * FRAMES_VERIFIED_WRITE : 0;
+  case OpPhase::ConfigDeepDither:
+    return (config.dither_step_size > 0 && config.deep_dither_enabled) ? FRAMES_MODIFY : 0;
+  default:
+    return 0; // GPIO, deadline and bookkeeping phases
+  }
+}
+
+template <typename CommType>
+DriverResult<bool> Driver<CommType>::runFaultPhase(OperationState& op) noexcept {
+  SupplySnapshot& supply = op.supply;
+
+  switch (op.phase) {
+  case OpPhase::FaultRead: {
+    // GLOBAL_DIAG0 must be readable; the remaining registers are best effort
+    auto result = ReadRegister(faultScanAddress(op.index));
+    if (result) {
+      decodeFaultRegister(op.report, op.index, static_cast<uint16_t>(*result));
+    } else if (op.index == 0) {
+      return std::unexpected(result.error());
+    }
+    if (++op.index == FAULT_SCAN_COUNT) {
+      op.index = 0;
+      op.phase = OpPhase::FaultSummary;
+    }
+    return true;
+  }
+
+  case OpPhase::FaultSummary:
+    summarizeFaults(op.report);
+    if (op.kind == Operation::GetAllFaults) {
+      op.phase = OpPhase::Done;
+    } else if (!op.report.any_fault) {
+      comm_.Log(LogLevel::Info, "TLE92466ED", "✅ No faults detected - All systems normal\n");
+      op.phase = OpPhase::Done;
+    } else {
+      op.phase = OpPhase::PrintVoltages;
+    }
+    return true;
+
+  case OpPhase::PrintVoltages: {
+    // Read current voltages for voltage-related faults
+    DriverResult<uint16_t> result{};
+    uint16_t* target = nullptr;
+    switch (op.index) {
+    case 0:
+      result = GetVbatVoltage();
+      target = &supply.vbat_mv;
+      break;
+    case 1:
+      result = GetVioVoltage();
+      target = &supply.vio_mv;
+      break;
+    default:
+      result = GetVddVoltage();
+      target = &supply.vdd_mv;
+      break;
+    }
+    if (result) {
+      *target = *result;
+    }
+    if (++op.index == 3) {
+      op.index = 0;
+      op.phase = OpPhase::PrintVbatThresholds;
+    }
+    return true;
+  }
+
+  case OpPhase::PrintVbatThresholds:
+    // Read VBAT thresholds
+    if (auto result = GetVbatThresholds(supply.vbat_uv_th_mv, supply.vbat_ov_th_mv); !result) {
+      // If reading fails, thresholds remain 0
+    }
+    op.phase = OpPhase::PrintVioMode;
+    return true;
+
+  case OpPhase::PrintVioMode: {
+    // Determine VIO thresholds based on VIO_SEL setting
+    // Note: GLOBAL_CONFIG may be write-only, so we can't reliably read it back
+    // We default to 3.3V mode (VIO_SEL=0) which is set in applyDefaultConfigStep()
+    // If user needs 5V mode, they should call ConfigureGlobal() with vio_5v=true
+    // For now, we'll try to read it, but default to 3.3V if read fails or returns unexpected value
+    bool vio_5v = false;
+    if (auto global_config_result = ReadRegister(CentralReg::GLOBAL_CONFIG);
+        global_config_result) {
+      // Try to read VIO_SEL bit, but don't trust it if it's write-only
+      vio_5v = (*global_config_result & GLOBAL_CONFIG::VIO_SEL) != 0;
+      // If read returns 0x4005 (default), it might be the power-on default, not what we wrote
+      // So we'll use it as a hint, but the actual setting is what we wrote during Init
+      if (*global_config_result == 0x4005) {
+        // This is the datasheet default (5V mode), but we wrote 3.3V mode during Init
+        // So trust our write, not the read
+        vio_5v = false;
+        comm_.Log(LogLevel::Info, "TLE92466ED",
+                  "GLOBAL_CONFIG read returned default 0x4005, using 3.3V mode (as written in "
+                  "applyDefaultConfig)\n");
+      } else {
+        comm_.Log(LogLevel::Info, "TLE92466ED", "Read GLOBAL_CONFIG: 0x%04X, VIO_SEL=%s\n",
+                  *global_config_result, vio_5v ? "5V" : "3.3V");
+      }
+    } else {
+      comm_.Log(
+          LogLevel::Info, "TLE92466ED",
+          "GLOBAL_CONFIG read failed, assuming 3.3V mode (as written in applyDefaultConfig)\n");
+    }
+    getVioThresholds(supply.vio_uv_th_mv, supply.vio_ov_th_mv, vio_5v);
+
+    // Get VDD thresholds (fixed values)
+    getVddThresholds(supply.vdd_uv_th_mv, supply.vdd_ov_th_mv);
+    op.phase = OpPhase::PrintReport;
+    return true;
+  }
+
+  case OpPhase::PrintReport:
+    printFaultReport(op.report, supply);
+    op.phase = OpPhase::Done;
+    return true;
+
+  default:
+    return std::unexpected(DriverError::ConfigurationError);
+  }
+}
+
+//==========================================================================
+// WATCHDOG MANAGEMENT
+//==========================================================================
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::ReloadSpiWatchdog(uint16_t reload_value) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (auto result = checkInitialized(); !result) {
+    return result;
+  }
+
+  // Mask to 11-bit field (bits 10:0) per datasheet
+  uint16_t masked_value = WD_RELOAD::MaskValue(reload_value);
+
+  comm_.Log(LogLevel::Info, "TLE92466ED",
+            "Reloading SPI watchdog: ReloadValue=%u (masked to 0x%03X)\n", reload_value,
+            masked_value);
+
+  // Note: Writing any non-zero value clears SPI_WD_ERR if it was set
+  return WriteRegister(CentralReg::WD_RELOAD, masked_value);
+}
 
 //==========================================================================
 // DEVICE INFORMATION
@@ -1631,6 +3022,7 @@ DriverResult<void> Driver<CommType>::ReloadSpiWatchdog(uint16_t reload_value) no
 
 template <typename CommType>
 DriverResult<uint16_t> Driver<CommType>::GetIcVersion() noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return std::unexpected(result.error());
   }
@@ -1640,6 +3032,7 @@ DriverResult<uint16_t> Driver<CommType>::GetIcVersion() noexcept {
 
 template <typename CommType>
 DriverResult<std::array<uint16_t, 3>> Driver<CommType>::GetChipId() noexcept {
+  TLE92466ED_API_ENTRY();
   if (auto result = checkInitialized(); !result) {
     return std::unexpected(result.error());
   }
@@ -1669,6 +3062,7 @@ DriverResult<std::array<uint16_t, 3>> Driver<CommType>::GetChipId() noexcept {
 
 template <typename CommType>
 DriverResult<bool> Driver<CommType>::VerifyDevice() noexcept {
+  TLE92466ED_API_ENTRY();
   // Read ICVID register to verify device is responding and check device type
   auto id_result = ReadRegister(CentralReg::ICVID, false); // Don't verify CRC during init
 
@@ -1708,12 +3102,447 @@ DriverResult<bool> Driver<CommType>::VerifyDevice() noexcept {
   return static_cast<bool>(valid);
 }
 
+#ifdef TLE92466ED_ENABLE_USAGE
+//==========================================================================
+// USAGE TRACKING (TLE92466ED_ENABLE_USAGE)
+//==========================================================================
+
+template <typename CommType>
+const UsageAccumulator& Driver<CommType>::GetUsage() noexcept {
+  usage_.Advance(comm_.NowUs());
+  return usage_;
+}
+
+template <typename CommType>
+bool Driver<CommType>::RestoreUsage(std::span<const uint8_t> blob) noexcept {
+  if (!usage_.Deserialize(blob)) {
+    comm_.Log(LogLevel::Warn, "TLE92466ED", "Usage blob rejected (bad header, size or CRC)\n");
+    return false;
+  }
+  // Restart running intervals from now so the restored counters are not double-counted
+  usage_.Advance(comm_.NowUs());
+  return true;
+}
+#endif // TLE92466ED_ENABLE_USAGE
+
+#ifdef TLE92466ED_ENABLE_THERMAL
+//==========================================================================
+// THERMAL ESTIMATION (TLE92466ED_ENABLE_THERMAL)
+//==========================================================================
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::UpdateThermalEstimate(uint32_t elapsed_us) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (auto result = checkInitialized(); !result) {
+    return result;
+  }
+
+  const uint64_t now = comm_.NowUs();
+  if (elapsed_us == 0) {
+    if (now == 0) {
+      return std::unexpected(DriverError::InvalidParameter); // No time source available
+    }
+    if (thermal_last_us_ == 0 || now <= thermal_last_us_) {
+      thermal_last_us_ = now; // First sample only establishes the time base
+      return {};
+    }
+    elapsed_us = static_cast<uint32_t>(now - thermal_last_us_);
+  }
+  thermal_last_us_ = now;
+
+  // Sweep VBAT (FB_VOLTAGE2) and FB_I_AVG of all driven channels in one burst (N+2 frames)
+  const uint8_t active =
+      static_cast<uint8_t>(mission_mode_ ? (ch_ctrl_cache_ & CH_CTRL::ALL_CH_MASK) : 0U);
+  std::array<uint16_t, 7> addresses{CentralReg::FB_VOLTAGE2};
+  std::array<uint32_t, 7> values{};
+  std::size_t count = 1;
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((active & (1U << ch)) != 0) {
+      addresses[count++] = GetChannelBase(static_cast<Channel>(ch)) + ChannelReg::FB_I_AVG;
+    }
+  }
+  uint16_t vbat_mv = 0;
+  if (active != 0) {
+    if (auto result = ReadRegisters(std::span<const uint16_t>(addresses.data(), count),
+                                    std::span<uint32_t>(values.data(), count));
+        !result) {
+      return result;
+    }
+    vbat_mv = VOLTAGE_FEEDBACK::ExtractVbatMillivolts(values[0]);
+  }
+
+  std::size_t idx = 1;
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((active & (1U << ch)) == 0) {
+      thermal_.Update(ch, 0, 0, elapsed_us); // Channel off: no losses, cooling only
+      continue;
+    }
+    const auto channel = static_cast<Channel>(ch);
+    const auto i_raw = static_cast<uint16_t>(values[idx++] & SETPOINT::TARGET_MASK);
+    const uint16_t current_ma = SETPOINT::CalculateCurrent(i_raw, isChannelParallelCached(channel));
+    thermal_.Update(ch, current_ma, vbat_mv, elapsed_us);
+  }
+  return {};
+}
+#endif // TLE92466ED_ENABLE_THERMAL
+
+//==========================================================================
+// TELEMETRY
+//==========================================================================
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::CaptureTelemetry(TelemetrySample& sample) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (auto result = checkInitialized(); !result) {
+    return result;
+  }
+
+  // Central registers first, then FB_I_AVG/FB_DC/DIAG_ERR/DIAG_WARN per channel
+  constexpr std::size_t CENTRAL_COUNT = 6;
+  constexpr std::size_t PER_CHANNEL = 4;
+  std::array<uint16_t, CENTRAL_COUNT + (PER_CHANNEL * 6)> addresses{
+      CentralReg::GLOBAL_DIAG0, CentralReg::GLOBAL_DIAG1, CentralReg::GLOBAL_DIAG2,
+      CentralReg::FB_STAT,      CentralReg::FB_VOLTAGE1,  CentralReg::FB_VOLTAGE2};
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    const uint16_t base = GetChannelBase(static_cast<Channel>(ch));
+    const std::size_t slot = CENTRAL_COUNT + (PER_CHANNEL * ch);
+    addresses[slot] = base + ChannelReg::FB_I_AVG;
+    addresses[slot + 1] = base + ChannelReg::FB_DC;
+    addresses[slot + 2] = CentralReg::DIAG_ERR_CHGR0 + ch;
+    addresses[slot + 3] = CentralReg::DIAG_WARN_CHGR0 + ch;
+  }
+
+  std::array<uint32_t, addresses.size()> values{};
+  if (auto result = ReadRegisters(addresses, values); !result) {
+    return result;
+  }
+
+  TelemetrySample captured{};
+  captured.timestamp_us = comm_.NowUs();
+  captured.capture_count = ++telemetry_count_;
+  captured.global_diag0 = static_cast<uint16_t>(values[0]);
+  captured.global_diag1 = static_cast<uint16_t>(values[1]);
+  captured.global_diag2 = static_cast<uint16_t>(values[2]);
+  captured.fb_stat = static_cast<uint16_t>(values[3]);
+  captured.vio_mv = VOLTAGE_FEEDBACK::ExtractVioMillivolts(values[4]);
+  captured.vdd_mv = VOLTAGE_FEEDBACK::ExtractVddMillivolts(values[4]);
+  captured.vbat_mv = VOLTAGE_FEEDBACK::ExtractVbatMillivolts(values[5]);
+  captured.enable_mask = static_cast<uint8_t>(channel_enable_cache_ & 0x3FU);
+  captured.mission_mode = mission_mode_ ? 1U : 0U;
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    const std::size_t slot = CENTRAL_COUNT + (PER_CHANNEL * ch);
+    auto& channel = captured.channels[ch];
+    channel.setpoint = channel_setpoints_[ch];
+    channel.average_current = static_cast<uint16_t>(values[slot]);
+    channel.duty_cycle = static_cast<uint16_t>(values[slot + 1]);
+    channel.diag_err = static_cast<uint16_t>(values[slot + 2]);
+    channel.diag_warn = static_cast<uint16_t>(values[slot + 3]);
+  }
+
+  sample = captured;
+  return {};
+}
+
+//==========================================================================
+// CHANNEL VIEWS
+//==========================================================================
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::FetchChannels(uint8_t channel_mask, ChannelField fields,
+                                                   ChannelSweep& sweep) noexcept {
+  TLE92466ED_API_ENTRY();
+  if (auto result = checkInitialized(); !result) {
+    return result;
+  }
+
+  // Register of each field, in ChannelField bit order
+  constexpr std::size_t FIELD_COUNT = 6;
+  const auto field_mask = static_cast<uint8_t>(static_cast<uint8_t>(fields) & 0x3FU);
+  channel_mask &= CH_CTRL::ALL_CH_MASK;
+
+  std::array<uint16_t, FIELD_COUNT * 6> addresses{};
+  std::size_t count = 0;
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((channel_mask & (1U << ch)) == 0) {
+      continue;
+    }
+    const uint16_t base = GetChannelBase(static_cast<Channel>(ch));
+    const std::array<uint16_t, FIELD_COUNT> registers{
+        static_cast<uint16_t>(base + ChannelReg::FB_I_AVG),
+        static_cast<uint16_t>(base + ChannelReg::FB_DC),
+        static_cast<uint16_t>(base + ChannelReg::FB_IMIN_IMAX),
+        static_cast<uint16_t>(base + ChannelReg::FB_VBAT),
+        static_cast<uint16_t>(CentralReg::DIAG_ERR_CHGR0 + ch),
+        static_cast<uint16_t>(CentralReg::DIAG_WARN_CHGR0 + ch)};
+    for (std::size_t field = 0; field < FIELD_COUNT; ++field) {
+      if ((field_mask & (1U << field)) != 0) {
+        addresses[count++] = registers[field];
+      }
+    }
+  }
+
+  // One burst per MAX_BURST_REGISTERS registers (two at most)
+  std::array<uint32_t, addresses.size()> values{};
+  for (std::size_t offset = 0; offset < count; offset += CommType::MAX_BURST_REGISTERS) {
+    const std::size_t burst = std::min(count - offset, CommType::MAX_BURST_REGISTERS);
+    if (auto result = ReadRegisters(std::span<const uint16_t>(addresses.data() + offset, burst),
+                                    std::span<uint32_t>(values.data() + offset, burst));
+        !result) {
+      return result;
+    }
+  }
+
+  ChannelSweep fetched{};
+  std::size_t slot = 0;
+  for (uint8_t ch = 0; ch < 6; ++ch) {
+    if ((channel_mask & (1U << ch)) == 0) {
+      continue;
+    }
+    const auto channel = static_cast<Channel>(ch);
+    auto& sample = fetched.samples[fetched.count++];
+    sample.channel = channel;
+    sample.enabled = (channel_enable_cache_ & (1U << ch)) != 0;
+    sample.parallel = isChannelParallelCached(channel);
+    sample.setpoint_ma = SETPOINT::CalculateCurrent(channel_setpoints_[ch], sample.parallel);
+    if ((field_mask & static_cast<uint8_t>(ChannelField::AverageCurrent)) != 0) {
+      const auto raw = static_cast<uint16_t>(values[slot++]);
+      noteFeedbackSample(ch, raw);
+      sample.average_current_ma = SETPOINT::CalculateCurrent(raw, sample.parallel);
+    }
+    if ((field_mask & static_cast<uint8_t>(ChannelField::DutyCycle)) != 0) {
+      sample.duty_cycle = static_cast<uint16_t>(values[slot++]);
+    }
+    if ((field_mask & static_cast<uint8_t>(ChannelField::MinMaxCurrent)) != 0) {
+      // [15:8] = I_MAX, [7:0] = I_MIN
+      const auto minmax = static_cast<uint16_t>(values[slot++]);
+      sample.min_current = static_cast<uint8_t>(minmax & 0x00FFU);
+      sample.max_current = static_cast<uint8_t>(minmax >> 8);
+    }
+    if ((field_mask & static_cast<uint8_t>(ChannelField::VbatFeedback)) != 0) {
+      sample.vbat_feedback = static_cast<uint16_t>(values[slot++]);
+    }
+    if ((field_mask & static_cast<uint8_t>(ChannelField::Errors)) != 0) {
+      sample.diag_err = static_cast<uint16_t>(values[slot++]);
+    }
+    if ((field_mask & static_cast<uint8_t>(ChannelField::Warnings)) != 0) {
+      sample.diag_warn = static_cast<uint16_t>(values[slot++]);
+    }
+  }
+
+  sweep = fetched;
+  return {};
+}
+
+#ifdef TLE92466ED_ENABLE_FEEDBACK
+//==========================================================================
+// FEEDBACK SUBSCRIPTIONS
+//==========================================================================
+
+template <typename CommType>
+DriverResult<uint8_t>
+Driver<CommType>::SubscribeFeedback(const FeedbackSubscription& subscription) noexcept {
+  if (subscription.quantity != FeedbackQuantity::Vbat &&
+      !isValidChannelInternal(subscription.channel)) {
+    return std::unexpected(DriverError::InvalidChannel);
+  }
+  if (subscription.deadband == 0 && !subscription.use_threshold) {
+    return std::unexpected(DriverError::InvalidParameter);
+  }
+
+  uint8_t id = 0;
+  if (!feedback_.Subscribe(subscription, id)) {
+    return std::unexpected(DriverError::CapacityExceeded);
+  }
+  return id;
+}
+
+template <typename CommType>
+DriverResult<uint8_t> Driver<CommType>::PollFeedback() noexcept {
+  TLE92466ED_API_ENTRY();
+  if (auto result = checkInitialized(); !result) {
+    return std::unexpected(result.error());
+  }
+
+  const uint16_t mask = feedback_.SourceMask();
+  if (mask == 0) {
+    return 0;
+  }
+
+  // One address per needed source, in source order
+  std::array<uint16_t, FeedbackMonitor::SOURCE_COUNT> addresses{};
+  std::array<uint8_t, FeedbackMonitor::SOURCE_COUNT> sources{};
+  std::size_t count = 0;
+  for (uint8_t source = 0; source < FeedbackMonitor::SOURCE_COUNT; ++source) {
+    if ((mask & (1U << source)) == 0) {
+      continue;
+    }
+    if (source == FeedbackMonitor::VBAT_SOURCE) {
+      addresses[count] = CentralReg::FB_VOLTAGE2;
+    } else {
+      const auto channel = static_cast<Channel>(source % 6);
+      addresses[count] =
+          GetChannelRegister(channel, source < 6 ? ChannelReg::FB_I_AVG : ChannelReg::FB_DC);
+    }
+    sources[count++] = source;
+  }
+
+  std::array<uint32_t, FeedbackMonitor::SOURCE_COUNT> raw{};
+  if (auto result = ReadRegisters(std::span<const uint16_t>(addresses.data(), count),
+                                  std::span<uint32_t>(raw.data(), count));
+      !result) {
+    return std::unexpected(result.error());
+  }
+
+  std::array<uint16_t, FeedbackMonitor::SOURCE_COUNT> values{};
+  for (std::size_t i = 0; i < count; ++i) {
+    const uint8_t source = sources[i];
+    if (source == FeedbackMonitor::VBAT_SOURCE) {
+      values[source] = VOLTAGE_FEEDBACK::ExtractVbatMillivolts(raw[i]);
+    } else if (source < 6) {
+      const auto channel = static_cast<Channel>(source);
+      noteFeedbackSample(source, static_cast<uint16_t>(raw[i]));
+      values[source] = SETPOINT::CalculateCurrent(static_cast<uint16_t>(raw[i]),
+                                                  isChannelParallelCached(channel));
+    } else {
+      values[source] = static_cast<uint16_t>(raw[i]);
+    }
+  }
+
+  return feedback_.Evaluate(values, comm_.NowUs());
+}
+#endif
+
+//==========================================================================
+// BUS QOS
+//==========================================================================
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::ConfigureBusQos(const BusQosConfig& config) noexcept {
+  bool limited = false;
+  for (const auto& budget : config.budgets) {
+    limited = limited || budget.frames_per_second != 0;
+  }
+  // Buckets refill from NowUs(); without a time source they would never refill
+  const uint64_t now = comm_.NowUs();
+  if (limited && now == 0) {
+    comm_.Log(LogLevel::Error, "TLE92466ED", "Bus QoS needs a time source (NowUs)\n");
+    return std::unexpected(DriverError::InvalidParameter);
+  }
+  if (!qos_.Configure(config, now)) {
+    comm_.Log(LogLevel::Error, "TLE92466ED",
+              "Bus QoS budgets exceed the bus capacity of %u frames/s\n",
+              static_cast<unsigned>(config.bus_frames_per_second));
+    return std::unexpected(DriverError::InvalidParameter);
+  }
+  return {};
+}
+
+#ifdef TLE92466ED_ENABLE_INTEGRITY
+//==========================================================================
+// RX INTEGRITY (TLE92466ED_ENABLE_INTEGRITY)
+//==========================================================================
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::ConfigureIntegrity(const IntegrityConfig& config) noexcept {
+  TLE92466ED_API_ENTRY();
+  // Pending telemetry was already handed out; its verdict must not be lost
+  const std::size_t failures = verifyDeferred();
+  if (!integrity_.Configure(config)) {
+    return std::unexpected(DriverError::InvalidParameter);
+  }
+  if (failures != 0) {
+    return std::unexpected(DriverError::CRCError);
+  }
+  return {};
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::VerifyPendingReplies() noexcept {
+  TLE92466ED_API_ENTRY();
+  if (verifyDeferred() != 0) {
+    return std::unexpected(DriverError::CRCError);
+  }
+  return {};
+}
+
+template <typename CommType>
+std::size_t Driver<CommType>::verifyDeferred() noexcept {
+  const std::size_t failures = integrity_.VerifyBatch();
+  if (failures != 0) [[unlikely]] {
+    comm_.Log(LogLevel::Warn, "TLE92466ED",
+              "%u deferred telemetry replies failed CRC, requalifying\n",
+              static_cast<unsigned>(failures));
+  }
+  return failures;
+}
+#endif // TLE92466ED_ENABLE_INTEGRITY
+
+#ifdef TLE92466ED_ENABLE_PROFILER
+//==========================================================================
+// REGISTER ACCESS PROFILER
+//==========================================================================
+
+template <typename CommType>
+void Driver<CommType>::PrintProfileReport() const noexcept {
+  comm_.Log(LogLevel::Info, "TLE92466ED", "Register access profile (per call):\n");
+  for (const auto& api : profiler_.Apis()) {
+    if (api.name == nullptr || api.calls == 0) {
+      continue;
+    }
+    comm_.Log(LogLevel::Info, "TLE92466ED",
+              "  %-26s calls=%-7u reads=%.1f (single %.1f) writes=%.1f\n", api.name,
+              static_cast<unsigned>(api.calls), static_cast<double>(api.reads) / api.calls,
+              static_cast<double>(api.single_reads) / api.calls,
+              static_cast<double>(api.writes) / api.calls);
+  }
+
+  static constexpr const char* ADVICE_NAMES[] = {"-", "cache", "poll less", "batch"};
+  std::array<RegisterAdvice, 16> advice{};
+  const std::size_t count = profiler_.Advise(advice);
+  comm_.Log(LogLevel::Info, "TLE92466ED", "Register candidates (%u):\n",
+            static_cast<unsigned>(count));
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto& line = advice[i];
+    comm_.Log(LogLevel::Info, "TLE92466ED",
+              "  0x%04X %-9s reads=%u unchanged=%u%% writes=%u top=%s\n", line.address,
+              ADVICE_NAMES[static_cast<uint8_t>(line.advice)], static_cast<unsigned>(line.reads),
+              static_cast<unsigned>(line.unchanged_reads * 100U / line.reads),
+              static_cast<unsigned>(line.writes), line.top_api != nullptr ? line.top_api : "-");
+  }
+  if (profiler_.Overflows() != 0) {
+    comm_.Log(LogLevel::Warn, "TLE92466ED", "Profiler tables full: %u accesses not recorded\n",
+              static_cast<unsigned>(profiler_.Overflows()));
+  }
+}
+#endif
+
 //==========================================================================
 // REGISTER ACCESS
 //==========================================================================
 
 template <typename CommType>
 DriverResult<uint32_t> Driver<CommType>::ReadRegister(uint16_t address, bool verify_crc) noexcept {
+  if (!plainReads()) [[unlikely]] {
+    return readRegisterFull(address, verify_crc);
+  }
+  if (!comm_.IsReady()) {
+    return std::unexpected(DriverError::HardwareError);
+  }
+
+  // Fast path: one frame, CRC checked inline
+  const bool should_verify_crc = verify_crc || crc_enabled_;
+  auto result = comm_.Read(address, should_verify_crc);
+  if (!result) {
+    return std::unexpected(replyError(result.error()));
+  }
+  noteReplies(1, should_verify_crc);
+  return *result;
+}
+
+template <typename CommType>
+DriverResult<uint32_t> Driver<CommType>::readRegisterFull(uint16_t address,
+                                                         bool verify_crc) noexcept {
+  const CallScope tle92466ed_call_scope(*this, "ReadRegister");
   if (!comm_.IsReady()) {
     return std::unexpected(DriverError::HardwareError);
   }
@@ -1722,23 +3551,25 @@ DriverResult<uint32_t> Driver<CommType>::ReadRegister(uint16_t address, bool ver
   // verify_crc=false allows override to disable CRC verification (e.g., during init)
   // verify_crc=true allows override to force CRC verification
   bool should_verify_crc = verify_crc ? true : crc_enabled_;
+  if (auto admitted = admitAccess(2); !admitted) {
+    return std::unexpected(admitted.error());
+  }
+
+  // Adaptive integrity: a qualified telemetry reply is verified later, in a batch
+  const bool defer = !verify_crc && crc_enabled_ && defersReply(address);
+  uint32_t reply = 0;
 
   // Use CommInterface Read function (handles frame construction, CRC, and transfer)
-  auto result = comm_.Read(address, should_verify_crc);
+  auto result = comm_.Read(address, should_verify_crc && !defer, defer ? &reply : nullptr);
   if (!result) {
-    // Map CommInterface error to driver error
-    switch (result.error()) {
-    case CommError::Timeout:
-      return std::unexpected(DriverError::TimeoutError);
-    case CommError::CRCError:
-      return std::unexpected(DriverError::CRCError);
-    case CommError::BusError:
-    case CommError::TransferError:
-      return std::unexpected(DriverError::HardwareError);
-    default:
-      return std::unexpected(DriverError::HardwareError);
-    }
+    return std::unexpected(replyError(result.error()));
+  }
+  if (defer) {
+    deferReply(reply);
+  } else {
+    noteReplies(1, should_verify_crc);
   }
+  recordRead(address, static_cast<uint16_t>(*result), false);
 
   return *result;
 }
@@ -1746,6 +3577,34 @@ DriverResult<uint32_t> Driver<CommType>::ReadRegister(uint16_t address, bool ver
 template <typename CommType>
 DriverResult<void> Driver<CommType>::WriteRegister(uint16_t address, uint16_t value, bool verify_crc,
                                          bool verify_write) noexcept {
+  if (!plainWrites()) [[unlikely]] {
+    return writeRegisterFull(address, value, verify_crc, verify_write);
+  }
+  if (!comm_.IsReady()) {
+    return std::unexpected(DriverError::HardwareError);
+  }
+
+  // Fast path: one frame, CRC checked inline
+  const bool should_verify_crc = verify_crc || crc_enabled_;
+  auto result = comm_.Write(address, value, should_verify_crc);
+  if (!result) {
+    return std::unexpected(replyError(result.error()));
+  }
+  noteReplies(1, should_verify_crc);
+
+  // Read back register to verify write succeeded (kept out of line)
+  if (verify_write) {
+    verifyWrite(address, value, verify_crc,
+                comm_.ArmDeadline(TimingRequirement::WriteReadback, Timing::WRITE_READBACK_US));
+  }
+  return {};
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::writeRegisterFull(uint16_t address, uint16_t value,
+                                                       bool verify_crc,
+                                                       bool verify_write) noexcept {
+  const CallScope tle92466ed_call_scope(*this, "WriteRegister");
   if (!comm_.IsReady()) {
     return std::unexpected(DriverError::HardwareError);
   }
@@ -1754,109 +3613,161 @@ DriverResult<void> Driver<CommType>::WriteRegister(uint16_t address, uint16_t va
   // verify_crc=false allows override to disable CRC verification (e.g., during init)
   // verify_crc=true allows override to force CRC verification
   bool should_verify_crc = verify_crc ? true : crc_enabled_;
+  if (pending_defaults_ != 0 && pendingDefaultsOf(address) != 0) [[unlikely]] {
+    // First write to a channel with lazy defaults: send them in the same burst
+    const RegisterWrite write{address, value};
+    if (auto result = writeBurst(std::span<const RegisterWrite>(&write, 1), should_verify_crc);
+        !result) {
+      return result;
+    }
+  } else {
+    if (auto admitted = admitAccess(2); !admitted) {
+      return std::unexpected(admitted.error());
+    }
 
-  // Use CommInterface Write function (handles frame construction, CRC, and transfer)
-  auto result = comm_.Write(address, value, should_verify_crc);
-  if (!result) {
-    // Map CommInterface error to driver error
-    switch (result.error()) {
-    case CommError::Timeout:
-      return std::unexpected(DriverError::TimeoutError);
-    case CommError::CRCError:
-      return std::unexpected(DriverError::CRCError);
-    case CommError::BusError:
-    case CommError::TransferError:
-      return std::unexpected(DriverError::HardwareError);
-    default:
-      return std::unexpected(DriverError::HardwareError);
+    // Use CommInterface Write function (handles frame construction, CRC, and transfer)
+    auto result = comm_.Write(address, value, should_verify_crc);
+    if (!result) {
+      return std::unexpected(replyError(result.error()));
     }
+    noteReplies(1, should_verify_crc);
+    recordWrite(address, value);
+    cancelPeakHoldOn(address);
   }
 
-  // Read back register to verify write succeeded
+  // Read back register to verify write succeeded (kept out of line)
   if (verify_write) {
-    // Small delay to ensure write has propagated (some registers may need time)
-    comm_.Delay(1); // 1ms delay
-
-    auto read_result = ReadRegister(address, verify_crc);
-    if (read_result) {
-      auto read_value = static_cast<uint16_t>(*read_result);
-
-      // Special handling for known problematic registers
-      // CH_CTRL (0x0000): Reads may return 0x0000 even after write due to device behavior
-      // GLOBAL_CONFIG (0x0002): Write-only, reads return default or previous value
-      // GLOBAL_DIAGx (0x0003-0x0005): Write-1-to-clear, reads return current fault state
-      bool known_issue = false;
-      const char* reason = nullptr;
-
-      if (address == CentralReg::CH_CTRL) {
-        // CH_CTRL is readable per datasheet, but may return 0x0000 in some cases
-        // This is a known device behavior - the write succeeds but read-back may not reflect it
-        // immediately We track CH_CTRL state in cache (ch_ctrl_cache_) for this reason
-        known_issue = true;
-        reason = "CH_CTRL may return 0x0000 on read (known device behavior, write succeeds)";
-      } else if (address == CentralReg::GLOBAL_CONFIG) {
-        known_issue = true;
-        reason = "GLOBAL_CONFIG is write-only, reads return default/previous value";
-      } else if (address == CentralReg::WD_RELOAD) {
-        // WD_RELOAD counter is constantly decremented by the watchdog timer
-        // Read value will be less than or equal to written value (may have decremented)
-        // This is expected behavior - the watchdog is actively counting down
-        known_issue = true;
-        reason =
-            "WD_RELOAD counter decrements continuously (read value <= written value is expected)";
-      } else if (address == CentralReg::GLOBAL_DIAG0 || address == CentralReg::GLOBAL_DIAG1 ||
-                 address == CentralReg::GLOBAL_DIAG2) {
-        // These are write-1-to-clear registers, reads return current fault state
-        // Mismatch is expected when clearing faults (writing 0xFFFF to clear, but read shows
-        // current faults)
-        known_issue = true;
-        reason = "GLOBAL_DIAGx are write-1-to-clear, reads return current fault state";
-      }
-
-      if (read_value != value) {
-        if (known_issue) {
-          comm_.Log(LogLevel::Debug, "TLE92466ED",
-                    "Write verification mismatch (expected): Address=0x%04X, Written=0x%04X, "
-                    "Read=0x%04X\n"
-                    "  %s\n",
-                    address, value, read_value, reason);
-        } else {
-          comm_.Log(LogLevel::Warn, "TLE92466ED",
-                    "Write verification failed: Address=0x%04X, Written=0x%04X, Read=0x%04X\n"
-                    "  (This may be normal for write-only or special registers)\n",
-                    address, value, read_value);
-        }
-      } else {
-        comm_.Log(LogLevel::Debug, "TLE92466ED", "Write verified: Address=0x%04X, Value=0x%04X\n",
-                  address, value);
-      }
-    } else {
-      // Read failed - this might be expected for write-only registers
-      comm_.Log(LogLevel::Debug, "TLE92466ED",
-                "Write verification read failed for address 0x%04X (may be write-only)\n", address);
-    }
+    verifyWrite(address, value, verify_crc,
+                comm_.ArmDeadline(TimingRequirement::WriteReadback, Timing::WRITE_READBACK_US));
   }
 
   return {};
 }
 
+template <typename CommType>
+void Driver<CommType>::verifyWrite(uint16_t address, uint16_t value, bool verify_crc,
+                                   const TimingDeadline& readback_deadline) noexcept {
+  // Ensure the write has propagated before reading back (some registers may need time)
+  (void)awaitDeadline(readback_deadline);
+
+  auto read_result = ReadRegister(address, verify_crc);
+  if (!read_result) [[unlikely]] {
+    // Read failed - this might be expected for write-only registers
+    comm_.Log(LogLevel::Debug, "TLE92466ED",
+              "Write verification read failed for address 0x%04X (may be write-only)\n", address);
+    return;
+  }
+
+  auto read_value = static_cast<uint16_t>(*read_result);
+  if (read_value != value) [[unlikely]] {
+    reportWriteMismatch(address, value, read_value);
+    return;
+  }
+  comm_.Log(LogLevel::Debug, "TLE92466ED", "Write verified: Address=0x%04X, Value=0x%04X\n",
+            address, value);
+}
+
 template <typename CommType>
 DriverResult<void> Driver<CommType>::ModifyRegister(uint16_t address, uint16_t mask,
                                           uint16_t value) noexcept {
-
-  // Read current value
-  auto read_result = ReadRegister(address);
-  if (!read_result) {
-    return std::unexpected(read_result.error());
+  TLE92466ED_API_ENTRY();
+
+  // A register with a pending lazy default is modified on top of that default
+  // (written by the WriteRegister() below), not on top of its reset value
+  uint16_t current = 0;
+  if (!pendingDefaultValue(address, current)) {
+    // Read current value
+    auto read_result = ReadRegister(address);
+    if (!read_result) {
+      return std::unexpected(read_result.error());
+    }
+    current = static_cast<uint16_t>(*read_result);
   }
 
   // Modify bits
-  uint16_t new_value = (*read_result & ~mask) | (value & mask);
+  uint16_t new_value = (current & ~mask) | (value & mask);
 
   // Write back
   return WriteRegister(address, new_value);
 }
 
+template <typename CommType>
+DriverResult<void> Driver<CommType>::ReadRegisters(std::span<const uint16_t> addresses,
+                                                   std::span<uint32_t> values,
+                                                   bool verify_crc) noexcept {
+  if (!plainReads()) [[unlikely]] {
+    return readRegistersFull(addresses, values, verify_crc);
+  }
+  if (!comm_.IsReady()) {
+    return std::unexpected(DriverError::HardwareError);
+  }
+
+  // Fast path: one burst, CRC checked inline
+  const bool should_verify_crc = verify_crc || crc_enabled_;
+  if (auto result = comm_.ReadMulti(addresses, values, should_verify_crc); !result) {
+    return std::unexpected(replyError(result.error()));
+  }
+  noteReplies(addresses.size(), should_verify_crc);
+  return {};
+}
+
+template <typename CommType>
+DriverResult<void> Driver<CommType>::readRegistersFull(std::span<const uint16_t> addresses,
+                                                       std::span<uint32_t> values,
+                                                       bool verify_crc) noexcept {
+  const CallScope tle92466ed_call_scope(*this, "ReadRegisters");
+  if (!comm_.IsReady()) {
+    return std::unexpected(DriverError::HardwareError);
+  }
+
+  bool should_verify_crc = verify_crc ? true : crc_enabled_;
+  if (auto admitted = admitAccess(addresses.size() + 1); !admitted) {
+    return std::unexpected(admitted.error());
+  }
+
+  // Adaptive integrity: qualified telemetry replies are verified later, in a batch
+  uint32_t deferred_mask = 0;
+  static_assert(CommType::MAX_BURST_REGISTERS <= 32, "deferred_mask holds one bit per register");
+  if (!verify_crc && crc_enabled_ && addresses.size() <= CommType::MAX_BURST_REGISTERS) {
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+      deferred_mask |= defersReply(addresses[i]) ? (1U << i) : 0U;
+    }
+  }
+
+  if (deferred_mask == 0) [[likely]] {
+    if (auto result = comm_.ReadMulti(addresses, values, should_verify_crc); !result) {
+      return std::unexpected(replyError(result.error()));
+    }
+    noteReplies(addresses.size(), should_verify_crc);
+  } else {
+    std::array<uint32_t, CommType::MAX_BURST_REGISTERS> raw{};
+    if (auto result = comm_.ReadMulti(addresses, values, false,
+                                      std::span<uint32_t>(raw.data(), addresses.size()));
+        !result) {
+      return std::unexpected(replyError(result.error()));
+    }
+    // All other replies are still verified before any value is returned
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+      SPIFrame frame{};
+      frame.word = raw[i];
+      if ((deferred_mask & (1U << i)) == 0 && !VerifyFrameCrc(frame)) {
+        return std::unexpected(replyError(CommError::CRCError));
+      }
+    }
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+      if ((deferred_mask & (1U << i)) != 0) {
+        deferReply(raw[i]);
+      } else {
+        noteReplies(1, true);
+      }
+    }
+  }
+  for (std::size_t i = 0; i < addresses.size(); ++i) {
+    recordRead(addresses[i], static_cast<uint16_t>(values[i]), true);
+  }
+  return {};
+}
+
 //==========================================================================
 // PRIVATE METHODS
 //==========================================================================
@@ -1971,8 +3882,26 @@ DriverResult<bool> Driver<CommType>::isChannelParallel(Channel channel) noexcept
 // GPIO CONTROL (Reset, Enable, Fault Status)
 //==========================================================================
 
+template <typename CommType>
+bool Driver<CommType>::isChannelParallelCached(Channel channel) const noexcept {
+  switch (channel) {
+  case Channel::CH0:
+  case Channel::CH3:
+    return (ch_ctrl_cache_ & CH_CTRL::CH_PAR_0_3) != 0;
+  case Channel::CH1:
+  case Channel::CH2:
+    return (ch_ctrl_cache_ & CH_CTRL::CH_PAR_1_2) != 0;
+  case Channel::CH4:
+  case Channel::CH5:
+    return (ch_ctrl_cache_ & CH_CTRL::CH_PAR_4_5) != 0;
+  default:
+    return false;
+  }
+}
+
 template <typename CommType>
 DriverResult<void> Driver<CommType>::SetReset(bool reset) noexcept {
+  TLE92466ED_API_ENTRY();
   comm_.Log(LogLevel::Info, "TLE92466ED", "Setting reset pin: %s\n",
             reset ? "LOW (in reset)" : "HIGH (released)");
   // RESN is active low: reset=true means hold in reset (GPIO LOW), reset=false means release (GPIO
@@ -1989,6 +3918,7 @@ DriverResult<void> Driver<CommType>::SetReset(bool reset) noexcept {
 
 template <typename CommType>
 DriverResult<void> Driver<CommType>::SetEnable(bool enable) noexcept {
+  TLE92466ED_API_ENTRY();
   comm_.Log(LogLevel::Info, "TLE92466ED", "Setting enable pin: %s\n",
             enable ? "HIGH (enabled)" : "LOW (disabled)");
   // EN is active high: enable=true means enable outputs (GPIO HIGH), enable=false means disable
@@ -2005,6 +3935,7 @@ DriverResult<void> Driver<CommType>::SetEnable(bool enable) noexcept {
 
 template <typename CommType>
 DriverResult<bool> Driver<CommType>::IsFault(bool print_faults) noexcept {
+  TLE92466ED_API_ENTRY();
   auto result = comm_.GetGpioPin(ControlPin::FAULTN);
   if (!result) {
     return std::unexpected(DriverError::HardwareError);
@@ -2094,6 +4025,59 @@ void Driver<CommType>::diagnoseClockConfiguration() noexcept {
             "═══════════════════════════════════════════════════════════\n");
 }
 
+template <typename CommType>
+void Driver<CommType>::reportWriteMismatch(uint16_t address, uint16_t written,
+                                           uint16_t read) noexcept {
+  // Special handling for known problematic registers
+  // CH_CTRL (0x0000): Reads may return 0x0000 even after write due to device behavior
+  // GLOBAL_CONFIG (0x0002): Write-only, reads return default or previous value
+  // GLOBAL_DIAGx (0x0003-0x0005): Write-1-to-clear, reads return current fault state
+  const char* reason = nullptr;
+
+  if (address == CentralReg::CH_CTRL) {
+    // CH_CTRL is readable per datasheet, but may return 0x0000 in some cases
+    // This is a known device behavior - the write succeeds but read-back may not reflect it
+    // immediately We track CH_CTRL state in cache (ch_ctrl_cache_) for this reason
+    reason = "CH_CTRL may return 0x0000 on read (known device behavior, write succeeds)";
+  } else if (address == CentralReg::GLOBAL_CONFIG) {
+    reason = "GLOBAL_CONFIG is write-only, reads return default/previous value";
+  } else if (address == CentralReg::WD_RELOAD) {
+    // WD_RELOAD counter is constantly decremented by the watchdog timer
+    // Read value will be less than or equal to written value (may have decremented)
+    // This is expected behavior - the watchdog is actively counting down
+    reason = "WD_RELOAD counter decrements continuously (read value <= written value is expected)";
+  } else if (address == CentralReg::GLOBAL_DIAG0 || address == CentralReg::GLOBAL_DIAG1 ||
+             address == CentralReg::GLOBAL_DIAG2) {
+    // These are write-1-to-clear registers, reads return current fault state
+    // Mismatch is expected when clearing faults (writing 0xFFFF to clear, but read shows
+    // current faults)
+    reason = "GLOBAL_DIAGx are write-1-to-clear, reads return current fault state";
+  }
+
+  if (reason != nullptr) {
+    comm_.Log(LogLevel::Debug, "TLE92466ED",
+              "Write verification mismatch (expected): Address=0x%04X, Written=0x%04X, "
+              "Read=0x%04X\n"
+              "  %s\n",
+              address, written, read, reason);
+  } else {
+    comm_.Log(LogLevel::Warn, "TLE92466ED",
+              "Write verification failed: Address=0x%04X, Written=0x%04X, Read=0x%04X\n"
+              "  (This may be normal for write-only or special registers)\n",
+              address, written, read);
+  }
+}
+
+#ifdef TLE92466ED_ENABLE_THERMAL
+template <typename CommType>
+void Driver<CommType>::reportThermalCap(Channel channel, uint16_t requested_ma,
+                                        uint16_t allowed_ma) noexcept {
+  comm_.Log(LogLevel::Warn, "TLE92466ED",
+            "Thermal derating: Channel=%s, Requested=%u mA, Capped=%u mA\n", ToString(channel),
+            requested_ma, allowed_ma);
+}
+#endif
+
 #ifdef TLE92466ED_HEADER_INCLUDED
 // Included from header - namespace is already open, don't close it
 #else
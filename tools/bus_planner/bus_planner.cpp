@@ -0,0 +1,382 @@
+/**
+ * @file bus_planner.cpp
+ * @brief Offline SPI bus capacity planner for TLE92466ED device/polling setups
+ *
+ * @details
+ * Answers "can one SPI bus carry N devices with these polling rates at this
+ * SCLK?" by calculation instead of trial and error.
+ *
+ * Frame costs are not estimated: every API named in the workload is executed
+ * once by the real driver against RegisterFileComm (after Init() and
+ * EnterMissionMode(), steady state) and the frames and chip-select
+ * transactions it clocks are counted. The bus time of a call is then
+ *
+ *   frames * (32 / SCLK + frame_gap_us) + transfers * transfer_overhead_us
+ *
+ * where the two overhead terms describe the platform's SPI stack (CS setup and
+ * hold, DMA or driver setup per transaction, gaps between words in a burst).
+ *
+ * Each task polls every device once per period. The bus is modelled as a
+ * non-preemptive resource scheduled rate-monotonic (higher rate first), so the
+ * worst-case latency of a task is its own cost, plus blocking by the longest
+ * lower-priority call, plus interference by higher-priority tasks
+ * (response-time analysis). The minimum viable SCLK is the lowest clock at
+ * which utilization stays below max_utilization and every task meets its
+ * deadline.
+ *
+ * Workload format (one statement per line, '#' starts a comment):
+ * @code
+ *   devices 4
+ *   sclk_hz 2000000            # clock to evaluate (default 1 MHz)
+ *   transfer_overhead_us 8     # per chip-select transaction
+ *   frame_gap_us 0.5           # per 32-bit frame, on top of 32 bit times
+ *   max_utilization 0.7        # headroom target for the minimum SCLK
+ *   task setpoints Flush 1000          # name, API, rate in Hz [, deadline in us]
+ *   task current GetAverageCurrent 500
+ *   task watchdog ReloadSpiWatchdog 50 2000
+ * @endcode
+ *
+ * Usage:
+ *   tle92466ed_bus_planner <workload.txt>
+ *   tle92466ed_bus_planner --list        (APIs and their measured frame costs)
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#define TLE92466ED_ENABLE_FEEDBACK
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "register_file_comm.hpp"
+#include "tle92466ed.hpp"
+
+using namespace tle92466ed;
+using tle92466ed::tools::RegisterFileComm;
+
+namespace {
+
+constexpr double MAX_SCLK_HZ = 10'000'000.0; ///< TLE92466ED SPI clock limit
+constexpr double MIN_SCLK_HZ = 100'000.0;    ///< Lowest clock searched
+
+using DriverType = Driver<RegisterFileComm>;
+
+/// One measurable driver API
+struct ApiEntry {
+  const char* name;
+  const char* description;
+  bool (*call)(DriverType& driver);
+};
+
+const ApiEntry API_TABLE[] = {
+    {"SetCurrentSetpoint", "one channel setpoint (write + readback)",
+     [](DriverType& d) { return d.SetCurrentSetpoint(Channel::CH0, 500).has_value(); }},
+    {"Flush", "six coalesced setpoints in one burst",
+     [](DriverType& d) {
+       if (!d.SetSetpointCoalescing(true)) {
+         return false;
+       }
+       for (uint8_t ch = 0; ch < 6; ++ch) {
+         (void)d.SetCurrentSetpoint(static_cast<Channel>(ch), 500);
+       }
+       const bool ok = d.Flush().has_value();
+       return d.SetSetpointCoalescing(false).has_value() && ok;
+     }},
+    {"GetAverageCurrent", "one channel average current",
+     [](DriverType& d) { return d.GetAverageCurrent(Channel::CH0).has_value(); }},
+    {"GetDutyCycle", "one channel duty cycle",
+     [](DriverType& d) { return d.GetDutyCycle(Channel::CH0).has_value(); }},
+    {"GetVbatVoltage", "VBAT feedback",
+     [](DriverType& d) { return d.GetVbatVoltage().has_value(); }},
+    {"GetDeviceStatus", "global status",
+     [](DriverType& d) { return d.GetDeviceStatus().has_value(); }},
+    {"GetChannelDiagnostics", "one channel diagnostics",
+     [](DriverType& d) { return d.GetChannelDiagnostics(Channel::CH0).has_value(); }},
+    {"HasAnyFault", "fault summary",
+     [](DriverType& d) { return d.HasAnyFault().has_value(); }},
+    {"GetAllFaults", "full fault report",
+     [](DriverType& d) { return d.GetAllFaults().has_value(); }},
+    {"ClearFaults", "clear all fault flags",
+     [](DriverType& d) { return d.ClearFaults().has_value(); }},
+    {"ReloadSpiWatchdog", "SPI watchdog reload",
+     [](DriverType& d) { return d.ReloadSpiWatchdog(1000).has_value(); }},
+    {"EnableChannels", "CH_CTRL update",
+     [](DriverType& d) { return d.EnableChannels(0x3F).has_value(); }},
+    {"CaptureTelemetry", "telemetry snapshot",
+     [](DriverType& d) {
+       TelemetrySample sample{};
+       return d.CaptureTelemetry(sample).has_value();
+     }},
+    {"PollFeedback", "feedback subscriptions on all six currents",
+     [](DriverType& d) {
+       for (uint8_t ch = 0; ch < 6; ++ch) {
+         FeedbackSubscription subscription{};
+         subscription.channel = static_cast<Channel>(ch);
+         subscription.deadband = 10;
+         (void)d.SubscribeFeedback(subscription);
+       }
+       const bool ok = d.PollFeedback().has_value();
+       for (uint8_t id = 0; id < 6; ++id) {
+         (void)d.UnsubscribeFeedback(id);
+       }
+       return ok;
+     }},
+};
+
+/// Bus cost of one call, measured on the real driver
+struct ApiCost {
+  std::size_t frames{0};
+  std::size_t transfers{0};
+};
+
+const ApiEntry* findApi(const std::string& name) {
+  for (const auto& api : API_TABLE) {
+    if (name == api.name) {
+      return &api;
+    }
+  }
+  return nullptr;
+}
+
+bool measure(const ApiEntry& api, ApiCost& cost) {
+  RegisterFileComm comm;
+  DriverType driver(comm);
+  if (!driver.Init() || !driver.EnterMissionMode()) {
+    return false;
+  }
+  // The first call may include one-time work; the second one is the steady state
+  if (!api.call(driver)) {
+    return false;
+  }
+  comm.ResetCounters();
+  if (!api.call(driver)) {
+    return false;
+  }
+  cost.frames = comm.Frames();
+  cost.transfers = comm.Transfers();
+  return true;
+}
+
+struct Platform {
+  unsigned devices{1};
+  double sclk_hz{1'000'000.0};
+  double transfer_overhead_us{0.0};
+  double frame_gap_us{0.0};
+  double max_utilization{1.0};
+};
+
+struct Task {
+  std::string name;
+  const ApiEntry* api{nullptr};
+  double rate_hz{0.0};
+  double deadline_us{0.0}; ///< Defaults to the period
+  ApiCost cost{};
+};
+
+struct TaskResult {
+  double call_us{0.0};     ///< One call on one device
+  double job_us{0.0};      ///< One period: all devices
+  double latency_us{0.0};  ///< Worst-case completion time of a job
+  bool schedulable{false}; ///< latency within deadline
+};
+
+[[noreturn]] void fail(int line, const std::string& message) {
+  std::fprintf(stderr, "line %d: %s\n", line, message.c_str());
+  std::exit(1);
+}
+
+double callUs(const ApiCost& cost, const Platform& platform, double sclk_hz) {
+  const double frame_us = (32.0 * 1e6 / sclk_hz) + platform.frame_gap_us;
+  return (static_cast<double>(cost.frames) * frame_us) +
+         (static_cast<double>(cost.transfers) * platform.transfer_overhead_us);
+}
+
+/// Utilization and rate-monotonic response times at a given clock
+double analyze(const std::vector<Task>& tasks, const Platform& platform, double sclk_hz,
+               std::vector<TaskResult>& results) {
+  results.assign(tasks.size(), TaskResult{});
+  double utilization = 0.0;
+  for (std::size_t i = 0; i < tasks.size(); ++i) {
+    results[i].call_us = callUs(tasks[i].cost, platform, sclk_hz);
+    results[i].job_us = results[i].call_us * platform.devices;
+    utilization += results[i].job_us * tasks[i].rate_hz / 1e6;
+  }
+
+  for (std::size_t i = 0; i < tasks.size(); ++i) {
+    // Non-preemptive: a call already on the bus finishes first
+    double blocking = 0.0;
+    for (std::size_t j = 0; j < tasks.size(); ++j) {
+      if (tasks[j].rate_hz < tasks[i].rate_hz) {
+        blocking = std::max(blocking, results[j].call_us);
+      }
+    }
+    double latency = results[i].job_us + blocking;
+    const double limit = tasks[i].deadline_us * 4.0;
+    for (int iteration = 0; iteration < 1000 && latency <= limit; ++iteration) {
+      double next = results[i].job_us + blocking;
+      for (std::size_t j = 0; j < tasks.size(); ++j) {
+        if (j != i && tasks[j].rate_hz > tasks[i].rate_hz) {
+          const double period_us = 1e6 / tasks[j].rate_hz;
+          next += std::ceil(latency / period_us) * results[j].job_us;
+        }
+      }
+      if (next == latency) {
+        break;
+      }
+      latency = next;
+    }
+    results[i].latency_us = latency;
+    results[i].schedulable = utilization <= 1.0 && latency <= tasks[i].deadline_us;
+  }
+  return utilization;
+}
+
+bool feasible(const std::vector<Task>& tasks, const Platform& platform, double sclk_hz) {
+  std::vector<TaskResult> results;
+  if (analyze(tasks, platform, sclk_hz, results) > platform.max_utilization) {
+    return false;
+  }
+  return std::all_of(results.begin(), results.end(),
+                     [](const TaskResult& result) { return result.schedulable; });
+}
+
+void parseWorkload(std::istream& input, Platform& platform, std::vector<Task>& tasks) {
+  std::string text;
+  for (int line = 1; std::getline(input, text); ++line) {
+    text = text.substr(0, text.find('#'));
+    std::istringstream in(text);
+    std::string keyword;
+    if (!(in >> keyword)) {
+      continue;
+    }
+    if (keyword == "devices") {
+      in >> platform.devices;
+    } else if (keyword == "sclk_hz") {
+      in >> platform.sclk_hz;
+    } else if (keyword == "transfer_overhead_us") {
+      in >> platform.transfer_overhead_us;
+    } else if (keyword == "frame_gap_us") {
+      in >> platform.frame_gap_us;
+    } else if (keyword == "max_utilization") {
+      in >> platform.max_utilization;
+    } else if (keyword == "task") {
+      Task task{};
+      std::string api;
+      in >> task.name >> api >> task.rate_hz;
+      task.api = findApi(api);
+      if (task.api == nullptr) {
+        fail(line, "unknown API '" + api + "' (see --list)");
+      }
+      if (task.rate_hz <= 0.0) {
+        fail(line, "task rate must be positive");
+      }
+      task.deadline_us = 1e6 / task.rate_hz;
+      in >> task.deadline_us;
+      tasks.push_back(task);
+      continue;
+    } else {
+      fail(line, "unknown statement '" + keyword + "'");
+    }
+    if (in.fail()) {
+      fail(line, "missing or invalid value");
+    }
+  }
+  if (platform.devices == 0 || platform.sclk_hz <= 0.0 || tasks.empty()) {
+    std::fprintf(stderr, "workload needs devices > 0, sclk_hz > 0 and at least one task\n");
+    std::exit(1);
+  }
+}
+
+int listApis() {
+  std::printf("%-22s %7s %10s  %s\n", "API", "frames", "transfers", "measured call");
+  for (const auto& api : API_TABLE) {
+    ApiCost cost{};
+    if (!measure(api, cost)) {
+      std::printf("%-22s  (measurement failed)\n", api.name);
+      continue;
+    }
+    std::printf("%-22s %7zu %10zu  %s\n", api.name, cost.frames, cost.transfers,
+                api.description);
+  }
+  return 0;
+}
+
+int plan(const char* path) {
+  std::ifstream input(path);
+  if (!input) {
+    std::fprintf(stderr, "cannot read %s\n", path);
+    return 1;
+  }
+  Platform platform{};
+  std::vector<Task> tasks;
+  parseWorkload(input, platform, tasks);
+
+  for (auto& task : tasks) {
+    if (!measure(*task.api, task.cost)) {
+      std::fprintf(stderr, "%s: measuring %s failed\n", task.name.c_str(), task.api->name);
+      return 1;
+    }
+  }
+  // Rate-monotonic priority order for the report
+  std::stable_sort(tasks.begin(), tasks.end(),
+                   [](const Task& a, const Task& b) { return a.rate_hz > b.rate_hz; });
+
+  std::vector<TaskResult> results;
+  const double utilization = analyze(tasks, platform, platform.sclk_hz, results);
+
+  std::printf("%u device(s), SCLK %.3f MHz, %.2f us/transfer, %.2f us/frame gap\n\n",
+              platform.devices, platform.sclk_hz / 1e6, platform.transfer_overhead_us,
+              platform.frame_gap_us);
+  std::printf("%-14s %-22s %9s %6s %4s %10s %10s %12s %12s\n", "task", "API", "rate[Hz]",
+              "frames", "CS", "call[us]", "load[%]", "latency[us]", "deadline[us]");
+  bool all_schedulable = true;
+  for (std::size_t i = 0; i < tasks.size(); ++i) {
+    const auto& task = tasks[i];
+    const auto& result = results[i];
+    all_schedulable = all_schedulable && result.schedulable;
+    std::printf("%-14s %-22s %9.1f %6zu %4zu %10.2f %10.2f %12.1f %12.1f%s\n", task.name.c_str(),
+                task.api->name, task.rate_hz, task.cost.frames, task.cost.transfers,
+                result.call_us, result.job_us * task.rate_hz / 1e4, result.latency_us,
+                task.deadline_us, result.schedulable ? "" : "  MISSED");
+  }
+  std::printf("\nbus utilization: %.1f %% (target <= %.1f %%)\n", utilization * 100.0,
+              platform.max_utilization * 100.0);
+
+  if (!feasible(tasks, platform, MAX_SCLK_HZ)) {
+    std::printf("minimum SCLK: not feasible at %.0f MHz; reduce rates, devices or overhead\n",
+                MAX_SCLK_HZ / 1e6);
+    return 2;
+  }
+  double low = MIN_SCLK_HZ;
+  double high = MAX_SCLK_HZ;
+  if (feasible(tasks, platform, low)) {
+    high = low;
+  }
+  while (high - low > 1000.0) {
+    const double mid = (low + high) / 2.0;
+    (feasible(tasks, platform, mid) ? high : low) = mid;
+  }
+  std::printf("minimum SCLK: %.3f MHz\n", high / 1e6);
+  return all_schedulable && utilization <= platform.max_utilization ? 0 : 2;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc == 2 && std::strcmp(argv[1], "--list") == 0) {
+    return listApis();
+  }
+  if (argc == 2) {
+    return plan(argv[1]);
+  }
+  std::fprintf(stderr, "usage: %s <workload.txt>\n       %s --list\n", argv[0], argv[0]);
+  return 1;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file register_file_comm.hpp
+ * @brief Host-side SpiInterface backed by an in-memory register file
+ *
+ * @details
+ * Emulates the TLE92466ED SPI protocol closely enough to run the real driver
+ * on a development host:
+ * - Replies are pipelined (the reply to frame k is returned with frame k+1)
+ * - Every reply is a valid 16-bit frame (reply mode 00B, status 0) with CRC
+ * - Writes land in a 7-bit address space, exactly as encoded by the write frame
+ * - ICVID returns a fixed, valid device ID so Init()/VerifyDevice() succeed
+ *
+ * Frame and transfer counters allow tools to measure bus cost per API call; the
+ * write journal records every write frame in bus order. An optional simulated
+ * clock (SetFrameTimeUs()) advances per frame and per Delay() and is exposed
+ * through the GetTimeUs() hook; while it is off, NowUs() stays 0 as with a
+ * platform without a time source.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_TOOLS_REGISTER_FILE_COMM_HPP
+#define TLE92466ED_TOOLS_REGISTER_FILE_COMM_HPP
+
+#include <array>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "tle92466ed.hpp"
+
+namespace tle92466ed::tools {
+
+/**
+ * @brief In-memory register file implementing the SpiInterface contract
+ */
+class RegisterFileComm : public SpiInterface<RegisterFileComm> {
+public:
+  using SpiInterface<RegisterFileComm>::Log;
+
+  static constexpr uint16_t DEFAULT_ICVID = 0x9201; ///< Value returned for ICVID reads
+  static constexpr std::size_t JOURNAL_CAPACITY = 1024; ///< Write frames kept by the journal
+
+  RegisterFileComm() noexcept {
+    SPIFrame idle{};
+    idle.rx_16bit.crc = CalculateFrameCrc(idle);
+    pending_reply_ = idle.word;
+  }
+
+  CommResult<void> Init() noexcept { return {}; }
+  CommResult<void> Deinit() noexcept { return {}; }
+
+  CommResult<uint32_t> Transfer32(uint32_t tx_data) noexcept {
+    ++frames_;
+    ++transfers_;
+    advanceClock(frame_time_us_);
+    return exchange(tx_data);
+  }
+
+  CommResult<void> TransferMulti(std::span<const uint32_t> tx_data,
+                                 std::span<uint32_t> rx_data) noexcept {
+    if (rx_data.size() < tx_data.size()) {
+      return std::unexpected(CommError::InvalidParameter);
+    }
+    ++transfers_;
+    frames_ += tx_data.size();
+    advanceClock(frame_time_us_ * tx_data.size());
+    for (std::size_t i = 0; i < tx_data.size(); ++i) {
+      rx_data[i] = exchange(tx_data[i]);
+    }
+    return {};
+  }
+
+  CommResult<void> Delay(uint32_t microseconds) noexcept {
+    advanceClock(microseconds);
+    return {};
+  }
+  CommResult<void> Configure(const SPIConfig& /*config*/) noexcept { return {}; }
+  bool IsReady() const noexcept { return true; }
+  CommError GetLastError() const noexcept { return CommError::None; }
+  CommResult<void> ClearErrors() noexcept { return {}; }
+  CommResult<void> SetGpioPin(ControlPin /*pin*/, ActiveLevel /*level*/) noexcept { return {}; }
+  CommResult<ActiveLevel> GetGpioPin(ControlPin /*pin*/) noexcept { return ActiveLevel::INACTIVE; }
+  void Log(LogLevel /*level*/, const char* /*tag*/, const char* /*format*/,
+           va_list /*args*/) noexcept {}
+
+  /**
+   * @brief Direct register access for test setup (7-bit write address space)
+   */
+  [[nodiscard]] uint16_t& Register(uint16_t address) noexcept { return regs_[address & 0x7FU]; }
+
+  /// Number of 32-bit frames clocked since the last ResetCounters()
+  [[nodiscard]] std::size_t Frames() const noexcept { return frames_; }
+  /// Number of chip-select transactions since the last ResetCounters()
+  [[nodiscard]] std::size_t Transfers() const noexcept { return transfers_; }
+
+  /// Write frames clocked since the last ClearJournal() (first JOURNAL_CAPACITY)
+  [[nodiscard]] std::span<const uint32_t> WriteJournal() const noexcept {
+    return {journal_.data(), journal_count_};
+  }
+
+  void ClearJournal() noexcept { journal_count_ = 0; }
+
+  /**
+   * @brief Start the simulated clock (0 stops it and NowUs() returns 0 again)
+   * @param frame_time_us Time charged per 32-bit frame
+   */
+  void SetFrameTimeUs(uint32_t frame_time_us) noexcept {
+    frame_time_us_ = frame_time_us;
+    clock_us_ = frame_time_us == 0 ? 0 : (clock_us_ == 0 ? 1 : clock_us_);
+  }
+
+  /// Simulated time in microseconds (0 while the clock is off)
+  [[nodiscard]] uint64_t GetTimeUs() const noexcept { return clock_us_; }
+
+  /// Advance the simulated clock, e.g. to model idle time between ticks
+  void AdvanceTimeUs(uint64_t microseconds) noexcept { advanceClock(microseconds); }
+
+  void ResetCounters() noexcept {
+    frames_ = 0;
+    transfers_ = 0;
+  }
+
+private:
+  void advanceClock(uint64_t microseconds) noexcept {
+    if (frame_time_us_ != 0) {
+      clock_us_ += microseconds;
+    }
+  }
+
+  uint32_t exchange(uint32_t tx_data) noexcept {
+    const uint32_t reply = pending_reply_;
+    SPIFrame tx{};
+    tx.word = tx_data;
+    uint16_t data = 0;
+    if (tx.tx_fields.rw != 0) {
+      if (journal_count_ < JOURNAL_CAPACITY) {
+        journal_[journal_count_++] = tx_data;
+      }
+      regs_[tx.tx_fields.address] = static_cast<uint16_t>(tx.tx_fields.data);
+      data = static_cast<uint16_t>(tx.tx_fields.data);
+    } else {
+      const auto address = static_cast<uint16_t>(tx.tx_fields.data);
+      data = address == CentralReg::ICVID ? DEFAULT_ICVID : regs_[address & 0x7FU];
+    }
+    SPIFrame rx{};
+    rx.rx_16bit.data = data;
+    rx.rx_16bit.rw_echo = tx.tx_fields.rw;
+    rx.rx_16bit.status = 0;
+    rx.rx_16bit.reply_mode = 0;
+    rx.rx_16bit.crc = CalculateFrameCrc(rx);
+    pending_reply_ = rx.word;
+    return reply;
+  }
+
+  std::array<uint16_t, 128> regs_{}; ///< Register file (7-bit address space)
+  uint32_t pending_reply_{0};        ///< Reply to the previous frame
+  std::size_t frames_{0};            ///< Frames clocked
+  std::size_t transfers_{0};         ///< CS transactions
+  std::array<uint32_t, JOURNAL_CAPACITY> journal_{}; ///< Write frames in bus order
+  std::size_t journal_count_{0};                     ///< Journal entries
+  uint32_t frame_time_us_{0};                        ///< Simulated time per frame (0 = off)
+  uint64_t clock_us_{0};                             ///< Simulated clock
+};
+
+} // namespace tle92466ed::tools
+
+#endif // TLE92466ED_TOOLS_REGISTER_FILE_COMM_HPP
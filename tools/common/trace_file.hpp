@@ -0,0 +1,198 @@
+/**
+ * @file trace_file.hpp
+ * @brief Host-side reader for serialized TLE92466ED driver traces
+ *
+ * @details
+ * Parses the binary form written by TraceBuffer::Serialize() (see
+ * tle92466ed_trace.hpp) into a name table and a record list. Traces recorded
+ * without a time source (all timestamps 0) are given synthetic timestamps
+ * 1 µs apart so that timelines stay readable.
+ *
+ * TraceReader streams the records of a file in fixed-size chunks instead, for
+ * tools that process many or large traces; it does not synthesize timestamps.
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef TLE92466ED_TOOLS_TRACE_FILE_HPP
+#define TLE92466ED_TOOLS_TRACE_FILE_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "tle92466ed_trace.hpp"
+
+namespace tle92466ed::tools {
+
+/**
+ * @brief Parsed trace
+ */
+struct TraceFile {
+  std::vector<std::string> names;   ///< API name table
+  std::vector<TraceRecord> records; ///< Records, oldest first
+  uint32_t dropped{0};              ///< Records lost to the ring before serialization
+  bool synthetic_time{false};       ///< Timestamps were generated (no time source)
+
+  /// Name of a record's call, or "-" outside any call
+  [[nodiscard]] const char* NameOf(const TraceRecord& record) const noexcept {
+    return record.name < names.size() ? names[record.name].c_str() : "-";
+  }
+};
+
+/**
+ * @brief Parse a serialized trace
+ * @return false (with error set) if the data is not a valid trace
+ */
+inline bool ParseTrace(std::span<const uint8_t> data, TraceFile& trace, std::string& error) {
+  TraceFileHeader header{};
+  if (data.size() < sizeof(header)) {
+    error = "too short";
+    return false;
+  }
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (header.magic != TraceFileHeader::MAGIC || header.version != TraceFileHeader::VERSION) {
+    error = "not a TLE92466ED trace (bad magic or version)";
+    return false;
+  }
+  const std::size_t names_size = header.name_count * TraceFileHeader::NAME_SIZE;
+  const std::size_t size =
+      sizeof(header) + names_size + (static_cast<std::size_t>(header.record_count) * 16U);
+  if (data.size() < size) {
+    error = "truncated";
+    return false;
+  }
+
+  trace = TraceFile{};
+  trace.dropped = header.dropped;
+  const uint8_t* pos = data.data() + sizeof(header);
+  for (std::size_t i = 0; i < header.name_count; ++i) {
+    const auto* name = reinterpret_cast<const char*>(pos);
+    trace.names.emplace_back(name, strnlen(name, TraceFileHeader::NAME_SIZE));
+    pos += TraceFileHeader::NAME_SIZE;
+  }
+  trace.records.resize(header.record_count);
+  std::memcpy(trace.records.data(), pos, header.record_count * sizeof(TraceRecord));
+
+  bool any_time = false;
+  for (const auto& record : trace.records) {
+    any_time = any_time || record.timestamp_us != 0;
+  }
+  if (!any_time) {
+    trace.synthetic_time = true;
+    for (std::size_t i = 0; i < trace.records.size(); ++i) {
+      trace.records[i].timestamp_us = i;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Read and parse a trace file
+ */
+inline bool ReadTraceFile(const std::string& path, TraceFile& trace, std::string& error) {
+  std::ifstream input(path, std::ios::binary);
+  if (!input) {
+    error = "cannot open";
+    return false;
+  }
+  const std::vector<char> bytes((std::istreambuf_iterator<char>(input)),
+                                std::istreambuf_iterator<char>());
+  return ParseTrace(
+      std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()),
+      trace, error);
+}
+
+/**
+ * @brief Streaming reader: header and names up front, records in chunks
+ */
+class TraceReader {
+public:
+  static constexpr std::size_t CHUNK_RECORDS = 4096; ///< Records read per file access
+
+  /**
+   * @brief Open a trace and read its header and name table
+   * @return false (with error set) if the file is missing or not a valid trace
+   */
+  bool Open(const std::string& path, std::string& error) {
+    input_.open(path, std::ios::binary);
+    if (!input_) {
+      error = "cannot open";
+      return false;
+    }
+    if (!input_.read(reinterpret_cast<char*>(&header_), sizeof(header_))) {
+      error = "too short";
+      return false;
+    }
+    if (header_.magic != TraceFileHeader::MAGIC || header_.version != TraceFileHeader::VERSION) {
+      error = "not a TLE92466ED trace (bad magic or version)";
+      return false;
+    }
+    names_.clear();
+    std::array<char, TraceFileHeader::NAME_SIZE> name{};
+    for (std::size_t i = 0; i < header_.name_count; ++i) {
+      if (!input_.read(name.data(), name.size())) {
+        error = "truncated";
+        return false;
+      }
+      names_.emplace_back(name.data(), strnlen(name.data(), name.size()));
+    }
+    remaining_ = header_.record_count;
+    position_ = 0;
+    size_ = 0;
+    return true;
+  }
+
+  /**
+   * @brief Next record, oldest first
+   * @return false at the end of the trace (or if the file is truncated)
+   */
+  bool Next(TraceRecord& record) {
+    if (position_ == size_ && !fill()) {
+      return false;
+    }
+    record = chunk_[position_++];
+    return true;
+  }
+
+  [[nodiscard]] const std::vector<std::string>& Names() const noexcept { return names_; }
+  [[nodiscard]] uint32_t RecordCount() const noexcept { return header_.record_count; }
+  [[nodiscard]] uint32_t Dropped() const noexcept { return header_.dropped; }
+
+  /// Name of a record's call, or "-" outside any call
+  [[nodiscard]] const char* NameOf(const TraceRecord& record) const noexcept {
+    return record.name < names_.size() ? names_[record.name].c_str() : "-";
+  }
+
+private:
+  bool fill() {
+    const std::size_t count = remaining_ < CHUNK_RECORDS ? remaining_ : CHUNK_RECORDS;
+    if (count == 0) {
+      return false;
+    }
+    input_.read(reinterpret_cast<char*>(chunk_.data()),
+                static_cast<std::streamsize>(count * sizeof(TraceRecord)));
+    size_ = static_cast<std::size_t>(input_.gcount()) / sizeof(TraceRecord);
+    remaining_ = size_ == count ? remaining_ - count : 0;
+    position_ = 0;
+    return size_ != 0;
+  }
+
+  std::ifstream input_;
+  TraceFileHeader header_{};
+  std::vector<std::string> names_;
+  std::array<TraceRecord, CHUNK_RECORDS> chunk_{};
+  std::size_t remaining_{0}; ///< Records not yet read from the file
+  std::size_t position_{0};  ///< Next record in chunk_
+  std::size_t size_{0};      ///< Records in chunk_
+};
+
+} // namespace tle92466ed::tools
+
+#endif // TLE92466ED_TOOLS_TRACE_FILE_HPP
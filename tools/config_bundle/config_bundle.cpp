@@ -0,0 +1,399 @@
+/**
+ * @file config_bundle.cpp
+ * @brief Generates and inspects TLE92466ED configuration bundles
+ *
+ * @details
+ * build: reads a text description of device variants, resolves every variant
+ *        by running the real driver (ConfigureGlobal(), SetParallelOperation(),
+ *        ConfigureChannel(), ConfigurePwmPeriod()) against RegisterFileComm,
+ *        and stores the resulting register writes as prebuilt SPI frames.
+ *        Only the final value of each register is kept, in the order of its
+ *        last write; fault-clear writes (GLOBAL_DIAG*, DIAG_ERR/WARN) are
+ *        actions, not configuration, and are dropped.
+ * dump:  validates a bundle with ConfigBundleView and lists its contents.
+ *
+ * Description format (one statement per line, '#' starts a comment):
+ * @code
+ *   revision 3
+ *   variant 0x0001 valve-12v
+ *   global crc=1 spi_wd=0 clk_wd=1 vio_5v=0 vbat_uv=6.0 vbat_ov=36.0 wd_reload=1000
+ *   parallel ch0_ch3
+ *   channel 0 mode=icc current_ma=800 slew=medium diag=80 ol=3 pwm_us=500
+ * @endcode
+ * Channel keys: mode (off|icc|spi|drv0|drv1|free), current_ma, slew
+ * (slow|medium|fast|fastest), diag (80|190|720|1250), ol, auto_limit_off,
+ * olsg_warning, deep_dither, dither_step, dither_steps, dither_flat, pwm_us.
+ *
+ * Usage:
+ *   tle92466ed_config_bundle build <description.txt> <bundle.bin>
+ *   tle92466ed_config_bundle dump <bundle.bin>
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "register_file_comm.hpp"
+#include "tle92466ed.hpp"
+
+using namespace tle92466ed;
+using tle92466ed::tools::RegisterFileComm;
+
+namespace {
+
+struct ChannelSpec {
+  Channel channel{Channel::CH0};
+  ChannelConfig config{};
+  std::optional<float> pwm_period_us;
+};
+
+struct VariantSpec {
+  uint32_t id{0};
+  std::string name;
+  std::optional<GlobalConfig> global;
+  std::vector<ParallelPair> parallel;
+  std::vector<ChannelSpec> channels;
+};
+
+struct BundleSpec {
+  uint32_t revision{0};
+  std::vector<VariantSpec> variants;
+};
+
+using KeyValues = std::map<std::string, std::string>;
+
+[[noreturn]] void fail(int line, const std::string& message) {
+  std::fprintf(stderr, "line %d: %s\n", line, message.c_str());
+  std::exit(1);
+}
+
+KeyValues parseKeyValues(std::istringstream& in, int line) {
+  KeyValues values;
+  std::string token;
+  while (in >> token) {
+    const auto eq = token.find('=');
+    if (eq == std::string::npos) {
+      fail(line, "expected key=value, got '" + token + "'");
+    }
+    values[token.substr(0, eq)] = token.substr(eq + 1);
+  }
+  return values;
+}
+
+template <typename T>
+T lookup(const std::map<std::string, T>& table, const std::string& key, int line) {
+  const auto it = table.find(key);
+  if (it == table.end()) {
+    fail(line, "unknown value '" + key + "'");
+  }
+  return it->second;
+}
+
+GlobalConfig parseGlobal(const KeyValues& values, int line) {
+  GlobalConfig config{};
+  for (const auto& [key, value] : values) {
+    if (key == "crc") {
+      config.crc_enabled = std::stoi(value) != 0;
+    } else if (key == "spi_wd") {
+      config.spi_watchdog_enabled = std::stoi(value) != 0;
+    } else if (key == "clk_wd") {
+      config.clock_watchdog_enabled = std::stoi(value) != 0;
+    } else if (key == "vio_5v") {
+      config.vio_5v = std::stoi(value) != 0;
+    } else if (key == "vbat_uv") {
+      config.vbat_uv_voltage = std::stof(value);
+    } else if (key == "vbat_ov") {
+      config.vbat_ov_voltage = std::stof(value);
+    } else if (key == "wd_reload") {
+      config.spi_watchdog_reload = static_cast<uint16_t>(std::stoul(value));
+    } else {
+      fail(line, "unknown global key '" + key + "'");
+    }
+  }
+  return config;
+}
+
+ChannelSpec parseChannel(int index, const KeyValues& values, int line) {
+  static const std::map<std::string, ChannelMode> MODES{
+      {"off", ChannelMode::OFF},
+      {"icc", ChannelMode::ICC},
+      {"spi", ChannelMode::DIRECT_DRIVE_SPI},
+      {"drv0", ChannelMode::DIRECT_DRIVE_DRV0},
+      {"drv1", ChannelMode::DIRECT_DRIVE_DRV1},
+      {"free", ChannelMode::FREE_RUN_MEAS}};
+  static const std::map<std::string, SlewRate> SLEW_RATES{{"slow", SlewRate::SLOW_1V0_US},
+                                                          {"medium", SlewRate::MEDIUM_2V5_US},
+                                                          {"fast", SlewRate::FAST_5V0_US},
+                                                          {"fastest", SlewRate::FASTEST_10V0_US}};
+  static const std::map<std::string, DiagCurrent> DIAG_CURRENTS{{"80", DiagCurrent::I_80UA},
+                                                                {"190", DiagCurrent::I_190UA},
+                                                                {"720", DiagCurrent::I_720UA},
+                                                                {"1250", DiagCurrent::I_1250UA}};
+  if (index < 0 || index > 5) {
+    fail(line, "channel must be 0-5");
+  }
+  ChannelSpec spec{};
+  spec.channel = static_cast<Channel>(index);
+  auto& config = spec.config;
+  for (const auto& [key, value] : values) {
+    if (key == "mode") {
+      config.mode = lookup(MODES, value, line);
+    } else if (key == "current_ma") {
+      config.current_setpoint_ma = static_cast<uint16_t>(std::stoul(value));
+    } else if (key == "slew") {
+      config.slew_rate = lookup(SLEW_RATES, value, line);
+    } else if (key == "diag") {
+      config.diag_current = lookup(DIAG_CURRENTS, value, line);
+    } else if (key == "ol") {
+      config.open_load_threshold = static_cast<uint8_t>(std::stoul(value));
+    } else if (key == "auto_limit_off") {
+      config.auto_limit_disabled = std::stoi(value) != 0;
+    } else if (key == "olsg_warning") {
+      config.olsg_warning_enabled = std::stoi(value) != 0;
+    } else if (key == "deep_dither") {
+      config.deep_dither_enabled = std::stoi(value) != 0;
+    } else if (key == "dither_step") {
+      config.dither_step_size = static_cast<uint16_t>(std::stoul(value));
+    } else if (key == "dither_steps") {
+      config.dither_steps = static_cast<uint8_t>(std::stoul(value));
+    } else if (key == "dither_flat") {
+      config.dither_flat = static_cast<uint8_t>(std::stoul(value));
+    } else if (key == "pwm_us") {
+      spec.pwm_period_us = std::stof(value);
+    } else {
+      fail(line, "unknown channel key '" + key + "'");
+    }
+  }
+  return spec;
+}
+
+BundleSpec parseDescription(std::istream& input) {
+  static const std::map<std::string, ParallelPair> PAIRS{{"ch0_ch3", ParallelPair::CH0_CH3},
+                                                         {"ch1_ch2", ParallelPair::CH1_CH2},
+                                                         {"ch4_ch5", ParallelPair::CH4_CH5}};
+  BundleSpec bundle{};
+  std::string text;
+  for (int line = 1; std::getline(input, text); ++line) {
+    text = text.substr(0, text.find('#'));
+    std::istringstream in(text);
+    std::string keyword;
+    if (!(in >> keyword)) {
+      continue;
+    }
+    if (keyword == "revision") {
+      in >> bundle.revision;
+      continue;
+    }
+    if (keyword == "variant") {
+      VariantSpec variant{};
+      std::string id;
+      in >> id >> variant.name;
+      variant.id = static_cast<uint32_t>(std::stoul(id, nullptr, 0));
+      if (variant.name.size() > ConfigBundleVariant::NAME_SIZE) {
+        fail(line, "variant name longer than 16 characters");
+      }
+      bundle.variants.push_back(variant);
+      continue;
+    }
+    if (bundle.variants.empty()) {
+      fail(line, "'" + keyword + "' before the first 'variant'");
+    }
+    auto& variant = bundle.variants.back();
+    if (keyword == "global") {
+      variant.global = parseGlobal(parseKeyValues(in, line), line);
+    } else if (keyword == "parallel") {
+      std::string pair;
+      in >> pair;
+      variant.parallel.push_back(lookup(PAIRS, pair, line));
+    } else if (keyword == "channel") {
+      int index = -1;
+      in >> index;
+      variant.channels.push_back(parseChannel(index, parseKeyValues(in, line), line));
+    } else {
+      fail(line, "unknown statement '" + keyword + "'");
+    }
+  }
+  return bundle;
+}
+
+bool isFaultClear(uint16_t address) {
+  return (address >= CentralReg::GLOBAL_DIAG0 && address <= CentralReg::GLOBAL_DIAG2) ||
+         (address >= CentralReg::DIAG_ERR_CHGR0 && address <= CentralReg::DIAG_WARN_CHGR5);
+}
+
+/// Run the variant through the driver and return its write frames (without the NOP)
+std::vector<uint32_t> resolveVariant(const VariantSpec& variant) {
+  RegisterFileComm comm;
+  Driver<RegisterFileComm> driver(comm);
+  if (!driver.Init()) {
+    std::fprintf(stderr, "%s: driver init failed\n", variant.name.c_str());
+    std::exit(1);
+  }
+  comm.ClearJournal();
+
+  const auto check = [&](const DriverResult<void>& result, const char* what) {
+    if (!result) {
+      std::fprintf(stderr, "%s: %s failed (error %u)\n", variant.name.c_str(), what,
+                   static_cast<unsigned>(result.error()));
+      std::exit(1);
+    }
+  };
+  if (variant.global) {
+    check(driver.ConfigureGlobal(*variant.global), "ConfigureGlobal");
+  }
+  for (const auto pair : variant.parallel) {
+    check(driver.SetParallelOperation(pair, true), "SetParallelOperation");
+  }
+  for (const auto& channel : variant.channels) {
+    check(driver.ConfigureChannel(channel.channel, channel.config), "ConfigureChannel");
+    if (channel.pwm_period_us) {
+      check(driver.ConfigurePwmPeriod(channel.channel, *channel.pwm_period_us),
+            "ConfigurePwmPeriod");
+    }
+  }
+
+  // Final value per register, ordered by its last write
+  std::vector<uint32_t> frames;
+  for (const uint32_t word : comm.WriteJournal()) {
+    SPIFrame frame{};
+    frame.word = word;
+    const auto address = static_cast<uint16_t>(frame.tx_fields.address);
+    if (isFaultClear(address)) {
+      continue;
+    }
+    std::erase_if(frames, [&](uint32_t previous) {
+      SPIFrame other{};
+      other.word = previous;
+      return other.tx_fields.address == address;
+    });
+    frames.push_back(word);
+  }
+  return frames;
+}
+
+template <typename T>
+void append(std::vector<uint8_t>& image, const T& value) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+  image.insert(image.end(), bytes, bytes + sizeof(T));
+}
+
+int build(const char* description_path, const char* output_path) {
+  std::ifstream input(description_path);
+  if (!input) {
+    std::fprintf(stderr, "cannot read %s\n", description_path);
+    return 1;
+  }
+  const BundleSpec spec = parseDescription(input);
+  if (spec.variants.empty()) {
+    std::fprintf(stderr, "no variants in %s\n", description_path);
+    return 1;
+  }
+
+  std::vector<std::vector<uint32_t>> variant_frames;
+  for (const auto& variant : spec.variants) {
+    auto frames = resolveVariant(variant);
+    frames.push_back(ConfigBundleView::NopFrame());
+    if (frames.size() > ConfigBundleView::MAX_FRAMES) {
+      std::fprintf(stderr, "%s: %zu frames exceed the burst limit of %zu\n",
+                   variant.name.c_str(), frames.size(), ConfigBundleView::MAX_FRAMES);
+      return 1;
+    }
+    variant_frames.push_back(std::move(frames));
+  }
+
+  ConfigBundleHeader header{};
+  header.variant_count = static_cast<uint16_t>(spec.variants.size());
+  header.revision = spec.revision;
+  std::vector<uint8_t> image;
+  append(image, header);
+
+  uint32_t offset = static_cast<uint32_t>(sizeof(ConfigBundleHeader) +
+                                          (spec.variants.size() * sizeof(ConfigBundleVariant)));
+  for (std::size_t i = 0; i < spec.variants.size(); ++i) {
+    ConfigBundleVariant entry{};
+    entry.id = spec.variants[i].id;
+    std::memcpy(entry.name, spec.variants[i].name.data(), spec.variants[i].name.size());
+    entry.frame_offset = offset;
+    entry.frame_count = static_cast<uint16_t>(variant_frames[i].size());
+    append(image, entry);
+    offset += static_cast<uint32_t>(variant_frames[i].size() * sizeof(uint32_t));
+  }
+  for (const auto& frames : variant_frames) {
+    for (const uint32_t word : frames) {
+      append(image, word);
+    }
+  }
+
+  header.total_size = static_cast<uint32_t>(image.size());
+  std::memcpy(image.data(), &header, sizeof(header));
+  header.crc = ConfigBundleView::ComputeCrc(image);
+  std::memcpy(image.data(), &header, sizeof(header));
+
+  std::ofstream output(output_path, std::ios::binary);
+  output.write(reinterpret_cast<const char*>(image.data()),
+               static_cast<std::streamsize>(image.size()));
+  if (!output) {
+    std::fprintf(stderr, "cannot write %s\n", output_path);
+    return 1;
+  }
+  std::printf("%s: revision %u, %zu variants, %zu bytes\n", output_path, spec.revision,
+              spec.variants.size(), image.size());
+  return 0;
+}
+
+int dump(const char* path) {
+  std::ifstream input(path, std::ios::binary);
+  const std::vector<char> bytes((std::istreambuf_iterator<char>(input)),
+                                std::istreambuf_iterator<char>());
+  // std::vector<uint32_t> storage keeps the image 4-byte aligned, as in flash
+  std::vector<uint32_t> storage((bytes.size() + 3) / 4);
+  std::memcpy(storage.data(), bytes.data(), bytes.size());
+
+  const ConfigBundleView bundle(
+      std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(storage.data()), bytes.size()));
+  if (!bundle.IsValid()) {
+    std::fprintf(stderr, "%s: not a valid bundle\n", path);
+    return 1;
+  }
+  std::printf("revision %u, %u variants\n", bundle.Revision(), bundle.VariantCount());
+  for (std::size_t i = 0; i < bundle.VariantCount(); ++i) {
+    const ConfigBundleVariant& variant = *bundle.GetVariant(i);
+    const auto frames = bundle.Frames(variant);
+    std::printf("variant 0x%08X %.16s: %zu writes\n", variant.id, variant.name,
+                frames.size() - 1);
+    for (std::size_t f = 0; f + 1 < frames.size(); ++f) {
+      SPIFrame frame{};
+      frame.word = frames[f];
+      std::printf("  [0x%02X] = 0x%04X\n", static_cast<unsigned>(frame.tx_fields.address),
+                  static_cast<unsigned>(frame.tx_fields.data));
+    }
+  }
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc == 4 && std::strcmp(argv[1], "build") == 0) {
+    return build(argv[2], argv[3]);
+  }
+  if (argc == 3 && std::strcmp(argv[1], "dump") == 0) {
+    return dump(argv[2]);
+  }
+  std::fprintf(stderr,
+               "usage: %s build <description.txt> <bundle.bin>\n"
+               "       %s dump <bundle.bin>\n",
+               argv[0], argv[0]);
+  return 1;
+}
@@ -0,0 +1,738 @@
+/**
+ * @file fleet_analytics.cpp
+ * @brief Fleet-wide fault precursor and valve wear analysis of TLE92466ED traces
+ *
+ * @details
+ * analyze:  decodes the register frames of many driver traces (the binary
+ *           format of TraceBuffer::Serialize(), one file per device) and
+ *           aggregates them across the fleet:
+ *           - fault flags, decoded with the driver's own GetAllFaults()
+ *             semantics (Driver::DecodeFaultRegister()), counted as rising
+ *             edges per flag
+ *           - fault precursors: whether a channel error was preceded by its
+ *             warning (OT warning -> over-temperature, OLSG warning -> open
+ *             load/short, current regulation warning -> over-current) and
+ *             with how much lead time
+ *           - valve wear: switching cycles per channel (CH_CTRL enable edges)
+ *             and duty-cycle drift at regulated current (mean FB_DC of the
+ *             last samples minus mean of the first samples); a coil that
+ *             needs more duty for the same current is heating or wearing
+ *           Files are processed in parallel by a work-stealing thread pool,
+ *           largest first. Each trace is streamed in fixed-size chunks
+ *           (TraceReader), so memory does not grow with trace size, and each
+ *           worker folds its devices into its own aggregate, merged at the end.
+ * generate: writes a synthetic fleet of traces (control loop with setpoint
+ *           writes, feedback reads, periodic fault scans and valve cycles;
+ *           some devices with warning-then-error faults and coil wear) as a
+ *           reference input.
+ *
+ * Usage:
+ *   tle92466ed_fleet_analytics analyze [-j threads] [-o devices.csv] <trace|dir>...
+ *   tle92466ed_fleet_analytics generate <dir> [devices] [ticks]
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#define TLE92466ED_TRACE_RECORDS 65536
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "register_file_comm.hpp"
+#include "tle92466ed.hpp"
+#include "tle92466ed_log.hpp"
+#include "trace_file.hpp"
+
+using namespace tle92466ed;
+using tle92466ed::tools::RegisterFileComm;
+using tle92466ed::tools::TraceReader;
+
+namespace {
+
+using Decoder = Driver<RegisterFileComm>;
+
+constexpr std::size_t CHANNELS = 6;
+constexpr std::size_t WEAR_WINDOW = 64; ///< FB_DC samples averaged at each end of a trace
+
+/// Names of FAULT_LOG_GLOBAL_FLAGS, same order
+constexpr std::array<const char*, FAULT_LOG_GLOBAL_FLAGS.size()> GLOBAL_FLAG_NAMES{
+    "any_fault",   "vbat_uv",    "vbat_ov",      "vio_uv",      "vio_ov",
+    "vdd_uv",      "vdd_ov",     "vr_iref_uv",   "vr_iref_ov",  "vdd2v5_uv",
+    "vdd2v5_ov",   "ref_uv",     "ref_ov",       "vpre_ov",     "hvadc_err",
+    "clock_fault", "spi_wd_error", "ot_error",   "ot_warning",  "por_event",
+    "reset_event", "reg_ecc_err", "otp_ecc_err", "otp_virgin",  "supply_nok_internal",
+    "supply_nok_external"};
+
+/// Names of FAULT_LOG_CHANNEL_FLAGS, same order
+constexpr std::array<const char*, FAULT_LOG_CHANNEL_FLAGS.size()> CHANNEL_FLAG_NAMES{
+    "has_fault",  "overcurrent", "short_to_ground",  "open_load",
+    "over_temperature", "open_load_short_ground", "ot_warning",
+    "current_regulation_warning", "pwm_regulation_warning", "olsg_warning"};
+
+/// Channel error flag and the warning that announces it
+struct PrecursorRule {
+  std::size_t error;   ///< Index into FAULT_LOG_CHANNEL_FLAGS
+  std::size_t warning; ///< Index into FAULT_LOG_CHANNEL_FLAGS
+};
+
+constexpr std::array<PrecursorRule, 5> PRECURSOR_RULES{{
+    {4, 6}, // over_temperature <- ot_warning
+    {5, 9}, // open_load_short_ground <- olsg_warning
+    {3, 9}, // open_load <- olsg_warning
+    {2, 9}, // short_to_ground <- olsg_warning
+    {1, 7}, // overcurrent <- current_regulation_warning
+}};
+
+//==============================================================================
+// WORK-STEALING POOL
+//==============================================================================
+
+/**
+ * @brief Fixed set of tasks run by workers that steal from each other
+ *
+ * @details
+ * Tasks are dealt round-robin into one deque per worker. A worker takes from
+ * the back of its own deque and, once that is empty, steals from the front of
+ * the others. Tasks do not spawn tasks, so a worker that finds every deque
+ * empty is done.
+ */
+class WorkStealingPool {
+public:
+  explicit WorkStealingPool(std::size_t workers) : queues_(workers) {}
+
+  /**
+   * @brief Run task(index, worker) for every index in order (dealt in this order)
+   */
+  template <typename Task>
+  void Run(const std::vector<std::size_t>& order, Task&& task) {
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      queues_[i % queues_.size()].tasks.push_back(order[i]);
+    }
+    std::vector<std::thread> threads;
+    for (std::size_t worker = 0; worker < queues_.size(); ++worker) {
+      threads.emplace_back([this, worker, &task] {
+        std::size_t index = 0;
+        while (take(worker, index)) {
+          task(index, worker);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  /// Tasks taken from another worker's deque
+  [[nodiscard]] std::size_t Steals() const noexcept { return steals_.load(); }
+
+private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::size_t> tasks;
+  };
+
+  bool take(std::size_t worker, std::size_t& index) {
+    {
+      Queue& own = queues_[worker];
+      const std::lock_guard<std::mutex> lock(own.mutex);
+      if (!own.tasks.empty()) {
+        index = own.tasks.back();
+        own.tasks.pop_back();
+        return true;
+      }
+    }
+    for (std::size_t offset = 1; offset < queues_.size(); ++offset) {
+      Queue& victim = queues_[(worker + offset) % queues_.size()];
+      const std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.tasks.empty()) {
+        index = victim.tasks.front();
+        victim.tasks.pop_front();
+        ++steals_;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::vector<Queue> queues_;
+  std::atomic<std::size_t> steals_{0};
+};
+
+//==============================================================================
+// PER-DEVICE ANALYSIS
+//==============================================================================
+
+/**
+ * @brief Result of one trace (one device)
+ */
+struct DeviceSummary {
+  std::string path;
+  std::string error;              ///< Non-empty if the trace could not be read
+  uint64_t records{0};
+  uint64_t read_frames{0};
+  uint64_t write_frames{0};
+  uint64_t api_calls{0};
+  uint32_t dropped{0};
+  uint64_t duration{0};           ///< Trace span (µs, or records without a time source)
+  bool has_time{false};
+  std::array<uint32_t, GLOBAL_FLAG_NAMES.size()> global_edges{};
+  std::array<std::array<uint32_t, CHANNEL_FLAG_NAMES.size()>, CHANNELS> channel_edges{};
+  uint32_t errors_with_precursor{0};
+  uint32_t errors_without_precursor{0};
+  uint64_t precursor_lead_sum{0}; ///< Sum of warning-to-error lead times
+  std::array<uint32_t, CHANNELS> switch_cycles{};
+  std::array<double, CHANNELS> duty_drift{}; ///< Last-window minus first-window mean FB_DC
+  std::array<double, CHANNELS> mean_current_ma{};
+  std::array<uint64_t, CHANNELS> current_samples{};
+};
+
+/// Channel and offset of a channel register address, false for central registers
+bool splitChannelRegister(uint16_t address, std::size_t& channel, uint16_t& offset) {
+  for (std::size_t ch = 0; ch < CHANNELS; ++ch) {
+    if ((address & 0x00F0U) == GetChannelBase(static_cast<Channel>(ch))) {
+      channel = ch;
+      offset = static_cast<uint16_t>(address & 0xFF0FU);
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Streaming analysis state of one trace
+ */
+class DeviceAnalyzer {
+public:
+  explicit DeviceAnalyzer(DeviceSummary& summary) : summary_(summary) {}
+
+  void Record(const TraceRecord& record) {
+    const uint64_t time = record.timestamp_us != 0 ? record.timestamp_us : summary_.records;
+    summary_.has_time = summary_.has_time || record.timestamp_us != 0;
+    if (summary_.records == 0) {
+      first_time_ = time;
+    }
+    summary_.duration = time - first_time_;
+    ++summary_.records;
+
+    switch (static_cast<TraceEventType>(record.type)) {
+    case TraceEventType::ApiBegin:
+      ++summary_.api_calls;
+      break;
+    case TraceEventType::ReadFrame:
+      ++summary_.read_frames;
+      onRead(record.address, static_cast<uint16_t>(record.value), time);
+      break;
+    case TraceEventType::WriteFrame:
+      ++summary_.write_frames;
+      onWrite(record.address, static_cast<uint16_t>(record.value));
+      break;
+    default:
+      break;
+    }
+  }
+
+  void Finish() {
+    for (std::size_t ch = 0; ch < CHANNELS; ++ch) {
+      const Wear& wear = wear_[ch];
+      if (wear.samples < 2 * WEAR_WINDOW) {
+        continue; // Windows would overlap
+      }
+      double last_sum = 0;
+      for (uint16_t duty : wear.last) {
+        last_sum += duty;
+      }
+      summary_.duty_drift[ch] =
+          (last_sum / WEAR_WINDOW) - (static_cast<double>(wear.first_sum) / WEAR_WINDOW);
+    }
+  }
+
+private:
+  struct Wear {
+    uint64_t samples{0};
+    uint64_t first_sum{0};
+    std::array<uint16_t, WEAR_WINDOW> last{};
+  };
+
+  void onWrite(uint16_t address, uint16_t value) {
+    if (address == CentralReg::CH_CTRL) {
+      const auto rising = static_cast<uint16_t>(value & ~enable_mask_ & CH_CTRL::ALL_CH_MASK);
+      for (std::size_t ch = 0; ch < CHANNELS; ++ch) {
+        summary_.switch_cycles[ch] += (rising >> ch) & 1U;
+      }
+      enable_mask_ = value & CH_CTRL::ALL_CH_MASK;
+    }
+  }
+
+  void onRead(uint16_t address, uint16_t value, uint64_t time) {
+    if (Decoder::DecodeFaultRegister(report_, address, value)) {
+      Decoder::SummarizeFaults(report_);
+      collectEdges(time);
+      return;
+    }
+    std::size_t ch = 0;
+    uint16_t offset = 0;
+    if (!splitChannelRegister(address, ch, offset)) {
+      return;
+    }
+    if (offset == ChannelReg::FB_I_AVG) {
+      const double current = SETPOINT::CalculateCurrent(value, false);
+      auto& samples = summary_.current_samples[ch];
+      ++samples;
+      summary_.mean_current_ma[ch] += (current - summary_.mean_current_ma[ch]) / samples;
+    } else if (offset == ChannelReg::FB_DC && (enable_mask_ & (1U << ch)) != 0) {
+      Wear& wear = wear_[ch];
+      if (wear.samples < WEAR_WINDOW) {
+        wear.first_sum += value;
+      }
+      wear.last[wear.samples % WEAR_WINDOW] = value;
+      ++wear.samples;
+    }
+  }
+
+  void collectEdges(uint64_t time) {
+    for (std::size_t flag = 0; flag < FAULT_LOG_GLOBAL_FLAGS.size(); ++flag) {
+      const bool now = report_.*FAULT_LOG_GLOBAL_FLAGS[flag];
+      summary_.global_edges[flag] += (now && !(previous_.*FAULT_LOG_GLOBAL_FLAGS[flag])) ? 1 : 0;
+    }
+    for (std::size_t ch = 0; ch < CHANNELS; ++ch) {
+      for (std::size_t flag = 0; flag < FAULT_LOG_CHANNEL_FLAGS.size(); ++flag) {
+        const bool now = report_.channels[ch].*FAULT_LOG_CHANNEL_FLAGS[flag];
+        const bool before = previous_.channels[ch].*FAULT_LOG_CHANNEL_FLAGS[flag];
+        if (!now || before) {
+          continue;
+        }
+        ++summary_.channel_edges[ch][flag];
+        last_rise_[ch][flag] = time + 1; // 0 = never
+        for (const auto& rule : PRECURSOR_RULES) {
+          if (rule.error != flag) {
+            continue;
+          }
+          const uint64_t warned = last_rise_[ch][rule.warning];
+          if (warned != 0 && warned <= time + 1) {
+            ++summary_.errors_with_precursor;
+            summary_.precursor_lead_sum += time + 1 - warned;
+          } else {
+            ++summary_.errors_without_precursor;
+          }
+        }
+      }
+    }
+    previous_ = report_;
+  }
+
+  DeviceSummary& summary_;
+  FaultReport report_{};   ///< Fault registers as last read
+  FaultReport previous_{}; ///< report_ before the last fault register read
+  std::array<std::array<uint64_t, CHANNEL_FLAG_NAMES.size()>, CHANNELS> last_rise_{};
+  std::array<Wear, CHANNELS> wear_{};
+  uint16_t enable_mask_{0};
+  uint64_t first_time_{0};
+};
+
+void analyzeDevice(DeviceSummary& summary) {
+  auto reader = std::make_unique<TraceReader>(); // Chunk buffer off the stack
+  if (!reader->Open(summary.path, summary.error)) {
+    return;
+  }
+  summary.dropped = reader->Dropped();
+  DeviceAnalyzer analyzer(summary);
+  TraceRecord record{};
+  while (reader->Next(record)) {
+    analyzer.Record(record);
+  }
+  if (summary.records != reader->RecordCount()) {
+    summary.error = "truncated";
+  }
+  analyzer.Finish();
+}
+
+//==============================================================================
+// FLEET AGGREGATE
+//==============================================================================
+
+/**
+ * @brief Sums over devices (one per worker, merged at the end)
+ */
+struct FleetAggregate {
+  uint64_t devices{0};
+  uint64_t failed{0};
+  uint64_t records{0};
+  uint64_t frames{0};
+  uint64_t api_calls{0};
+  uint64_t dropped{0};
+  uint64_t untimed{0}; ///< Devices traced without a time source (times are record counts)
+  std::array<uint64_t, GLOBAL_FLAG_NAMES.size()> global_edges{};
+  std::array<uint64_t, CHANNEL_FLAG_NAMES.size()> channel_edges{};
+  std::array<uint64_t, CHANNEL_FLAG_NAMES.size()> devices_with_flag{};
+  uint64_t errors_with_precursor{0};
+  uint64_t errors_without_precursor{0};
+  uint64_t precursor_lead_sum{0};
+  uint64_t switch_cycles{0};
+
+  void Add(const DeviceSummary& device) {
+    ++devices;
+    if (!device.error.empty()) {
+      ++failed;
+      return;
+    }
+    records += device.records;
+    frames += device.read_frames + device.write_frames;
+    api_calls += device.api_calls;
+    dropped += device.dropped;
+    untimed += device.has_time ? 0 : 1;
+    for (std::size_t flag = 0; flag < global_edges.size(); ++flag) {
+      global_edges[flag] += device.global_edges[flag];
+    }
+    for (std::size_t flag = 0; flag < channel_edges.size(); ++flag) {
+      uint64_t edges = 0;
+      for (const auto& channel : device.channel_edges) {
+        edges += channel[flag];
+      }
+      channel_edges[flag] += edges;
+      devices_with_flag[flag] += edges != 0 ? 1 : 0;
+    }
+    errors_with_precursor += device.errors_with_precursor;
+    errors_without_precursor += device.errors_without_precursor;
+    precursor_lead_sum += device.precursor_lead_sum;
+    for (uint32_t cycles : device.switch_cycles) {
+      switch_cycles += cycles;
+    }
+  }
+
+  void Merge(const FleetAggregate& other) {
+    devices += other.devices;
+    failed += other.failed;
+    records += other.records;
+    frames += other.frames;
+    api_calls += other.api_calls;
+    dropped += other.dropped;
+    untimed += other.untimed;
+    for (std::size_t flag = 0; flag < global_edges.size(); ++flag) {
+      global_edges[flag] += other.global_edges[flag];
+    }
+    for (std::size_t flag = 0; flag < channel_edges.size(); ++flag) {
+      channel_edges[flag] += other.channel_edges[flag];
+      devices_with_flag[flag] += other.devices_with_flag[flag];
+    }
+    errors_with_precursor += other.errors_with_precursor;
+    errors_without_precursor += other.errors_without_precursor;
+    precursor_lead_sum += other.precursor_lead_sum;
+    switch_cycles += other.switch_cycles;
+  }
+};
+
+void collectTraces(const std::filesystem::path& path, std::vector<std::string>& files) {
+  std::error_code error;
+  if (std::filesystem::is_directory(path, error)) {
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(path, error)) {
+      if (entry.is_regular_file() && entry.path().extension() == ".bin") {
+        files.push_back(entry.path().string());
+      }
+    }
+  } else {
+    files.push_back(path.string());
+  }
+}
+
+bool writeCsv(const char* path, const std::vector<DeviceSummary>& devices) {
+  std::FILE* out = std::fopen(path, "w");
+  if (out == nullptr) {
+    return false;
+  }
+  std::fprintf(out, "path,records,frames,api_calls,dropped,faults,errors_with_precursor,"
+                    "errors_without_precursor");
+  for (std::size_t ch = 0; ch < CHANNELS; ++ch) {
+    std::fprintf(out, ",ch%zu_cycles,ch%zu_duty_drift,ch%zu_mean_ma", ch, ch, ch);
+  }
+  std::fprintf(out, "\n");
+  for (const auto& device : devices) {
+    if (!device.error.empty()) {
+      continue;
+    }
+    std::fprintf(out, "%s,%llu,%llu,%llu,%u,%u,%u,%u", device.path.c_str(),
+                 static_cast<unsigned long long>(device.records),
+                 static_cast<unsigned long long>(device.read_frames + device.write_frames),
+                 static_cast<unsigned long long>(device.api_calls), device.dropped,
+                 device.global_edges[0], device.errors_with_precursor,
+                 device.errors_without_precursor);
+    for (std::size_t ch = 0; ch < CHANNELS; ++ch) {
+      std::fprintf(out, ",%u,%.1f,%.0f", device.switch_cycles[ch], device.duty_drift[ch],
+                   device.mean_current_ma[ch]);
+    }
+    std::fprintf(out, "\n");
+  }
+  return std::fclose(out) == 0;
+}
+
+int analyze(int argc, char** argv) {
+  std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+  const char* csv_path = nullptr;
+  std::vector<std::string> files;
+  for (int i = 0; i < argc; ++i) {
+    if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      threads = std::max(1, std::atoi(argv[++i]));
+    } else if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      csv_path = argv[++i];
+    } else {
+      collectTraces(argv[i], files);
+    }
+  }
+  if (files.empty()) {
+    std::fprintf(stderr, "no traces\n");
+    return 1;
+  }
+  threads = std::min(threads, files.size());
+
+  // Largest traces first, so the tail of the run is made of small tasks
+  std::vector<DeviceSummary> devices(files.size());
+  std::vector<std::pair<uintmax_t, std::size_t>> sized;
+  uintmax_t total_bytes = 0;
+  for (std::size_t i = 0; i < files.size(); ++i) {
+    devices[i].path = files[i];
+    std::error_code error;
+    const uintmax_t size = std::filesystem::file_size(files[i], error);
+    sized.emplace_back(error ? 0 : size, i);
+    total_bytes += error ? 0 : size;
+  }
+  std::sort(sized.begin(), sized.end(), [](const auto& a, const auto& b) { return a > b; });
+  std::vector<std::size_t> order;
+  for (const auto& entry : sized) {
+    order.push_back(entry.second);
+  }
+
+  std::vector<FleetAggregate> partial(threads);
+  WorkStealingPool pool(threads);
+  const auto start = std::chrono::steady_clock::now();
+  pool.Run(order, [&](std::size_t index, std::size_t worker) {
+    analyzeDevice(devices[index]);
+    partial[worker].Add(devices[index]);
+  });
+  const double seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  FleetAggregate fleet{};
+  for (const auto& aggregate : partial) {
+    fleet.Merge(aggregate);
+  }
+
+  std::printf("devices: %llu (%llu unreadable), %llu records, %llu frames, %llu API calls, "
+              "%llu dropped\n",
+              static_cast<unsigned long long>(fleet.devices),
+              static_cast<unsigned long long>(fleet.failed),
+              static_cast<unsigned long long>(fleet.records),
+              static_cast<unsigned long long>(fleet.frames),
+              static_cast<unsigned long long>(fleet.api_calls),
+              static_cast<unsigned long long>(fleet.dropped));
+  std::printf("throughput: %.3f s on %zu threads (%zu steals), %.1f Mrecords/s, %.1f MB/s\n",
+              seconds, threads, pool.Steals(), static_cast<double>(fleet.records) / seconds / 1e6,
+              static_cast<double>(total_bytes) / seconds / 1e6);
+
+  std::printf("\nfault flag rising edges (global):\n");
+  for (std::size_t flag = 1; flag < fleet.global_edges.size(); ++flag) {
+    if (fleet.global_edges[flag] != 0) {
+      std::printf("  %-28s %8llu\n", GLOBAL_FLAG_NAMES[flag],
+                  static_cast<unsigned long long>(fleet.global_edges[flag]));
+    }
+  }
+  std::printf("fault flag rising edges (channels):        edges  devices\n");
+  for (std::size_t flag = 1; flag < fleet.channel_edges.size(); ++flag) {
+    if (fleet.channel_edges[flag] != 0) {
+      std::printf("  %-28s %8llu %8llu\n", CHANNEL_FLAG_NAMES[flag],
+                  static_cast<unsigned long long>(fleet.channel_edges[flag]),
+                  static_cast<unsigned long long>(fleet.devices_with_flag[flag]));
+    }
+  }
+  const uint64_t errors = fleet.errors_with_precursor + fleet.errors_without_precursor;
+  if (errors != 0) {
+    std::printf("precursors: %llu of %llu channel errors preceded by their warning",
+                static_cast<unsigned long long>(fleet.errors_with_precursor),
+                static_cast<unsigned long long>(errors));
+    if (fleet.errors_with_precursor != 0) {
+      std::printf(", mean lead %.0f %s",
+                  static_cast<double>(fleet.precursor_lead_sum) /
+                      static_cast<double>(fleet.errors_with_precursor),
+                  fleet.untimed == 0 ? "us" : "(records on untimed traces)");
+    }
+    std::printf("\n");
+  }
+
+  // Wear ranking: channels with the largest duty-cycle drift
+  struct WearEntry {
+    double drift;
+    std::size_t device;
+    std::size_t channel;
+  };
+  std::vector<WearEntry> wear;
+  for (std::size_t i = 0; i < devices.size(); ++i) {
+    for (std::size_t ch = 0; ch < CHANNELS; ++ch) {
+      if (devices[i].error.empty() && devices[i].duty_drift[ch] > 0) {
+        wear.push_back({devices[i].duty_drift[ch], i, ch});
+      }
+    }
+  }
+  std::sort(wear.begin(), wear.end(),
+            [](const WearEntry& a, const WearEntry& b) { return a.drift > b.drift; });
+  std::printf("\nvalve wear: %llu switching cycles; largest FB_DC drift:\n",
+              static_cast<unsigned long long>(fleet.switch_cycles));
+  for (std::size_t i = 0; i < wear.size() && i < 10; ++i) {
+    const DeviceSummary& device = devices[wear[i].device];
+    std::printf("  %+8.1f  CH%zu  %u cycles  %s\n", wear[i].drift, wear[i].channel,
+                device.switch_cycles[wear[i].channel], device.path.c_str());
+  }
+
+  for (const auto& device : devices) {
+    if (!device.error.empty()) {
+      std::fprintf(stderr, "%s: %s\n", device.path.c_str(), device.error.c_str());
+    }
+  }
+  if (csv_path != nullptr && !writeCsv(csv_path, devices)) {
+    std::fprintf(stderr, "cannot write %s\n", csv_path);
+    return 1;
+  }
+  return fleet.failed == 0 ? 0 : 2;
+}
+
+//==============================================================================
+// SYNTHETIC FLEET
+//==============================================================================
+
+// API names must outlive the TraceBuffer (it keeps the pointers)
+constexpr const char* API_SETPOINT = "SetCurrentSetpoint";
+constexpr const char* API_CURRENT = "GetAverageCurrent";
+constexpr const char* API_DUTY = "GetDutyCycle";
+constexpr const char* API_FAULTS = "GetAllFaults";
+constexpr const char* API_ENABLE = "EnableChannels";
+
+/**
+ * @brief Small deterministic generator (xorshift) so fleets are reproducible
+ */
+struct Random {
+  uint32_t state;
+  uint32_t Next() noexcept {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+};
+
+bool generateDevice(const std::string& path, uint32_t device, int ticks) {
+  auto trace = std::make_unique<TraceBuffer>();
+  Random random{0x9E3779B9U ^ (device * 2654435761U)};
+  const uint8_t channels = static_cast<uint8_t>(1U + (random.Next() % CH_CTRL::ALL_CH_MASK));
+  // Every 4th device develops an over-temperature on one channel, with or without a warning
+  const bool overheats = device % 4 == 1;
+  const bool warns_first = device % 8 == 1;
+  const auto hot_channel = static_cast<std::size_t>(random.Next() % CHANNELS);
+  const double wear_per_tick = device % 5 == 0 ? 0.02 : 0.0;
+  const int fault_tick = ticks / 2 + static_cast<int>(random.Next() % (ticks / 4 + 1));
+
+  uint64_t now = 1;
+  auto frame = [&](bool write, uint16_t address, uint16_t value) {
+    now += 8; // 32 bits at 4 MHz
+    trace->Frame(write, address, value, now);
+  };
+
+  uint16_t enable = 0;
+  for (int tick = 0; tick < ticks; ++tick) {
+    now += 1000; // 1 kHz control loop
+    if (tick % 250 == 0) {
+      // Valve cycle: all channels off, then the used ones on again
+      trace->Begin(API_ENABLE, now);
+      frame(true, CentralReg::CH_CTRL, CH_CTRL::OP_MODE);
+      enable = static_cast<uint16_t>(CH_CTRL::OP_MODE | channels);
+      frame(true, CentralReg::CH_CTRL, enable);
+      trace->End(now);
+    }
+    for (std::size_t ch = 0; ch < CHANNELS; ++ch) {
+      if ((channels & (1U << ch)) == 0) {
+        continue;
+      }
+      const auto channel = static_cast<Channel>(ch);
+      const uint16_t base = GetChannelBase(channel);
+      const auto setpoint = static_cast<uint16_t>(0x2000 + ((tick + ch * 7) % 64) * 16);
+      trace->Begin(API_SETPOINT, now);
+      frame(true, base + ChannelReg::SETPOINT, setpoint);
+      trace->End(now);
+      trace->Begin(API_CURRENT, now);
+      frame(false, base + ChannelReg::FB_I_AVG, static_cast<uint16_t>(setpoint - 8 +
+                                                                      random.Next() % 16));
+      trace->End(now);
+      const double duty = 20000.0 + (wear_per_tick * tick * (1 + ch)) + (random.Next() % 200);
+      trace->Begin(API_DUTY, now);
+      frame(false, base + ChannelReg::FB_DC, static_cast<uint16_t>(duty));
+      trace->End(now);
+    }
+    if (tick % 20 == 0) {
+      trace->Begin(API_FAULTS, now);
+      frame(false, CentralReg::GLOBAL_DIAG0, 0);
+      frame(false, CentralReg::GLOBAL_DIAG1, 0);
+      frame(false, CentralReg::GLOBAL_DIAG2, 0);
+      frame(false, CentralReg::FB_STAT, 0);
+      for (std::size_t ch = 0; ch < CHANNELS; ++ch) {
+        uint16_t err = 0;
+        uint16_t warn = 0;
+        if (overheats && ch == hot_channel) {
+          warn = (warns_first && tick >= fault_tick - 200) ? 0x0001 : 0; // OT warning
+          err = tick >= fault_tick ? 0x0008 : 0;                          // OT error
+        }
+        frame(false, static_cast<uint16_t>(CentralReg::DIAG_ERR_CHGR0 + ch), err);
+        frame(false, static_cast<uint16_t>(CentralReg::DIAG_WARN_CHGR0 + ch), warn);
+      }
+      trace->End(now);
+    }
+  }
+
+  std::vector<uint8_t> image(trace->SerializedSize());
+  const std::size_t size = trace->Serialize(image);
+  std::ofstream output(path, std::ios::binary);
+  output.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(size));
+  return static_cast<bool>(output);
+}
+
+int generate(const char* directory, int devices, int ticks) {
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+  for (int device = 0; device < devices; ++device) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "device_%04d.bin", device);
+    const std::string path = (std::filesystem::path(directory) / name).string();
+    if (!generateDevice(path, static_cast<uint32_t>(device), ticks)) {
+      std::fprintf(stderr, "cannot write %s\n", path.c_str());
+      return 1;
+    }
+  }
+  std::printf("%s: %d device traces, %d ticks each\n", directory, devices, ticks);
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc >= 3 && std::strcmp(argv[1], "analyze") == 0) {
+    return analyze(argc - 2, argv + 2);
+  }
+  if (argc >= 3 && argc <= 5 && std::strcmp(argv[1], "generate") == 0) {
+    return generate(argv[2], argc >= 4 ? std::atoi(argv[3]) : 200,
+                    argc == 5 ? std::atoi(argv[4]) : 1000);
+  }
+  std::fprintf(stderr,
+               "usage: %s analyze [-j threads] [-o devices.csv] <trace|dir>...\n"
+               "       %s generate <dir> [devices] [ticks]\n",
+               argv[0], argv[0]);
+  return 1;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file trace_convert.cpp
+ * @brief Converts TLE92466ED driver traces to Chrome trace-event JSON
+ *
+ * @details
+ * convert: reads a trace written by TraceBuffer::Serialize() (firmware dump or
+ *          host run) and writes Chrome trace-event JSON, which opens in
+ *          Perfetto UI (ui.perfetto.dev) and chrome://tracing:
+ *          - public calls become nested B/E duration events
+ *          - register frames become instant events ("R 0x0042", "W 0x0042")
+ *            with address, value and calling API as arguments
+ *          - timing waits become complete (X) events
+ *          Spans cut off by the ring (end without begin) are skipped and spans
+ *          still open at the end of the trace are closed at its last record.
+ * record:  runs a short control-loop session (Init, channel setup, setpoint and
+ *          feedback ticks, periodic diagnostics) of the real driver against
+ *          RegisterFileComm with a simulated 8 µs frame clock and writes its
+ *          trace, as a reference input for the converter and analysis tools.
+ *
+ * Usage:
+ *   tle92466ed_trace_convert convert <trace.bin> <trace.json>
+ *   tle92466ed_trace_convert record <trace.bin> [ticks]
+ *
+ * @copyright
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#define TLE92466ED_ENABLE_TRACE
+#define TLE92466ED_TRACE_RECORDS 8192
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "register_file_comm.hpp"
+#include "tle92466ed.hpp"
+#include "trace_file.hpp"
+
+using namespace tle92466ed;
+using tle92466ed::tools::RegisterFileComm;
+using tle92466ed::tools::TraceFile;
+
+namespace {
+
+constexpr const char* REQUIREMENT_NAMES[] = {"write readback", "reset pulse", "reset recovery",
+                                             "settle", "transition"};
+
+const char* requirementName(uint16_t requirement) {
+  return requirement < std::size(REQUIREMENT_NAMES) ? REQUIREMENT_NAMES[requirement] : "wait";
+}
+
+int convert(const char* input_path, const char* output_path) {
+  TraceFile trace;
+  std::string error;
+  if (!tools::ReadTraceFile(input_path, trace, error)) {
+    std::fprintf(stderr, "%s: %s\n", input_path, error.c_str());
+    return 1;
+  }
+
+  std::FILE* out = std::fopen(output_path, "w");
+  if (out == nullptr) {
+    std::fprintf(stderr, "cannot write %s\n", output_path);
+    return 1;
+  }
+  std::fprintf(out, "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_records\":%u,"
+                    "\"synthetic_time\":%s},\"traceEvents\":[\n",
+               trace.dropped, trace.synthetic_time ? "true" : "false");
+  std::fprintf(out, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+                    "\"args\":{\"name\":\"TLE92466ED\"}}");
+
+  std::vector<const char*> open_spans;
+  uint64_t last_us = 0;
+  for (const auto& record : trace.records) {
+    const auto ts = static_cast<unsigned long long>(record.timestamp_us);
+    last_us = record.timestamp_us;
+    switch (static_cast<TraceEventType>(record.type)) {
+    case TraceEventType::ApiBegin:
+      open_spans.push_back(trace.NameOf(record));
+      std::fprintf(out, ",\n{\"name\":\"%s\",\"cat\":\"api\",\"ph\":\"B\",\"ts\":%llu,"
+                        "\"pid\":1,\"tid\":1}",
+                   trace.NameOf(record), ts);
+      break;
+    case TraceEventType::ApiEnd:
+      if (open_spans.empty()) {
+        break; // Begin was overwritten by the ring
+      }
+      open_spans.pop_back();
+      std::fprintf(out, ",\n{\"ph\":\"E\",\"ts\":%llu,\"pid\":1,\"tid\":1}", ts);
+      break;
+    case TraceEventType::ReadFrame:
+    case TraceEventType::WriteFrame: {
+      const bool write = static_cast<TraceEventType>(record.type) == TraceEventType::WriteFrame;
+      std::fprintf(out, ",\n{\"name\":\"%c 0x%04X\",\"cat\":\"spi\",\"ph\":\"i\",\"s\":\"t\","
+                        "\"ts\":%llu,\"pid\":1,\"tid\":1,\"args\":{\"address\":\"0x%04X\","
+                        "\"value\":\"0x%04X\",\"api\":\"%s\"}}",
+                   write ? 'W' : 'R', record.address, ts, record.address, record.value,
+                   trace.NameOf(record));
+      break;
+    }
+    case TraceEventType::Delay:
+      std::fprintf(out, ",\n{\"name\":\"%s\",\"cat\":\"delay\",\"ph\":\"X\",\"ts\":%llu,"
+                        "\"dur\":%u,\"pid\":1,\"tid\":1,\"args\":{\"api\":\"%s\"}}",
+                   requirementName(record.address), ts, record.value, trace.NameOf(record));
+      last_us = record.timestamp_us + record.value;
+      break;
+    default:
+      break;
+    }
+  }
+  for (; !open_spans.empty(); open_spans.pop_back()) {
+    std::fprintf(out, ",\n{\"ph\":\"E\",\"ts\":%llu,\"pid\":1,\"tid\":1}",
+                 static_cast<unsigned long long>(last_us));
+  }
+  std::fprintf(out, "\n]}\n");
+  const bool ok = std::fclose(out) == 0;
+  if (!ok) {
+    std::fprintf(stderr, "cannot write %s\n", output_path);
+    return 1;
+  }
+  std::printf("%s: %zu records, %zu APIs, %u dropped%s\n", output_path, trace.records.size(),
+              trace.names.size(), trace.dropped,
+              trace.synthetic_time ? " (no time source, 1 us per record)" : "");
+  return 0;
+}
+
+int record(const char* output_path, int ticks) {
+  RegisterFileComm comm;
+  comm.SetFrameTimeUs(8); // 32 bits at 4 MHz
+  Driver<RegisterFileComm> driver(comm);
+  if (!driver.Init()) {
+    std::fprintf(stderr, "driver init failed\n");
+    return 1;
+  }
+  ChannelConfig config{};
+  config.mode = ChannelMode::ICC;
+  if (!driver.ConfigureChannel(Channel::CH0, config) ||
+      !driver.ConfigurePwmPeriod(Channel::CH0, 500.0F) || !driver.EnterMissionMode() ||
+      !driver.EnableChannel(Channel::CH0, true)) {
+    std::fprintf(stderr, "channel setup failed\n");
+    return 1;
+  }
+
+  for (int tick = 0; tick < ticks; ++tick) {
+    comm.AdvanceTimeUs(1000); // 1 kHz control loop
+    (void)driver.SetCurrentSetpoint(Channel::CH0, static_cast<uint16_t>(200 + (tick % 50) * 10));
+    (void)driver.GetAverageCurrent(Channel::CH0);
+    if (tick % 10 == 0) {
+      (void)driver.GetChannelDiagnostics(Channel::CH0);
+    }
+  }
+
+  const TraceBuffer& trace = driver.GetTrace();
+  std::vector<uint8_t> image(trace.SerializedSize());
+  const std::size_t size = trace.Serialize(image);
+  std::ofstream output(output_path, std::ios::binary);
+  output.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(size));
+  if (!output) {
+    std::fprintf(stderr, "cannot write %s\n", output_path);
+    return 1;
+  }
+  std::printf("%s: %zu records, %u dropped, %zu bytes\n", output_path, trace.Size(),
+              trace.Dropped(), size);
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc == 4 && std::strcmp(argv[1], "convert") == 0) {
+    return convert(argv[2], argv[3]);
+  }
+  if ((argc == 3 || argc == 4) && std::strcmp(argv[1], "record") == 0) {
+    return record(argv[2], argc == 4 ? std::atoi(argv[3]) : 100);
+  }
+  std::fprintf(stderr,
+               "usage: %s convert <trace.bin> <trace.json>\n"
+               "       %s record <trace.bin> [ticks]\n",
+               argv[0], argv[0]);
+  return 1;
+}